@@ -24,6 +24,7 @@
 
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/linear_interpolation.h>
+#include <exadg/incompressible_navier_stokes/postprocessor/inflow_data_reader.h>
 
 // backward facing step application
 #include "include/geometry.h"
@@ -102,11 +103,22 @@ template<int dim>
 class InflowProfile : public Function<dim>
 {
 public:
-  InflowProfile(InflowDataStorage<dim> const & inflow_data_storage)
-    : Function<dim>(dim, 0.0), data(inflow_data_storage)
+  InflowProfile(InflowDataStorage<dim> const &               inflow_data_storage,
+                std::shared_ptr<InflowDataReader<dim>> const inflow_data_reader)
+    : Function<dim>(dim, 0.0), data(inflow_data_storage), reader(inflow_data_reader)
   {
   }
 
+  void
+  set_time(double const new_time) override
+  {
+    Function<dim>::set_time(new_time);
+
+    // replay inflow data from inflow database
+    if(reader.get() != nullptr)
+      reader->update(new_time);
+  }
+
   double
   value(Point<dim> const & p, unsigned int const component = 0) const
   {
@@ -118,6 +130,8 @@ public:
 
 private:
   InflowDataStorage<dim> const & data;
+
+  std::shared_ptr<InflowDataReader<dim>> reader;
 };
 
 template<int dim>
@@ -420,9 +434,13 @@ public:
       pair(0, new Functions::ZeroFunction<dim>(dim)));
 
     // inflow boundary condition at left boundary with ID=2: prescribe velocity profile which
-    // is obtained as the results of the precursor simulation
+    // is obtained as the results of the precursor simulation or replayed from an inflow database
+    std::shared_ptr<InflowDataReader<dim>> inflow_data_reader;
+    if(this->read_inflow_database)
+      inflow_data_reader.reset(new InflowDataReader<dim>(get_inflow_data()));
+
     boundary_descriptor_velocity->dirichlet_bc.insert(
-      pair(2, new InflowProfile<dim>(*inflow_data_storage)));
+      pair(2, new InflowProfile<dim>(*inflow_data_storage, inflow_data_reader)));
 
     // outflow boundary condition at right boundary with ID=1
     boundary_descriptor_velocity->neumann_bc.insert(pair(1, new Functions::ZeroFunction<dim>(dim)));
@@ -732,6 +750,23 @@ public:
     return pp;
   }
 
+  InflowData<dim>
+  get_inflow_data() const override
+  {
+    InflowData<dim> inflow_data;
+    inflow_data.normal_direction      = 0; /* x-direction */
+    inflow_data.normal_coordinate     = Geometry::X1_COORDINATE_OUTFLOW_CHANNEL;
+    inflow_data.n_points_y            = inflow_data_storage->n_points_y;
+    inflow_data.n_points_z            = inflow_data_storage->n_points_z;
+    inflow_data.y_values              = &inflow_data_storage->y_values;
+    inflow_data.z_values              = &inflow_data_storage->z_values;
+    inflow_data.array                 = &inflow_data_storage->velocity_values;
+    inflow_data.write_inflow_database = this->write_inflow_database;
+    inflow_data.filename              = this->output_directory + this->inflow_database;
+
+    return inflow_data;
+  }
+
   std::shared_ptr<PostProcessorBase<dim, Number>>
   construct_postprocessor_precursor(unsigned int const degree, MPI_Comm const & mpi_comm)
   {
@@ -765,14 +800,8 @@ public:
       this->output_directory + this->output_name + "_precursor";
 
     // use turbulent channel data to prescribe inflow velocity for BFS
+    pp_data_bfs.inflow_data                   = get_inflow_data();
     pp_data_bfs.inflow_data.write_inflow_data = true;
-    pp_data_bfs.inflow_data.normal_direction  = 0; /* x-direction */
-    pp_data_bfs.inflow_data.normal_coordinate = Geometry::X1_COORDINATE_OUTFLOW_CHANNEL;
-    pp_data_bfs.inflow_data.n_points_y        = inflow_data_storage->n_points_y;
-    pp_data_bfs.inflow_data.n_points_z        = inflow_data_storage->n_points_z;
-    pp_data_bfs.inflow_data.y_values          = &inflow_data_storage->y_values;
-    pp_data_bfs.inflow_data.z_values          = &inflow_data_storage->z_values;
-    pp_data_bfs.inflow_data.array             = &inflow_data_storage->velocity_values;
 
     pp.reset(new PostProcessorBFS<dim, Number>(pp_data_bfs, mpi_comm));
 
@@ -83,7 +83,9 @@ public:
     {
       inflow_data_calculator.reset(
         new InflowDataCalculator<dim, Number>(pp_data_bfs.inflow_data, this->mpi_comm));
-      inflow_data_calculator->setup(pde_operator.get_dof_handler_u(), pde_operator.get_mapping());
+      inflow_data_calculator->setup(pde_operator.get_dof_handler_u(),
+                                    pde_operator.get_mapping(),
+                                    pde_operator.get_param().restarted_simulation);
     }
 
     // evaluation of characteristic quantities along lines
@@ -117,7 +119,7 @@ public:
     // inflow data
     if(pp_data_bfs.inflow_data.write_inflow_data)
     {
-      inflow_data_calculator->calculate(velocity);
+      inflow_data_calculator->calculate(velocity, time, time_step_number);
     }
 
     // line plot statistics
@@ -24,6 +24,7 @@
 
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/linear_interpolation.h>
+#include <exadg/incompressible_navier_stokes/postprocessor/inflow_data_reader.h>
 
 // FDA nozzle benchmark application
 #include "include/flow_rate_controller.h"
@@ -100,11 +101,22 @@ template<int dim>
 class InflowProfile : public Function<dim>
 {
 public:
-  InflowProfile(InflowDataStorage<dim> const & inflow_data_storage)
-    : Function<dim>(dim, 0.0), data(inflow_data_storage)
+  InflowProfile(InflowDataStorage<dim> const &               inflow_data_storage,
+                std::shared_ptr<InflowDataReader<dim>> const inflow_data_reader)
+    : Function<dim>(dim, 0.0), data(inflow_data_storage), reader(inflow_data_reader)
   {
   }
 
+  void
+  set_time(double const new_time) override
+  {
+    Function<dim>::set_time(new_time);
+
+    // replay inflow data from inflow database
+    if(reader.get() != nullptr)
+      reader->update(new_time);
+  }
+
   double
   value(Point<dim> const & p, unsigned int const component = 0) const
   {
@@ -121,6 +133,8 @@ public:
 
 private:
   InflowDataStorage<dim> const & data;
+
+  std::shared_ptr<InflowDataReader<dim>> reader;
 };
 
 
@@ -565,9 +579,13 @@ public:
       pair(0, new Functions::ZeroFunction<dim>(dim)));
 
     // inflow boundary condition at left boundary with ID=1: prescribe velocity profile which
-    // is obtained as the results of the simulation on DOMAIN 1
+    // is obtained as the results of the simulation on DOMAIN 1 or replayed from an inflow database
+    std::shared_ptr<InflowDataReader<dim>> inflow_data_reader;
+    if(this->read_inflow_database)
+      inflow_data_reader.reset(new InflowDataReader<dim>(get_inflow_data()));
+
     boundary_descriptor_velocity->dirichlet_bc.insert(
-      pair(1, new InflowProfile<dim>(*inflow_data_storage)));
+      pair(1, new InflowProfile<dim>(*inflow_data_storage, inflow_data_reader)));
 
     // outflow boundary condition at right boundary with ID=2
     boundary_descriptor_velocity->neumann_bc.insert(pair(2, new Functions::ZeroFunction<dim>(dim)));
@@ -828,6 +846,24 @@ public:
     return pp;
   }
 
+  InflowData<dim>
+  get_inflow_data() const override
+  {
+    InflowData<dim> inflow_data;
+    inflow_data.inflow_geometry       = InflowGeometry::Cylindrical;
+    inflow_data.normal_direction      = 2;
+    inflow_data.normal_coordinate     = FDANozzle::Z2_PRECURSOR;
+    inflow_data.n_points_y            = inflow_data_storage->n_points_r;
+    inflow_data.n_points_z            = inflow_data_storage->n_points_phi;
+    inflow_data.y_values              = &inflow_data_storage->r_values;
+    inflow_data.z_values              = &inflow_data_storage->phi_values;
+    inflow_data.array                 = &inflow_data_storage->velocity_values;
+    inflow_data.write_inflow_database = this->write_inflow_database;
+    inflow_data.filename              = this->output_directory + this->inflow_database;
+
+    return inflow_data;
+  }
+
   std::shared_ptr<PostProcessorBase<dim, Number>>
   construct_postprocessor_precursor(unsigned int const degree, MPI_Comm const & mpi_comm)
   {
@@ -854,15 +890,8 @@ public:
     // inflow data
     // prescribe solution at the right boundary of the precursor domain
     // as weak Dirichlet boundary condition at the left boundary of the nozzle domain
+    pp_data_fda.inflow_data                   = get_inflow_data();
     pp_data_fda.inflow_data.write_inflow_data = true;
-    pp_data_fda.inflow_data.inflow_geometry   = InflowGeometry::Cylindrical;
-    pp_data_fda.inflow_data.normal_direction  = 2;
-    pp_data_fda.inflow_data.normal_coordinate = FDANozzle::Z2_PRECURSOR;
-    pp_data_fda.inflow_data.n_points_y        = inflow_data_storage->n_points_r;
-    pp_data_fda.inflow_data.n_points_z        = inflow_data_storage->n_points_phi;
-    pp_data_fda.inflow_data.y_values          = &inflow_data_storage->r_values;
-    pp_data_fda.inflow_data.z_values          = &inflow_data_storage->phi_values;
-    pp_data_fda.inflow_data.array             = &inflow_data_storage->velocity_values;
 
     // calculation of flow rate (use volume-based computation)
     pp_data_fda.mean_velocity_data.calculate       = true;
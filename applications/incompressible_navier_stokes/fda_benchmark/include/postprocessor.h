@@ -83,7 +83,9 @@ public:
       // inflow data
       inflow_data_calculator.reset(
         new InflowDataCalculator<dim, Number>(pp_data_fda.inflow_data, mpi_comm));
-      inflow_data_calculator->setup(pde_operator.get_dof_handler_u(), pde_operator.get_mapping());
+      inflow_data_calculator->setup(pde_operator.get_dof_handler_u(),
+                                    pde_operator.get_mapping(),
+                                    pde_operator.get_param().restarted_simulation);
 
       // calculation of mean velocity
       mean_velocity_calculator.reset(
@@ -118,7 +120,7 @@ public:
     if(use_precursor)
     {
       // inflow data
-      inflow_data_calculator->calculate(velocity);
+      inflow_data_calculator->calculate(velocity, time, time_step_number);
 
       // random perturbations
       if(add_random_perturbations)
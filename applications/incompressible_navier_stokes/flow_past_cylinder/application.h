@@ -24,6 +24,7 @@
 
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/linear_interpolation.h>
+#include <exadg/grid/grid_cache.h>
 
 // flow past cylinder application
 #include "include/grid.h"
@@ -244,9 +245,10 @@ public:
 
     // clang-format off
     prm.enter_subsection("Application");
-      prm.add_parameter("TestCase",     test_case,            "Number of test case.", Patterns::Integer(1,3));
-      prm.add_parameter("CylinderType", cylinder_type_string, "Type of cylinder.",    Patterns::Selection("circular|square"));
-      prm.add_parameter("CFL",          cfl_number,           "CFL number.",          Patterns::Double(0.0, 1.0e6), true);
+      prm.add_parameter("TestCase",           test_case,            "Number of test case.",      Patterns::Integer(1,3));
+      prm.add_parameter("CylinderType",       cylinder_type_string, "Type of cylinder.",         Patterns::Selection("circular|square"));
+      prm.add_parameter("CFL",                cfl_number,           "CFL number.",               Patterns::Double(0.0, 1.0e6), true);
+      prm.add_parameter("GridCacheDirectory", grid_cache_directory, "Grid cache (empty: off).");
     prm.leave_subsection();
     // clang-format on
   }
@@ -254,6 +256,9 @@ public:
   // string to read input parameter
   std::string cylinder_type_string = "circular";
 
+  // directory in which the partitioned grid is cached (disabled if empty)
+  std::string grid_cache_directory = "";
+
   // select test case according to Schaefer and Turek benchmark definition: 2D-1/2/3, 3D-1/2/3
   unsigned int test_case = 3; // 1, 2 or 3
 
@@ -476,24 +481,26 @@ public:
     if(auto tria_fully_dist =
          dynamic_cast<parallel::fullydistributed::Triangulation<dim> *>(&*triangulation))
     {
-      auto const construction_data =
-        TriangulationDescription::Utilities::create_description_from_triangulation_in_groups<dim,
-                                                                                             dim>(
-          [&](dealii::Triangulation<dim, dim> & tria) mutable {
-            create_cylinder_grid<dim>(tria, n_refine_space, periodic_faces, cylinder_type_string);
-          },
-          [](dealii::Triangulation<dim, dim> & tria,
-             const MPI_Comm                    comm,
-             unsigned int const /* group_size */) {
-            // metis partitioning
-            GridTools::partition_triangulation(Utilities::MPI::n_mpi_processes(comm), tria);
-            // p4est partitioning
-            //            GridTools::partition_triangulation_zorder(Utilities::MPI::n_mpi_processes(comm),
-            //            tria);
-          },
-          tria_fully_dist->get_communicator(),
-          1 /* group size */);
-      tria_fully_dist->create_triangulation(construction_data);
+      // the key has to contain all parameters that influence the grid
+      std::string const cache_key = get_grid_cache_key(dim, n_refine_space, cylinder_type_string);
+
+      GridCache::create_fully_distributed_triangulation<dim>(
+        *tria_fully_dist,
+        [&](dealii::Triangulation<dim, dim> & tria) mutable {
+          create_cylinder_grid<dim>(tria, n_refine_space, periodic_faces, cylinder_type_string);
+        },
+        [](dealii::Triangulation<dim, dim> & tria,
+           const MPI_Comm                    comm,
+           unsigned int const /* group_size */) {
+          // metis partitioning
+          GridTools::partition_triangulation(Utilities::MPI::n_mpi_processes(comm), tria);
+          // p4est partitioning
+          //            GridTools::partition_triangulation_zorder(Utilities::MPI::n_mpi_processes(comm),
+          //            tria);
+        },
+        1 /* group size */,
+        grid_cache_directory,
+        cache_key);
     }
     else if(auto tria = dynamic_cast<parallel::distributed::Triangulation<dim> *>(&*triangulation))
     {
@@ -22,6 +22,11 @@
 #ifndef APPLICATIONS_GRID_TOOLS_MESH_FLOW_PAST_CYLINDER_H_
 #define APPLICATIONS_GRID_TOOLS_MESH_FLOW_PAST_CYLINDER_H_
 
+// C/C++
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
 // boost
 #include <boost/math/special_functions/sign.hpp>
 
@@ -1318,6 +1323,49 @@ create_cylinder_grid(
   }
 }
 
+/*
+ * Returns a string containing all parameters that define the grid, used as key for the grid cache.
+ */
+inline std::string
+get_grid_cache_key(unsigned int const  dim,
+                   unsigned int const  n_refine_space,
+                   std::string const & cylinder_type_string)
+{
+  select_cylinder_type(cylinder_type_string);
+
+  std::ostringstream key;
+  key << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+  key << "flow_past_cylinder_dim_" << dim << "_" << cylinder_type_string << "_refine_"
+      << n_refine_space << "_geometry";
+
+  for(double const value : {X_0, Y_0, L1, L2, H, D, X_C, Y_C})
+    key << "_" << value;
+
+  if(cylinder_type == circular)
+  {
+    key << "_mesh_" << static_cast<int>(CircularCylinder::MESH_TYPE) << "_manifold_"
+        << static_cast<int>(CircularCylinder::MANIFOLD_TYPE) << "_" << CircularCylinder::X_2;
+  }
+  else if(cylinder_type == square)
+  {
+    key << "_shift_" << SquareCylinder::adaptive_mesh_shift << "_" << SquareCylinder::FAC_X_2;
+
+    for(unsigned int const n : {SquareCylinder::nele_y_bottom,
+                                SquareCylinder::nele_y_top,
+                                SquareCylinder::nele_y_middle,
+                                SquareCylinder::nele_x_left,
+                                SquareCylinder::nele_x_right,
+                                SquareCylinder::nele_x_middle_middle,
+                                SquareCylinder::nele_x_middle_left,
+                                SquareCylinder::nele_x_middle_right,
+                                SquareCylinder::nele_z})
+      key << "_" << n;
+  }
+
+  return key.str();
+}
+
 } // namespace FlowPastCylinder
 } // namespace ExaDG
 
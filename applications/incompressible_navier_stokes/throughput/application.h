@@ -45,6 +45,88 @@ string_to_enum(MeshType & enum_type, std::string const & string_type)
   // clang-format on
 }
 
+enum class InitialSolution
+{
+  Zero,
+  TaylorGreenVortex
+};
+
+void
+string_to_enum(InitialSolution & enum_type, std::string const & string_type)
+{
+  // clang-format off
+  if     (string_type == "Zero")              enum_type = InitialSolution::Zero;
+  else if(string_type == "TaylorGreenVortex") enum_type = InitialSolution::TaylorGreenVortex;
+  else AssertThrow(false, ExcMessage("Not implemented."));
+  // clang-format on
+}
+
+void
+string_to_enum(TemporalDiscretization & enum_type, std::string const & string_type)
+{
+  // clang-format off
+  if     (string_type == "BDFDualSplittingScheme") enum_type = TemporalDiscretization::BDFDualSplittingScheme;
+  else if(string_type == "BDFPressureCorrection")  enum_type = TemporalDiscretization::BDFPressureCorrection;
+  else if(string_type == "BDFCoupledSolution")     enum_type = TemporalDiscretization::BDFCoupledSolution;
+  else AssertThrow(false, ExcMessage("Not implemented."));
+  // clang-format on
+}
+
+/*
+ *  Taylor-Green vortex with wave length 2 * pi * L (3D) or its two-dimensional counterpart (2D)
+ */
+template<int dim>
+class InitialSolutionVelocity : public Function<dim>
+{
+public:
+  InitialSolutionVelocity(double const V_0, double const L)
+    : Function<dim>(dim, 0.0), V_0(V_0), L(L)
+  {
+  }
+
+  double
+  value(Point<dim> const & p, unsigned int const component = 0) const
+  {
+    double const cos_z = (dim == 3) ? std::cos(p[dim - 1] / L) : 1.0;
+
+    double result = 0.0;
+
+    if(component == 0)
+      result = V_0 * std::sin(p[0] / L) * std::cos(p[1] / L) * cos_z;
+    else if(component == 1)
+      result = -V_0 * std::cos(p[0] / L) * std::sin(p[1] / L) * cos_z;
+
+    return result;
+  }
+
+private:
+  double const V_0, L;
+};
+
+template<int dim>
+class InitialSolutionPressure : public Function<dim>
+{
+public:
+  InitialSolutionPressure(double const V_0, double const L)
+    : Function<dim>(1 /*n_components*/, 0.0), V_0(V_0), L(L)
+  {
+  }
+
+  double
+  value(Point<dim> const & p, unsigned int const /*component*/) const
+  {
+    double const sum_xy = std::cos(2.0 * p[0] / L) + std::cos(2.0 * p[1] / L);
+
+    if(dim == 3)
+      return V_0 * V_0 / 16.0 * sum_xy * (std::cos(2.0 * p[dim - 1] / L) + 2.0);
+    else
+      return V_0 * V_0 / 4.0 * sum_xy;
+  }
+
+private:
+  double const V_0, L;
+};
+
 template<int dim, typename Number>
 class Application : public ApplicationBase<dim, Number>
 {
@@ -59,6 +141,8 @@ public:
     prm.parse_input(input_file, "", true, true);
 
     string_to_enum(mesh_type, mesh_type_string);
+    string_to_enum(initial_solution, initial_solution_string);
+    string_to_enum(temporal_discretization, temporal_discretization_string);
   }
 
   void
@@ -69,6 +153,9 @@ public:
     // clang-format off
     prm.enter_subsection("Application");
       prm.add_parameter("MeshType",  mesh_type_string, "Type of mesh (Cartesian versus curvilinear).", Patterns::Selection("Cartesian|Curvilinear"));
+      prm.add_parameter("InitialSolution", initial_solution_string, "Initial solution (Taylor-Green vortex at Re = 1600 for measurements of complete time steps).", Patterns::Selection("Zero|TaylorGreenVortex"));
+      prm.add_parameter("TemporalDiscretization", temporal_discretization_string, "Solution approach.", Patterns::Selection("BDFDualSplittingScheme|BDFPressureCorrection|BDFCoupledSolution"));
+      prm.add_parameter("Preconditioning", preconditioning, "Use the preconditioners of production runs instead of unpreconditioned solvers.", Patterns::Bool());
     prm.leave_subsection();
     // clang-format on
   }
@@ -76,6 +163,19 @@ public:
   std::string mesh_type_string = "Cartesian";
   MeshType    mesh_type        = MeshType::Cartesian;
 
+  std::string     initial_solution_string = "Zero";
+  InitialSolution initial_solution        = InitialSolution::Zero;
+
+  std::string            temporal_discretization_string = "BDFDualSplittingScheme";
+  TemporalDiscretization temporal_discretization = TemporalDiscretization::BDFDualSplittingScheme;
+
+  bool preconditioning = false;
+
+  // Taylor-Green vortex in the box [-1,1]^dim, i.e., L = 1/pi
+  double const V_0 = 1.0;
+  double const L   = 1.0 / numbers::PI;
+  double const Re  = 1600.0;
+
   void
   set_input_parameters(InputParameters & param)
   {
@@ -89,17 +189,16 @@ public:
     // PHYSICAL QUANTITIES
     param.start_time = 0.0;
     param.end_time   = 1.0;
-    param.viscosity  = 1.0;
+    param.viscosity =
+      (initial_solution == InitialSolution::TaylorGreenVortex) ? V_0 * L / Re : 1.0;
 
     // TEMPORAL DISCRETIZATION
     param.solver_type = SolverType::Unsteady;
-    param.temporal_discretization =
-      TemporalDiscretization::BDFDualSplittingScheme; // BDFPressureCorrection;
-                                                      // //BDFCoupledSolution;
+    param.temporal_discretization       = temporal_discretization;
     param.treatment_of_convective_term  = TreatmentOfConvectiveTerm::Explicit;
     param.calculation_of_time_step_size = TimeStepCalculation::CFL;
     param.cfl                           = 1.0;
-    param.max_velocity                  = 1.0;
+    param.max_velocity                  = V_0;
 
     // NUMERICAL PARAMETERS
     param.quad_rule_linearization = QuadratureRuleLinearization::Standard; // Overintegration32k;
@@ -169,6 +268,19 @@ public:
 
     param.preconditioner_velocity_block = MomentumPreconditioner::None;
     param.preconditioner_pressure_block = SchurComplementPreconditioner::None;
+
+    // preconditioners as used for turbulent flow simulations (e.g., taylor_green_vortex)
+    if(preconditioning)
+    {
+      param.preconditioner_pressure_poisson      = PreconditionerPressurePoisson::Multigrid;
+      param.multigrid_data_pressure_poisson.type = MultigridType::cphMG;
+      param.preconditioner_projection            = PreconditionerProjection::InverseMassMatrix;
+      param.preconditioner_viscous               = PreconditionerViscous::InverseMassMatrix;
+      param.preconditioner_momentum              = MomentumPreconditioner::InverseMassMatrix;
+      param.preconditioner_coupled               = PreconditionerCoupled::BlockTriangular;
+      param.preconditioner_velocity_block        = MomentumPreconditioner::InverseMassMatrix;
+      param.preconditioner_pressure_block        = SchurComplementPreconditioner::CahouetChabard;
+    }
   }
 
   void
@@ -218,8 +330,16 @@ public:
   void
   set_field_functions(std::shared_ptr<FieldFunctions<dim>> field_functions)
   {
-    field_functions->initial_solution_velocity.reset(new Functions::ZeroFunction<dim>(dim));
-    field_functions->initial_solution_pressure.reset(new Functions::ZeroFunction<dim>(dim));
+    if(initial_solution == InitialSolution::TaylorGreenVortex)
+    {
+      field_functions->initial_solution_velocity.reset(new InitialSolutionVelocity<dim>(V_0, L));
+      field_functions->initial_solution_pressure.reset(new InitialSolutionPressure<dim>(V_0, L));
+    }
+    else
+    {
+      field_functions->initial_solution_velocity.reset(new Functions::ZeroFunction<dim>(dim));
+      field_functions->initial_solution_pressure.reset(new Functions::ZeroFunction<dim>(dim));
+    }
     field_functions->analytical_solution_pressure.reset(new Functions::ZeroFunction<dim>(1));
     field_functions->right_hand_side.reset(new Functions::ZeroFunction<dim>(dim));
   }
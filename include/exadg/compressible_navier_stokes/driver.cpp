@@ -127,6 +127,8 @@ Driver<dim, Number>::setup(std::shared_ptr<ApplicationBase<dim, Number>> app,
   matrix_free_data->data.tasks_parallel_scheme =
     MatrixFree<dim, Number>::AdditionalData::partition_partition;
   comp_navier_stokes_operator->fill_matrix_free_data(*matrix_free_data);
+  if(param.use_dof_renumbering)
+    comp_navier_stokes_operator->renumber_dofs(*matrix_free_data);
 
   matrix_free.reset(new MatrixFree<dim, Number>());
   matrix_free->reinit(*mapping,
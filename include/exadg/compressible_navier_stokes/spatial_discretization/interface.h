@@ -24,6 +24,9 @@
 
 #include <deal.II/lac/la_parallel_vector.h>
 
+#include <exadg/matrix_free/time_step_classes.h>
+#include <exadg/time_integration/restart.h>
+
 namespace ExaDG
 {
 namespace CompNS
@@ -54,6 +57,13 @@ public:
   virtual void
   prescribe_initial_conditions(VectorType & src, double const evaluation_time) const = 0;
 
+  // restart: partition-independent serialization of the solution vector
+  virtual void
+  serialize_restart_vector(RestartArchiveOut & archive, VectorType const & src) const = 0;
+
+  virtual void
+  deserialize_restart_vector(RestartArchiveIn & archive, VectorType & dst) const = 0;
+
   // needed time step calculation
   virtual double
   calculate_minimum_element_length() const = 0;
@@ -66,6 +76,21 @@ public:
   virtual void
   evaluate(VectorType & dst, VectorType const & src, Number const evaluation_time) const = 0;
 
+  // local time stepping: number of time step classes
+  virtual unsigned int
+  get_number_of_time_step_classes() const = 0;
+
+  // local time stepping: cells, faces, and degrees of freedom of the time step classes
+  virtual TimeStepClasses<Number> const &
+  get_time_step_classes() const = 0;
+
+  // local time stepping: evaluate operator for the cells and faces of one time step class
+  virtual void
+  evaluate_time_step_class(VectorType &       dst,
+                           VectorType const & src,
+                           Number const       evaluation_time,
+                           unsigned int const time_step_class) const = 0;
+
   // analysis of computational costs
   virtual double
   get_wall_time_operator_evaluation() const = 0;
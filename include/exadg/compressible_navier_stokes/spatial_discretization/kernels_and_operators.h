@@ -33,6 +33,7 @@
 #include <exadg/compressible_navier_stokes/user_interface/input_parameters.h>
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/matrix_free/time_step_classes.h>
 #include <exadg/operators/interior_penalty_parameter.h>
 
 namespace ExaDG
@@ -313,7 +314,7 @@ public:
   typedef Tensor<2, dim, VectorizedArray<Number>> tensor;
   typedef Point<dim, VectorizedArray<Number>>     point;
 
-  BodyForceOperator() : matrix_free(nullptr), eval_time(0.0)
+  BodyForceOperator() : matrix_free(nullptr), eval_time(0.0), loop_mask(nullptr)
   {
   }
 
@@ -334,8 +335,22 @@ public:
 
   void
   evaluate_add(VectorType & dst, VectorType const & src, double const evaluation_time) const
+  {
+    evaluate_add(dst, src, evaluation_time, nullptr);
+  }
+
+  /*
+   * Restricts the evaluation to the cells and faces selected by the loop mask (local time
+   * stepping).
+   */
+  void
+  evaluate_add(VectorType &                   dst,
+               VectorType const &             src,
+               double const                   evaluation_time,
+               LoopMask<Number> const * const loop_mask_in) const
   {
     this->eval_time = evaluation_time;
+    this->loop_mask = loop_mask_in;
 
     matrix_free->cell_loop(&This::cell_loop, this, dst, src);
   }
@@ -371,6 +386,9 @@ private:
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      if(loop_mask != nullptr && not loop_mask->is_cell_batch_active(cell))
+        continue;
+
       density.reinit(cell);
       density.gather_evaluate(src, true, false);
 
@@ -399,6 +417,8 @@ private:
   BodyForceOperatorData<dim> data;
 
   double mutable eval_time;
+
+  mutable LoopMask<Number> const * loop_mask;
 };
 
 struct MassOperatorData
@@ -524,7 +544,7 @@ public:
   typedef Tensor<2, dim, VectorizedArray<Number>> tensor;
   typedef Point<dim, VectorizedArray<Number>>     point;
 
-  ConvectiveOperator() : matrix_free(nullptr)
+  ConvectiveOperator() : matrix_free(nullptr), loop_mask(nullptr)
   {
   }
 
@@ -549,8 +569,22 @@ public:
 
   void
   evaluate_add(VectorType & dst, VectorType const & src, Number const evaluation_time) const
+  {
+    evaluate_add(dst, src, evaluation_time, nullptr);
+  }
+
+  /*
+   * Restricts the evaluation to the cells and faces selected by the loop mask (local time
+   * stepping).
+   */
+  void
+  evaluate_add(VectorType &                   dst,
+               VectorType const &             src,
+               Number const                   evaluation_time,
+               LoopMask<Number> const * const loop_mask_in) const
   {
     this->eval_time = evaluation_time;
+    this->loop_mask = loop_mask_in;
 
     matrix_free->loop(
       &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
@@ -754,6 +788,9 @@ private:
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      if(loop_mask != nullptr && not loop_mask->is_cell_batch_active(cell))
+        continue;
+
       density.reinit(cell);
       density.gather_evaluate(src, true, false);
 
@@ -795,6 +832,9 @@ private:
 
     for(unsigned int face = face_range.first; face < face_range.second; face++)
     {
+      if(loop_mask != nullptr && not loop_mask->is_face_batch_active(face))
+        continue;
+
       // density
       density_m.reinit(face);
       density_m.gather_evaluate(src, true, false);
@@ -834,14 +874,14 @@ private:
         energy_p.submit_value(-std::get<2>(flux), q);
       }
 
-      density_m.integrate_scatter(true, false, dst);
-      density_p.integrate_scatter(true, false, dst);
+      integrate_scatter_masked(density_m, true, false, dst, loop_mask, face);
+      integrate_scatter_masked(density_p, true, false, dst, loop_mask, face);
 
-      momentum_m.integrate_scatter(true, false, dst);
-      momentum_p.integrate_scatter(true, false, dst);
+      integrate_scatter_masked(momentum_m, true, false, dst, loop_mask, face);
+      integrate_scatter_masked(momentum_p, true, false, dst, loop_mask, face);
 
-      energy_m.integrate_scatter(true, false, dst);
-      energy_p.integrate_scatter(true, false, dst);
+      integrate_scatter_masked(energy_m, true, false, dst, loop_mask, face);
+      integrate_scatter_masked(energy_p, true, false, dst, loop_mask, face);
     }
   }
 
@@ -857,6 +897,9 @@ private:
 
     for(unsigned int face = face_range.first; face < face_range.second; face++)
     {
+      if(loop_mask != nullptr && not loop_mask->is_face_batch_active(face))
+        continue;
+
       density.reinit(face);
       density.gather_evaluate(src, true, false);
 
@@ -893,9 +936,9 @@ private:
         energy.submit_value(std::get<2>(flux), q);
       }
 
-      density.integrate_scatter(true, false, dst);
-      momentum.integrate_scatter(true, false, dst);
-      energy.integrate_scatter(true, false, dst);
+      integrate_scatter_masked(density, true, false, dst, loop_mask, face);
+      integrate_scatter_masked(momentum, true, false, dst, loop_mask, face);
+      integrate_scatter_masked(energy, true, false, dst, loop_mask, face);
     }
   }
 
@@ -913,6 +956,8 @@ private:
   Number c_v;
 
   mutable Number eval_time;
+
+  mutable LoopMask<Number> const * loop_mask;
 };
 
 
@@ -965,7 +1010,7 @@ public:
   typedef Tensor<2, dim, VectorizedArray<Number>> tensor;
   typedef Point<dim, VectorizedArray<Number>>     point;
 
-  ViscousOperator() : matrix_free(nullptr), degree(1)
+  ViscousOperator() : matrix_free(nullptr), degree(1), loop_mask(nullptr)
   {
   }
 
@@ -1000,8 +1045,22 @@ public:
 
   void
   evaluate_add(VectorType & dst, VectorType const & src, Number const evaluation_time) const
+  {
+    evaluate_add(dst, src, evaluation_time, nullptr);
+  }
+
+  /*
+   * Restricts the evaluation to the cells and faces selected by the loop mask (local time
+   * stepping).
+   */
+  void
+  evaluate_add(VectorType &                   dst,
+               VectorType const &             src,
+               Number const                   evaluation_time,
+               LoopMask<Number> const * const loop_mask_in) const
   {
     this->eval_time = evaluation_time;
+    this->loop_mask = loop_mask_in;
 
     matrix_free->loop(
       &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
@@ -1430,6 +1489,9 @@ private:
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      if(loop_mask != nullptr && not loop_mask->is_cell_batch_active(cell))
+        continue;
+
       density.reinit(cell);
       density.gather_evaluate(src, true, true);
 
@@ -1469,6 +1531,9 @@ private:
 
     for(unsigned int face = face_range.first; face < face_range.second; face++)
     {
+      if(loop_mask != nullptr && not loop_mask->is_face_batch_active(face))
+        continue;
+
       // density
       density_m.reinit(face);
       density_m.gather_evaluate(src, true, true);
@@ -1521,14 +1586,14 @@ private:
         energy_p.submit_value(std::get<2>(gradient_flux), q);
       }
 
-      density_m.integrate_scatter(true, false, dst);
-      density_p.integrate_scatter(true, false, dst);
+      integrate_scatter_masked(density_m, true, false, dst, loop_mask, face);
+      integrate_scatter_masked(density_p, true, false, dst, loop_mask, face);
 
-      momentum_m.integrate_scatter(true, true, dst);
-      momentum_p.integrate_scatter(true, true, dst);
+      integrate_scatter_masked(momentum_m, true, true, dst, loop_mask, face);
+      integrate_scatter_masked(momentum_p, true, true, dst, loop_mask, face);
 
-      energy_m.integrate_scatter(true, true, dst);
-      energy_p.integrate_scatter(true, true, dst);
+      integrate_scatter_masked(energy_m, true, true, dst, loop_mask, face);
+      integrate_scatter_masked(energy_p, true, true, dst, loop_mask, face);
     }
   }
 
@@ -1544,6 +1609,9 @@ private:
 
     for(unsigned int face = face_range.first; face < face_range.second; face++)
     {
+      if(loop_mask != nullptr && not loop_mask->is_face_batch_active(face))
+        continue;
+
       density.reinit(face);
       density.gather_evaluate(src, true, true);
 
@@ -1597,9 +1665,9 @@ private:
         energy.submit_value(-std::get<2>(gradient_flux), q);
       }
 
-      density.integrate_scatter(true, false, dst);
-      momentum.integrate_scatter(true, true, dst);
-      energy.integrate_scatter(true, true, dst);
+      integrate_scatter_masked(density, true, false, dst, loop_mask, face);
+      integrate_scatter_masked(momentum, true, true, dst, loop_mask, face);
+      integrate_scatter_masked(energy, true, true, dst, loop_mask, face);
     }
   }
 
@@ -1630,6 +1698,8 @@ private:
   AlignedVector<VectorizedArray<Number>> array_penalty_parameter;
 
   mutable Number eval_time;
+
+  mutable LoopMask<Number> const * loop_mask;
 };
 
 template<int dim>
@@ -1668,7 +1738,11 @@ public:
   typedef Tensor<2, dim, VectorizedArray<Number>> tensor;
   typedef Point<dim, VectorizedArray<Number>>     point;
 
-  CombinedOperator() : matrix_free(nullptr), convective_operator(nullptr), viscous_operator(nullptr)
+  CombinedOperator()
+    : matrix_free(nullptr),
+      convective_operator(nullptr),
+      viscous_operator(nullptr),
+      loop_mask(nullptr)
   {
   }
 
@@ -1694,10 +1768,25 @@ public:
 
   void
   evaluate_add(VectorType & dst, VectorType const & src, Number const evaluation_time) const
+  {
+    evaluate_add(dst, src, evaluation_time, nullptr);
+  }
+
+  /*
+   * Restricts the evaluation to the cells and faces selected by the loop mask (local time
+   * stepping).
+   */
+  void
+  evaluate_add(VectorType &                   dst,
+               VectorType const &             src,
+               Number const                   evaluation_time,
+               LoopMask<Number> const * const loop_mask_in) const
   {
     convective_operator->set_evaluation_time(evaluation_time);
     viscous_operator->set_evaluation_time(evaluation_time);
 
+    this->loop_mask = loop_mask_in;
+
     matrix_free->loop(
       &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
 
@@ -1718,6 +1807,9 @@ private:
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      if(loop_mask != nullptr && not loop_mask->is_cell_batch_active(cell))
+        continue;
+
       density.reinit(cell);
       density.gather_evaluate(src, true, true);
 
@@ -1761,6 +1853,9 @@ private:
 
     for(unsigned int face = face_range.first; face < face_range.second; face++)
     {
+      if(loop_mask != nullptr && not loop_mask->is_face_batch_active(face))
+        continue;
+
       // density
       density_m.reinit(face);
       density_m.gather_evaluate(src, true, true);
@@ -1817,14 +1912,14 @@ private:
         energy_p.submit_gradient(std::get<5>(visc_value_flux), q);
       }
 
-      density_m.integrate_scatter(true, false, dst);
-      density_p.integrate_scatter(true, false, dst);
+      integrate_scatter_masked(density_m, true, false, dst, loop_mask, face);
+      integrate_scatter_masked(density_p, true, false, dst, loop_mask, face);
 
-      momentum_m.integrate_scatter(true, true, dst);
-      momentum_p.integrate_scatter(true, true, dst);
+      integrate_scatter_masked(momentum_m, true, true, dst, loop_mask, face);
+      integrate_scatter_masked(momentum_p, true, true, dst, loop_mask, face);
 
-      energy_m.integrate_scatter(true, true, dst);
-      energy_p.integrate_scatter(true, true, dst);
+      integrate_scatter_masked(energy_m, true, true, dst, loop_mask, face);
+      integrate_scatter_masked(energy_p, true, true, dst, loop_mask, face);
     }
   }
 
@@ -1840,6 +1935,9 @@ private:
 
     for(unsigned int face = face_range.first; face < face_range.second; face++)
     {
+      if(loop_mask != nullptr && not loop_mask->is_face_batch_active(face))
+        continue;
+
       density.reinit(face);
       density.gather_evaluate(src, true, true);
 
@@ -1906,9 +2004,9 @@ private:
         energy.submit_gradient(std::get<2>(visc_value_flux), q);
       }
 
-      density.integrate_scatter(true, false, dst);
-      momentum.integrate_scatter(true, true, dst);
-      energy.integrate_scatter(true, true, dst);
+      integrate_scatter_masked(density, true, false, dst, loop_mask, face);
+      integrate_scatter_masked(momentum, true, true, dst, loop_mask, face);
+      integrate_scatter_masked(energy, true, true, dst, loop_mask, face);
     }
   }
 
@@ -1918,6 +2016,8 @@ private:
 
   ConvectiveOperator<dim, Number> const * convective_operator;
   ViscousOperator<dim, Number> const *    viscous_operator;
+
+  mutable LoopMask<Number> const * loop_mask;
 };
 
 } // namespace CompNS
@@ -25,6 +25,8 @@
 
 // ExaDG
 #include <exadg/compressible_navier_stokes/spatial_discretization/operator.h>
+#include <exadg/matrix_free/categorization.h>
+#include <exadg/matrix_free/dof_renumbering.h>
 #include <exadg/time_integration/time_step_calculation.h>
 
 namespace ExaDG
@@ -65,6 +67,7 @@ Operator<dim, Number>::Operator(
     dof_handler_vector(triangulation_in),
     dof_handler_scalar(triangulation_in),
     mpi_comm(mpi_comm_in),
+    n_time_step_classes(1),
     pcout(std::cout, Utilities::MPI::this_mpi_process(mpi_comm_in) == 0),
     wall_time_operator_evaluation(0.0)
 {
@@ -91,6 +94,9 @@ Operator<dim, Number>::Operator(
 
   distribute_dofs();
 
+  if(param.use_local_time_stepping)
+    setup_time_step_classes();
+
   constraint.close();
 
   pcout << std::endl << "... done!" << std::endl;
@@ -126,6 +132,10 @@ Operator<dim, Number>::fill_matrix_free_data(MatrixFreeData<dim, Number> & matri
                                      field + quad_index_overintegration_conv);
   matrix_free_data.insert_quadrature(QGauss<1>(n_q_points_visc),
                                      field + quad_index_overintegration_vis);
+
+  // cell batches must not mix time step classes
+  if(param.use_local_time_stepping)
+    Categorization::do_time_step_classes(time_step_class_of_cell, matrix_free_data.data);
 }
 
 template<int dim, typename Number>
@@ -141,6 +151,12 @@ Operator<dim, Number>::setup(std::shared_ptr<MatrixFree<dim, Number>>     matrix
   // perform setup of data structures that depend on matrix-free object
   setup_operators();
 
+  if(param.use_local_time_stepping)
+    time_step_classes.reinit(*matrix_free,
+                             get_dof_index_all(),
+                             time_step_class_of_cell,
+                             n_time_step_classes);
+
   pcout << std::endl << "... done!" << std::endl;
 }
 
@@ -192,6 +208,22 @@ Operator<dim, Number>::prescribe_initial_conditions(VectorType & src, double con
   src = src_double;
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::serialize_restart_vector(RestartArchiveOut & archive,
+                                                VectorType const &  src) const
+{
+  write_restart_vector(archive, src, dof_handler);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::deserialize_restart_vector(RestartArchiveIn & archive,
+                                                  VectorType &       dst) const
+{
+  read_restart_vector(archive, dst, dof_handler);
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::evaluate(VectorType & dst, VectorType const & src, Number const time) const
@@ -272,6 +304,75 @@ Operator<dim, Number>::evaluate_convective_and_viscous(VectorType &       dst,
   }
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_time_step_class(VectorType &       dst,
+                                                VectorType const & src,
+                                                Number const       time,
+                                                unsigned int const time_step_class) const
+{
+  Timer timer;
+  timer.restart();
+
+  LoopMask<Number> const & loop_mask = time_step_classes.get_loop_mask(time_step_class);
+
+  std::vector<std::pair<unsigned int, unsigned int>> const & ranges =
+    time_step_classes.get_dof_ranges_touched(time_step_class);
+
+  // set dst to zero on the cell batches touched by this class
+  dst.zero_out_ghosts();
+  for_each_local_index(ranges, [&](unsigned int const i) { dst.local_element(i) = 0.0; });
+
+  if(param.use_combined_operator == true)
+  {
+    // viscous and convective terms
+    combined_operator.evaluate_add(dst, src, time, &loop_mask);
+  }
+  else // apply operators separately
+  {
+    // viscous operator
+    if(param.equation_type == EquationType::NavierStokes)
+    {
+      viscous_operator.evaluate_add(dst, src, time, &loop_mask);
+    }
+
+    // convective operator
+    if(param.equation_type == EquationType::Euler ||
+       param.equation_type == EquationType::NavierStokes)
+    {
+      convective_operator.evaluate_add(dst, src, time, &loop_mask);
+    }
+  }
+
+  // shift viscous and convective terms to the right-hand side of the equation
+  for_each_local_index(ranges, [&](unsigned int const i) { dst.local_element(i) *= -1.0; });
+
+  // body force term
+  if(param.right_hand_side == true)
+  {
+    body_force_operator.evaluate_add(dst, src, time, &loop_mask);
+  }
+
+  // apply inverse mass operator
+  inverse_mass_all.apply(dst, dst, time_step_classes.get_cell_batches_touched(time_step_class));
+
+  wall_time_operator_evaluation += timer.wall_time();
+}
+
+template<int dim, typename Number>
+unsigned int
+Operator<dim, Number>::get_number_of_time_step_classes() const
+{
+  return n_time_step_classes;
+}
+
+template<int dim, typename Number>
+TimeStepClasses<Number> const &
+Operator<dim, Number>::get_time_step_classes() const
+{
+  return time_step_classes;
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::apply_inverse_mass(VectorType & dst, VectorType const & src) const
@@ -455,6 +556,132 @@ Operator<dim, Number>::distribute_dofs()
   print_parameter(pcout, "number of 1D q-points (over-vis)", n_q_points_visc);
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::renumber_dofs(MatrixFreeData<dim, Number> const & matrix_free_data)
+{
+  // there are no constraints for DG discretizations
+  renumber_dofs_for_data_locality(dof_handler, constraint, matrix_free_data.data);
+  renumber_dofs_for_data_locality(dof_handler_vector, constraint, matrix_free_data.data);
+  renumber_dofs_for_data_locality(dof_handler_scalar, constraint, matrix_free_data.data);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::setup_time_step_classes()
+{
+  /*
+   * The time step size of the CFL condition is proportional to h / (|u| + a) with the element
+   * length h, the velocity u and the speed of sound a. The time step size of the smallest class is
+   * computed with the minimum element length h_min and the maximum wave speed
+   * max_velocity + sqrt(gamma * R * max_temperature), see TimeIntExplRK. Hence, a cell can be
+   * advanced with 2^c times this time step size, where c = floor(log2(ratio)) with
+   * ratio = (h / h_min) * (wave speed maximum / wave speed of the cell), limited by the maximum
+   * number of time step classes.
+   *
+   * The wave speed of a cell is evaluated for the initial solution at the vertices and the center
+   * of the cell and of its face neighbors, since the classes are not updated during the
+   * simulation and the flow is transported into the neighboring cells.
+   */
+  Triangulation<dim> const & triangulation = dof_handler.get_triangulation();
+
+  double const h_min = calculate_minimum_element_length();
+
+  double const gamma = param.heat_capacity_ratio;
+
+  double const wave_speed_max =
+    param.max_velocity + std::sqrt(gamma * param.specific_gas_constant * param.max_temperature);
+
+  Function<dim> & initial_solution = *field_functions->initial_solution;
+  initial_solution.set_time(param.start_time);
+
+  auto const wave_speed_point = [&](Point<dim> const & point) {
+    Vector<double> solution(dim + 2);
+    initial_solution.vector_value(point, solution);
+
+    double const rho = solution[0];
+
+    Tensor<1, dim, double> u;
+    for(unsigned int d = 0; d < dim; ++d)
+      u[d] = solution[1 + d] / rho;
+
+    double const p = (gamma - 1.0) * (solution[dim + 1] - 0.5 * rho * u.norm_square());
+
+    return u.norm() + std::sqrt(gamma * p / rho);
+  };
+
+  // cache of the wave speed of all cells including the artificial neighbors of ghost cells
+  std::vector<double> wave_speed_of_cell(triangulation.n_active_cells(), -1.0);
+
+  auto const wave_speed_cell = [&](typename Triangulation<dim>::active_cell_iterator const & cell) {
+    double & wave_speed = wave_speed_of_cell[cell->active_cell_index()];
+    if(wave_speed < 0.0)
+    {
+      wave_speed = wave_speed_point(cell->center());
+      for(unsigned int v = 0; v < GeometryInfo<dim>::vertices_per_cell; ++v)
+        wave_speed = std::max(wave_speed, wave_speed_point(cell->vertex(v)));
+    }
+
+    return wave_speed;
+  };
+
+  unsigned int const max_class = param.max_number_of_time_step_classes - 1;
+
+  time_step_class_of_cell.assign(triangulation.n_active_cells(), 0);
+
+  unsigned int n_classes_local = 1;
+  for(auto const & cell : triangulation.active_cell_iterators())
+  {
+    if(cell->is_artificial())
+      continue;
+
+    double wave_speed = wave_speed_cell(cell);
+    for(unsigned int f = 0; f < GeometryInfo<dim>::faces_per_cell; ++f)
+    {
+      if(cell->at_boundary(f))
+        continue;
+
+      if(cell->neighbor(f)->has_children())
+      {
+        for(unsigned int sf = 0; sf < cell->face(f)->n_children(); ++sf)
+          wave_speed =
+            std::max(wave_speed, wave_speed_cell(cell->neighbor_child_on_subface(f, sf)));
+      }
+      else
+      {
+        wave_speed = std::max(wave_speed, wave_speed_cell(cell->neighbor(f)));
+      }
+    }
+
+    double const ratio = cell->minimum_vertex_distance() / h_min * wave_speed_max / wave_speed;
+
+    // the small tolerance ensures that cells of equal size end up in the same class
+    double const log_ratio = std::max(0.0, std::floor(std::log2(ratio) + 1.e-12));
+
+    unsigned int const c = std::min(max_class, static_cast<unsigned int>(log_ratio));
+
+    time_step_class_of_cell[cell->active_cell_index()] = c;
+
+    n_classes_local = std::max(n_classes_local, c + 1);
+  }
+
+  n_time_step_classes = Utilities::MPI::max(n_classes_local, mpi_comm);
+
+  // print number of cells per class
+  std::vector<unsigned int> n_cells(n_time_step_classes, 0);
+  for(auto const & cell : triangulation.active_cell_iterators())
+    if(cell->is_locally_owned())
+      ++n_cells[time_step_class_of_cell[cell->active_cell_index()]];
+
+  pcout << std::endl << "Local time stepping:" << std::endl << std::endl;
+
+  print_parameter(pcout, "number of time step classes", n_time_step_classes);
+  for(unsigned int c = 0; c < n_time_step_classes; ++c)
+    print_parameter(pcout,
+                    "number of cells (class " + std::to_string(c) + ")",
+                    Utilities::MPI::sum(n_cells[c], mpi_comm));
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::setup_operators()
@@ -36,6 +36,7 @@
 #include <exadg/compressible_navier_stokes/user_interface/field_functions.h>
 #include <exadg/compressible_navier_stokes/user_interface/input_parameters.h>
 #include <exadg/matrix_free/matrix_free_wrapper.h>
+#include <exadg/matrix_free/time_step_classes.h>
 #include <exadg/operators/inverse_mass_operator.h>
 
 namespace ExaDG
@@ -66,6 +67,14 @@ public:
   void
   fill_matrix_free_data(MatrixFreeData<dim, Number> & matrix_free_data) const;
 
+  /*
+   * Renumbers the degrees of freedom for data locality in the matrix-free loops set up with
+   * matrix_free_data (parameter use_dof_renumbering). Has to be called after
+   * fill_matrix_free_data() and before MatrixFree is initialized.
+   */
+  void
+  renumber_dofs(MatrixFreeData<dim, Number> const & matrix_free_data);
+
   void
   setup(std::shared_ptr<MatrixFree<dim, Number>>     matrix_free,
         std::shared_ptr<MatrixFreeData<dim, Number>> matrix_free_data);
@@ -87,6 +96,13 @@ public:
   void
   prescribe_initial_conditions(VectorType & src, double const time) const;
 
+  // restart
+  void
+  serialize_restart_vector(RestartArchiveOut & archive, VectorType const & src) const;
+
+  void
+  deserialize_restart_vector(RestartArchiveIn & archive, VectorType & dst) const;
+
   /*
    *  This function is used in case of explicit time integration:
    *  This function evaluates the right-hand side operator, the
@@ -108,6 +124,23 @@ public:
                                   VectorType const & src,
                                   Number const       time) const;
 
+  /*
+   *  Local time stepping: Same as evaluate(), but restricted to the cells and faces of time step
+   *  class time_step_class. The face integrals are also added to the coarser neighbors of this
+   *  class. Only the degrees of freedom of the cell batches touched by this class are written.
+   */
+  void
+  evaluate_time_step_class(VectorType &       dst,
+                           VectorType const & src,
+                           Number const       time,
+                           unsigned int const time_step_class) const;
+
+  unsigned int
+  get_number_of_time_step_classes() const;
+
+  TimeStepClasses<Number> const &
+  get_time_step_classes() const;
+
   void
   apply_inverse_mass(VectorType & dst, VectorType const & src) const;
 
@@ -175,6 +208,9 @@ private:
   void
   setup_operators();
 
+  void
+  setup_time_step_classes();
+
   unsigned int
   get_dof_index_all() const;
 
@@ -235,6 +271,13 @@ private:
    */
   AffineConstraints<Number> constraint;
 
+  /*
+   * Local time stepping: time step class of all locally owned and ghost cells (indexed by the
+   * active cell index), where class c uses 2^c times the smallest time step size.
+   */
+  std::vector<unsigned int> time_step_class_of_cell;
+  unsigned int              n_time_step_classes;
+  TimeStepClasses<Number>   time_step_classes;
 
   std::string const dof_index_all    = "all_fields";
   std::string const dof_index_vector = "vector";
@@ -44,7 +44,10 @@ TimeIntExplRK<Number>::TimeIntExplRK(
                               param_in.end_time,
                               param_in.max_number_of_time_steps,
                               param_in.restart_data,
-                              false, // currently no adaptive time stepping implemented
+                              param_in.calculation_of_time_step_size ==
+                                TimeStepCalculation::ErrorControlled,
+                              param_in.calculation_of_time_step_size ==
+                                TimeStepCalculation::ErrorControlled,
                               mpi_comm_in,
                               print_wall_times_in),
     pde_operator(operator_in),
@@ -64,9 +67,17 @@ TimeIntExplRK<Number>::initialize_time_integrator()
   // initialize Runge-Kutta time integrator
   if(this->param.temporal_discretization == TemporalDiscretization::ExplRK)
   {
-    rk_time_integrator.reset(
-      new ExplicitRungeKuttaTimeIntegrator<Operator, VectorType>(param.order_time_integrator,
-                                                                 pde_operator));
+    if(param.use_local_time_stepping)
+    {
+      rk_time_integrator.reset(
+        new MultirateRungeKutta<Operator, VectorType>(param.order_time_integrator, pde_operator));
+    }
+    else
+    {
+      rk_time_integrator.reset(
+        new ExplicitRungeKuttaTimeIntegrator<Operator, VectorType>(param.order_time_integrator,
+                                                                   pde_operator));
+    }
   }
   else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK3Stage4Reg2C)
   {
@@ -97,6 +108,12 @@ TimeIntExplRK<Number>::initialize_time_integrator()
     rk_time_integrator.reset(
       new SSPRK<Operator, VectorType>(pde_operator, param.order_time_integrator, param.stages));
   }
+
+  if(this->error_control)
+  {
+    AssertThrow(rk_time_integrator->has_embedded_error_estimate(),
+                ExcMessage("The time integrator does not provide an embedded error estimate."));
+  }
 }
 
 /*
@@ -120,6 +137,20 @@ TimeIntExplRK<Number>::initialize_solution()
   pde_operator->prescribe_initial_conditions(this->solution_n, this->time);
 }
 
+template<typename Number>
+void
+TimeIntExplRK<Number>::write_restart_vectors(RestartArchiveOut & archive) const
+{
+  pde_operator->serialize_restart_vector(archive, this->solution_n);
+}
+
+template<typename Number>
+void
+TimeIntExplRK<Number>::read_restart_vectors(RestartArchiveIn & archive)
+{
+  pde_operator->deserialize_restart_vector(archive, this->solution_n);
+}
+
 /*
  *  calculate time step size
  */
@@ -154,12 +185,19 @@ TimeIntExplRK<Number>::calculate_time_step_size()
     this->time_step = calculate_time_step_cfl_global(
       cfl_number, acoustic_wave_speed, h_min, degree, param.exponent_fe_degree_cfl);
 
+    // local time stepping: the time step size refers to the coarsest time step class
+    unsigned int const n_classes =
+      param.use_local_time_stepping ? pde_operator->get_number_of_time_step_classes() : 1;
+    this->time_step *= std::pow(2.0, n_classes - 1);
+
     this->time_step =
       adjust_time_step_to_hit_end_time(this->start_time, this->end_time, this->time_step);
 
     print_parameter(this->pcout, "U_max", param.max_velocity);
     print_parameter(this->pcout, "speed of sound", speed_of_sound);
     print_parameter(this->pcout, "CFL", cfl_number);
+    if(param.use_local_time_stepping)
+      print_parameter(this->pcout, "Number of time step classes", n_classes);
     print_parameter(this->pcout, "Time step size (convection)", this->time_step);
   }
   else if(param.calculation_of_time_step_size == TimeStepCalculation::Diffusion)
@@ -226,6 +264,14 @@ TimeIntExplRK<Number>::calculate_time_step_size()
 
     print_parameter(this->pcout, "Time step size (combined)", this->time_step);
   }
+  else if(param.calculation_of_time_step_size == TimeStepCalculation::ErrorControlled)
+  {
+    this->time_step = calculate_const_time_step(param.time_step_size, refine_steps_time);
+
+    this->time_step_error_control = this->time_step;
+
+    print_parameter(this->pcout, "Initial time step size", this->time_step);
+  }
   else
   {
     AssertThrow(false, ExcMessage("Specified type of time step calculation is not implemented."));
@@ -236,9 +282,11 @@ template<typename Number>
 double
 TimeIntExplRK<Number>::recalculate_time_step_size() const
 {
-  AssertThrow(false, ExcMessage("Currently no adaptive time stepping implemented."));
+  AssertThrow(param.calculation_of_time_step_size == TimeStepCalculation::ErrorControlled,
+              ExcMessage(
+                "Adaptive time step is not implemented for this type of time step calculation."));
 
-  return 1.0;
+  return this->time_step_error_control;
 }
 
 template<typename Number>
@@ -279,10 +327,23 @@ TimeIntExplRK<Number>::solve_timestep()
   Timer timer;
   timer.restart();
 
-  rk_time_integrator->solve_timestep(this->solution_np,
-                                     this->solution_n,
-                                     this->time,
-                                     this->time_step);
+  if(this->error_control)
+  {
+    this->solve_timestep_error_controlled(
+      [&](VectorType & dst, VectorType & src, VectorType & error) {
+        rk_time_integrator->solve_timestep_with_error_estimate(
+          dst, src, this->time, this->time_step, error);
+      },
+      rk_time_integrator->get_order(),
+      param.error_control_data);
+  }
+  else
+  {
+    rk_time_integrator->solve_timestep(this->solution_np,
+                                       this->solution_n,
+                                       this->time,
+                                       this->time_step);
+  }
 
   if(print_solver_info() && this->print_wall_times)
   {
@@ -290,6 +351,12 @@ TimeIntExplRK<Number>::solve_timestep()
     print_wall_time(this->pcout, timer.wall_time());
   }
 
+  if(print_solver_info() && this->error_control)
+  {
+    print_parameter(this->pcout, "Rejected time steps", this->n_rejected_steps);
+    print_parameter(this->pcout, "Time step size (next)", this->time_step_error_control);
+  }
+
   this->timer_tree->insert({"Timeloop", "Solve-explicit"}, timer.wall_time());
 }
 
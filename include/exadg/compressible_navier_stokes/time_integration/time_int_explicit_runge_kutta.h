@@ -28,6 +28,7 @@
 
 // ExaDG
 #include <exadg/time_integration/explicit_runge_kutta.h>
+#include <exadg/time_integration/multirate_runge_kutta.h>
 #include <exadg/time_integration/ssp_runge_kutta.h>
 #include <exadg/time_integration/time_int_explicit_runge_kutta_base.h>
 
@@ -77,6 +78,12 @@ private:
   void
   initialize_solution();
 
+  void
+  write_restart_vectors(RestartArchiveOut & archive) const;
+
+  void
+  read_restart_vectors(RestartArchiveIn & archive);
+
   void
   detect_instabilities() const;
 
@@ -121,6 +121,9 @@ enum_to_string(TimeStepCalculation const enum_type)
     case TimeStepCalculation::CFLAndDiffusion:
       string_type = "CFLAndDiffusion";
       break;
+    case TimeStepCalculation::ErrorControlled:
+      string_type = "ErrorControlled";
+      break;
     default:
       AssertThrow(false, ExcMessage("Not implemented."));
       break;
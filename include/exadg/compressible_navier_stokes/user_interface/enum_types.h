@@ -107,7 +107,8 @@ enum class TimeStepCalculation
   UserSpecified,
   CFL,
   Diffusion,
-  CFLAndDiffusion
+  CFLAndDiffusion,
+  ErrorControlled
 };
 
 std::string
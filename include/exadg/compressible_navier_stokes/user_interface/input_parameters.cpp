@@ -54,12 +54,15 @@ InputParameters::InputParameters()
     stages(1),
     calculation_of_time_step_size(TimeStepCalculation::Undefined),
     time_step_size(-1.),
+    error_control_data(ErrorControlData()),
     max_number_of_time_steps(std::numeric_limits<unsigned int>::max()),
     max_velocity(-1.),
     cfl_number(-1.),
     diffusion_number(-1.),
     exponent_fe_degree_cfl(2.0),
     exponent_fe_degree_viscous(4.0),
+    use_local_time_stepping(false),
+    max_number_of_time_step_classes(4),
     // restart
     restarted_simulation(false),
     restart_data(RestartData()),
@@ -78,7 +81,8 @@ InputParameters::InputParameters()
 
     // NUMERICAL PARAMETERS
     detect_instabilities(true),
-    use_combined_operator(false)
+    use_combined_operator(false),
+    use_dof_renumbering(false)
 {
 }
 
@@ -100,9 +104,20 @@ InputParameters::check_input_parameters()
   AssertThrow(calculation_of_time_step_size != TimeStepCalculation::Undefined,
               ExcMessage("parameter must be defined"));
 
-  if(calculation_of_time_step_size == TimeStepCalculation::UserSpecified)
+  if(calculation_of_time_step_size == TimeStepCalculation::UserSpecified ||
+     calculation_of_time_step_size == TimeStepCalculation::ErrorControlled)
     AssertThrow(time_step_size > 0.0, ExcMessage("parameter must be defined"));
 
+  if(calculation_of_time_step_size == TimeStepCalculation::ErrorControlled)
+  {
+    AssertThrow(temporal_discretization == TemporalDiscretization::ExplRK3Stage4Reg2C ||
+                  temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg2C ||
+                  temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg3C ||
+                  temporal_discretization == TemporalDiscretization::ExplRK5Stage9Reg2S,
+                ExcMessage("TimeStepCalculation::ErrorControlled requires a low-storage "
+                           "Runge-Kutta scheme with embedded error estimator."));
+  }
+
   if(temporal_discretization == TemporalDiscretization::ExplRK)
   {
     AssertThrow(order_time_integrator >= 1 && order_time_integrator <= 4,
@@ -114,6 +129,16 @@ InputParameters::check_input_parameters()
     AssertThrow(stages >= 1, ExcMessage("Specify number of RK stages!"));
   }
 
+  if(use_local_time_stepping)
+  {
+    AssertThrow(temporal_discretization == TemporalDiscretization::ExplRK,
+                ExcMessage("Local time stepping is only implemented for ExplRK."));
+    AssertThrow(calculation_of_time_step_size == TimeStepCalculation::CFL,
+                ExcMessage("Local time stepping requires TimeStepCalculation::CFL."));
+    AssertThrow(max_number_of_time_step_classes >= 1,
+                ExcMessage("Invalid parameter max_number_of_time_step_classes."));
+  }
+
   if(calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion)
   {
     AssertThrow(max_velocity >= 0.0, ExcMessage("Invalid parameter max_velocity."));
@@ -209,9 +234,16 @@ InputParameters::print_parameters_temporal_discretization(ConditionalOStream & p
                   "Calculation of time step size",
                   enum_to_string(calculation_of_time_step_size));
 
+  if(calculation_of_time_step_size == TimeStepCalculation::ErrorControlled)
+    error_control_data.print(pcout);
+
   // maximum number of time steps
   print_parameter(pcout, "Maximum number of time steps", max_number_of_time_steps);
 
+  print_parameter(pcout, "Local time stepping", use_local_time_stepping);
+  if(use_local_time_stepping)
+    print_parameter(pcout, "Maximum number of time step classes", max_number_of_time_step_classes);
+
 
   // here we do not print quantities such as cfl_number, diffusion_number, time_step_size
   // because this is done by the time integration scheme (or the functions that
@@ -255,6 +287,7 @@ InputParameters::print_parameters_numerical_parameters(ConditionalOStream & pcou
 
   print_parameter(pcout, "Detect instabilities", detect_instabilities);
   print_parameter(pcout, "Use combined operator", use_combined_operator);
+  print_parameter(pcout, "Use DoF renumbering", use_dof_renumbering);
 }
 
 } // namespace CompNS
@@ -23,6 +23,7 @@
 
 #include <exadg/compressible_navier_stokes/user_interface/enum_types.h>
 #include <exadg/grid/enum_types.h>
+#include <exadg/time_integration/error_control_data.h>
 #include <exadg/time_integration/restart_data.h>
 #include <exadg/time_integration/solver_info_data.h>
 #include <exadg/utilities/print_functions.h>
@@ -129,8 +130,12 @@ public:
   // user specified time step size:  note that this time_step_size is the first
   // in a series of time_step_size's when performing temporal convergence tests,
   // i.e., delta_t = time_step_size, time_step_size/2, ...
+  // In case of TimeStepCalculation::ErrorControlled, this is the initial time step size.
   double time_step_size;
 
+  // parameters of the time step size control for TimeStepCalculation::ErrorControlled
+  ErrorControlData error_control_data;
+
   // maximum number of time steps
   unsigned int max_number_of_time_steps;
 
@@ -150,6 +155,17 @@ public:
   // exponent of fe_degree used in the calculation of the diffusion time step size
   double exponent_fe_degree_viscous;
 
+  // Local time stepping: cells are grouped into time step classes according to their local CFL
+  // time step size (element length and wave speed of the initial solution), where class c is
+  // advanced with 2^c times the time step size of the smallest class (only for
+  // TemporalDiscretization::ExplRK and TimeStepCalculation::CFL). The coupling of the classes is
+  // second-order accurate in time, see MultirateRungeKutta.
+  bool use_local_time_stepping;
+
+  // maximum number of time step classes, i.e., time step sizes differ at most by a factor of
+  // 2^(max_number_of_time_step_classes - 1)
+  unsigned int max_number_of_time_step_classes;
+
   // set this variable to true to start the simulation from restart files
   bool restarted_simulation;
 
@@ -190,6 +206,10 @@ public:
   // use combined operator for viscous term and convective term in order to improve run
   // time
   bool use_combined_operator;
+
+  // Renumber the degrees of freedom for data locality in the matrix-free loops, see
+  // renumber_dofs_for_data_locality() for details and restrictions.
+  bool use_dof_renumbering;
 };
 
 } // namespace CompNS
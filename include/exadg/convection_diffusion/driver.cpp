@@ -135,6 +135,8 @@ Driver<dim, Number>::setup(std::shared_ptr<ApplicationBase<dim, Number>> app,
     Categorization::do_cell_based_loops(*tria, matrix_free_data->data);
   }
   conv_diff_operator->fill_matrix_free_data(*matrix_free_data);
+  if(param.use_dof_renumbering)
+    conv_diff_operator->renumber_dofs(*matrix_free_data);
 
   matrix_free.reset(new MatrixFree<dim, Number>());
   matrix_free->reinit(mesh->get_mapping(),
@@ -27,6 +27,7 @@
 
 // ExaDG
 #include <exadg/time_integration/interpolate.h>
+#include <exadg/time_integration/restart.h>
 
 namespace ExaDG
 {
@@ -93,6 +94,13 @@ public:
   virtual void
   prescribe_initial_conditions(VectorType & src, double const evaluation_time) const = 0;
 
+  // restart: partition-independent serialization of the solution vector
+  virtual void
+  serialize_restart_vector(RestartArchiveOut & archive, VectorType const & src) const = 0;
+
+  virtual void
+  deserialize_restart_vector(RestartArchiveIn & archive, VectorType & dst) const = 0;
+
   // time step calculation: CFL condition (has to loop over all cells and evaluate quantities
   // related to spatial discretization (which is why this function is part of this interface
   // class)
@@ -27,6 +27,7 @@
 #include <exadg/convection_diffusion/preconditioners/multigrid_preconditioner.h>
 #include <exadg/convection_diffusion/spatial_discretization/operator.h>
 #include <exadg/convection_diffusion/spatial_discretization/project_velocity.h>
+#include <exadg/matrix_free/dof_renumbering.h>
 #include <exadg/solvers_and_preconditioners/preconditioner/inverse_mass_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioner/jacobi_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
@@ -312,6 +313,19 @@ Operator<dim, Number>::distribute_dofs()
   print_parameter(pcout, "number of dofs (total)", dof_handler.n_dofs());
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::renumber_dofs(MatrixFreeData<dim, Number> const & matrix_free_data)
+{
+  // there are no constraints for DG discretizations
+  renumber_dofs_for_data_locality(dof_handler, affine_constraints, matrix_free_data.data);
+
+  if(needs_own_dof_handler_velocity())
+    renumber_dofs_for_data_locality(*dof_handler_velocity,
+                                    affine_constraints,
+                                    matrix_free_data.data);
+}
+
 template<int dim, typename Number>
 std::string
 Operator<dim, Number>::get_dof_name() const
@@ -477,6 +491,9 @@ Operator<dim, Number>::initialize_preconditioner()
 
     CombinedOperatorData<dim> const & data = combined_operator.get_data();
 
+    if(param.use_dof_renumbering)
+      mg_preconditioner->set_dof_numbering_fine_level(dof_handler);
+
     mg_preconditioner->initialize(mg_data,
                                   tria,
                                   fe,
@@ -620,6 +637,22 @@ Operator<dim, Number>::prescribe_initial_conditions(VectorType & src, double con
   src = src_double;
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::serialize_restart_vector(RestartArchiveOut & archive,
+                                                VectorType const &  src) const
+{
+  write_restart_vector(archive, src, dof_handler);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::deserialize_restart_vector(RestartArchiveIn & archive,
+                                                  VectorType &       dst) const
+{
+  read_restart_vector(archive, dst, dof_handler);
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::evaluate_explicit_time_int(VectorType &       dst,
@@ -72,6 +72,14 @@ public:
   void
   fill_matrix_free_data(MatrixFreeData<dim, Number> & matrix_free_data) const;
 
+  /*
+   * Renumbers the degrees of freedom for data locality in the matrix-free loops set up with
+   * matrix_free_data (parameter use_dof_renumbering). Has to be called after
+   * fill_matrix_free_data() and before MatrixFree is initialized.
+   */
+  void
+  renumber_dofs(MatrixFreeData<dim, Number> const & matrix_free_data);
+
   /*
    * Setup function. Initializes basic finite element components, matrix-free object, and basic
    * operators. This function does not perform the setup related to the solution of linear systems
@@ -119,6 +127,15 @@ public:
   void
   prescribe_initial_conditions(VectorType & src, double const evaluation_time) const;
 
+  /*
+   * Restart: partition-independent serialization of the solution vector.
+   */
+  void
+  serialize_restart_vector(RestartArchiveOut & archive, VectorType const & src) const;
+
+  void
+  deserialize_restart_vector(RestartArchiveIn & archive, VectorType & dst) const;
+
   /*
    * This function is used in case of explicit time integration:
    *
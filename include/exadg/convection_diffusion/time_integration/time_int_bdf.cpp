@@ -499,11 +499,11 @@ TimeIntBDF<dim, Number>::print_solver_info() const
 
 template<int dim, typename Number>
 void
-TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive & ia)
+TimeIntBDF<dim, Number>::read_restart_vectors(RestartArchiveIn & archive)
 {
   for(unsigned int i = 0; i < this->order; i++)
   {
-    ia >> solution[i];
+    read_restart_vector(archive, solution[i], pde_operator->get_dof_handler());
   }
 
   if(param.convective_problem() &&
@@ -513,7 +513,7 @@ TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive &
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        ia >> vec_convective_term[i];
+        read_restart_vector(archive, vec_convective_term[i], pde_operator->get_dof_handler());
       }
     }
   }
@@ -522,18 +522,20 @@ TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive &
   {
     for(unsigned int i = 0; i < vec_grid_coordinates.size(); i++)
     {
-      ia >> vec_grid_coordinates[i];
+      read_restart_vector(archive,
+                          vec_grid_coordinates[i],
+                          pde_operator->get_dof_handler_velocity());
     }
   }
 }
 
 template<int dim, typename Number>
 void
-TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive & oa) const
+TimeIntBDF<dim, Number>::write_restart_vectors(RestartArchiveOut & archive) const
 {
   for(unsigned int i = 0; i < this->order; i++)
   {
-    oa << solution[i];
+    write_restart_vector(archive, solution[i], pde_operator->get_dof_handler());
   }
 
   if(param.convective_problem() &&
@@ -543,7 +545,7 @@ TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive &
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        oa << vec_convective_term[i];
+        write_restart_vector(archive, vec_convective_term[i], pde_operator->get_dof_handler());
       }
     }
   }
@@ -552,7 +554,9 @@ TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive &
   {
     for(unsigned int i = 0; i < vec_grid_coordinates.size(); i++)
     {
-      oa << vec_grid_coordinates[i];
+      write_restart_vector(archive,
+                           vec_grid_coordinates[i],
+                           pde_operator->get_dof_handler_velocity());
     }
   }
 }
@@ -709,7 +713,10 @@ TimeIntBDF<dim, Number>::calculate_sum_alphai_ui_oif_substepping(VectorType & su
   }
 
   // call function implemented in base class for the actual OIF sub-stepping
-  TimeIntBDFBase<Number>::calculate_sum_alphai_ui_oif_substepping(sum_alphai_ui, cfl, cfl_oif);
+  if(param.oif_single_sweep)
+    this->calculate_sum_alphai_ui_oif_substepping_single_sweep(sum_alphai_ui, cfl, cfl_oif);
+  else
+    TimeIntBDFBase<Number>::calculate_sum_alphai_ui_oif_substepping(sum_alphai_ui, cfl, cfl_oif);
 }
 
 template<int dim, typename Number>
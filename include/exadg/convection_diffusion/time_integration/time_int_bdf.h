@@ -143,10 +143,10 @@ private:
   print_solver_info() const;
 
   void
-  read_restart_vectors(boost::archive::binary_iarchive & ia);
+  read_restart_vectors(RestartArchiveIn & archive);
 
   void
-  write_restart_vectors(boost::archive::binary_oarchive & oa) const;
+  write_restart_vectors(RestartArchiveOut & archive) const;
 
   void
   postprocessing() const;
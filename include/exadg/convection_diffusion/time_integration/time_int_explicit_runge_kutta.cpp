@@ -46,6 +46,8 @@ TimeIntExplRK<Number>::TimeIntExplRK(
                               param_in.max_number_of_time_steps,
                               param_in.restart_data,
                               param_in.adaptive_time_stepping,
+                              param_in.calculation_of_time_step_size ==
+                                TimeStepCalculation::ErrorControlled,
                               mpi_comm_in,
                               print_wall_times_in),
     pde_operator(operator_in),
@@ -90,6 +92,20 @@ TimeIntExplRK<Number>::initialize_solution()
   pde_operator->prescribe_initial_conditions(this->solution_n, this->time);
 }
 
+template<typename Number>
+void
+TimeIntExplRK<Number>::write_restart_vectors(RestartArchiveOut & archive) const
+{
+  pde_operator->serialize_restart_vector(archive, this->solution_n);
+}
+
+template<typename Number>
+void
+TimeIntExplRK<Number>::read_restart_vectors(RestartArchiveIn & archive)
+{
+  pde_operator->deserialize_restart_vector(archive, this->solution_n);
+}
+
 template<typename Number>
 void
 TimeIntExplRK<Number>::calculate_time_step_size()
@@ -232,6 +248,17 @@ TimeIntExplRK<Number>::calculate_time_step_size()
     print_parameter(this->pcout, "C_eff", param.c_eff / std::pow(2, refine_steps_time));
     print_parameter(this->pcout, "Time step size", this->time_step);
   }
+  else if(param.calculation_of_time_step_size == TimeStepCalculation::ErrorControlled)
+  {
+    this->time_step = calculate_const_time_step(param.time_step_size, refine_steps_time);
+
+    this->time_step_error_control = this->time_step;
+
+    this->pcout << std::endl
+                << "Calculation of time step size (error control):" << std::endl
+                << std::endl;
+    print_parameter(this->pcout, "Initial time step size", this->time_step);
+  }
   else
   {
     AssertThrow(false, ExcMessage("Specified type of time step calculation is not implemented."));
@@ -243,10 +270,15 @@ double
 TimeIntExplRK<Number>::recalculate_time_step_size() const
 {
   AssertThrow(param.calculation_of_time_step_size == TimeStepCalculation::CFL ||
-                param.calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion,
+                param.calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion ||
+                param.calculation_of_time_step_size == TimeStepCalculation::ErrorControlled,
               ExcMessage(
                 "Adaptive time step is not implemented for this type of time step calculation."));
 
+  // the time step size has already been computed by the error controller
+  if(param.calculation_of_time_step_size == TimeStepCalculation::ErrorControlled)
+    return std::min(this->time_step_error_control, param.time_step_size_max);
+
   double new_time_step_size = std::numeric_limits<double>::max();
   if(param.analytical_velocity_field)
   {
@@ -352,6 +384,12 @@ TimeIntExplRK<Number>::initialize_time_integrator()
   {
     AssertThrow(false, ExcMessage("Not implemented."));
   }
+
+  if(this->error_control)
+  {
+    AssertThrow(rk_time_integrator->has_embedded_error_estimate(),
+                ExcMessage("The time integrator does not provide an embedded error estimate."));
+  }
 }
 
 template<typename Number>
@@ -378,16 +416,32 @@ TimeIntExplRK<Number>::solve_timestep()
     }
   }
 
-  rk_time_integrator->solve_timestep(this->solution_np,
-                                     this->solution_n,
-                                     this->time,
-                                     this->time_step);
+  if(this->error_control)
+  {
+    this->solve_timestep_error_controlled(
+      [&](VectorType & dst, VectorType & src, VectorType & error) {
+        rk_time_integrator->solve_timestep_with_error_estimate(
+          dst, src, this->time, this->time_step, error);
+      },
+      rk_time_integrator->get_order(),
+      param.error_control_data);
+  }
+  else
+  {
+    rk_time_integrator->solve_timestep(this->solution_np,
+                                       this->solution_n,
+                                       this->time,
+                                       this->time_step);
+  }
 
   if(print_solver_info())
   {
     this->pcout << std::endl << "Solve scalar convection-diffusion equation explicitly:";
     if(this->print_wall_times)
       print_wall_time(this->pcout, timer.wall_time());
+
+    if(this->error_control)
+      print_parameter(this->pcout, "Rejected time steps", this->n_rejected_steps);
   }
 
   this->timer_tree->insert({"Timeloop", "Solve-explicit"}, timer.wall_time());
@@ -78,6 +78,12 @@ private:
   void
   initialize_solution();
 
+  void
+  write_restart_vectors(RestartArchiveOut & archive) const;
+
+  void
+  read_restart_vectors(RestartArchiveIn & archive);
+
   void
   postprocessing() const;
 
@@ -250,6 +250,9 @@ enum_to_string(TimeStepCalculation const enum_type)
     case TimeStepCalculation::MaxEfficiency:
       string_type = "MaxEfficiency";
       break;
+    case TimeStepCalculation::ErrorControlled:
+      string_type = "ErrorControlled";
+      break;
     default:
       AssertThrow(false, ExcMessage("Not implemented."));
       break;
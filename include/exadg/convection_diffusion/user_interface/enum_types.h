@@ -168,7 +168,8 @@ enum class TimeStepCalculation
   CFL,
   Diffusion,
   CFLAndDiffusion,
-  MaxEfficiency
+  MaxEfficiency,
+  ErrorControlled
 };
 
 std::string
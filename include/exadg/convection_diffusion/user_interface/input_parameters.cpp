@@ -55,11 +55,13 @@ InputParameters::InputParameters()
     time_step_size_max(std::numeric_limits<double>::max()),
     adaptive_time_stepping_cfl_type(CFLConditionType::VelocityNorm),
     time_step_size(-1.),
+    error_control_data(ErrorControlData()),
     max_number_of_time_steps(std::numeric_limits<unsigned int>::max()),
     cfl(-1.),
     max_velocity(std::numeric_limits<double>::min()),
     time_integrator_oif(TimeIntegratorRK::Undefined),
     cfl_oif(-1.),
+    oif_single_sweep(false),
     diffusion_number(-1.),
     c_eff(-1.),
     exponent_fe_degree_convection(1.5),
@@ -89,6 +91,7 @@ InputParameters::InputParameters()
 
     // NUMERICAL PARAMETERS
     use_cell_based_face_loops(false),
+    use_dof_renumbering(false),
     use_combined_operator(true),
     store_analytical_velocity_in_dof_vector(false),
     use_overintegration(false)
@@ -182,9 +185,25 @@ InputParameters::check_input_parameters()
     AssertThrow(calculation_of_time_step_size != TimeStepCalculation::Undefined,
                 ExcMessage("parameter must be defined"));
 
-    if(calculation_of_time_step_size == TimeStepCalculation::UserSpecified)
+    if(calculation_of_time_step_size == TimeStepCalculation::UserSpecified ||
+       calculation_of_time_step_size == TimeStepCalculation::ErrorControlled)
       AssertThrow(time_step_size > 0.0, ExcMessage("parameter must be defined"));
 
+    if(calculation_of_time_step_size == TimeStepCalculation::ErrorControlled)
+    {
+      AssertThrow(temporal_discretization == TemporalDiscretization::ExplRK &&
+                    (time_integrator_rk == TimeIntegratorRK::ExplRK3Stage4Reg2C ||
+                     time_integrator_rk == TimeIntegratorRK::ExplRK4Stage5Reg2C ||
+                     time_integrator_rk == TimeIntegratorRK::ExplRK4Stage5Reg3C ||
+                     time_integrator_rk == TimeIntegratorRK::ExplRK5Stage9Reg2S),
+                  ExcMessage("TimeStepCalculation::ErrorControlled requires a low-storage "
+                             "Runge-Kutta scheme with embedded error estimator."));
+
+      AssertThrow(adaptive_time_stepping == true,
+                  ExcMessage("TimeStepCalculation::ErrorControlled requires adaptive time "
+                             "stepping."));
+    }
+
     if(calculation_of_time_step_size == TimeStepCalculation::MaxEfficiency)
       AssertThrow(c_eff > 0., ExcMessage("parameter must be defined"));
 
@@ -217,9 +236,10 @@ InputParameters::check_input_parameters()
     if(adaptive_time_stepping == true)
     {
       AssertThrow(calculation_of_time_step_size == TimeStepCalculation::CFL ||
-                    calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion,
-                  ExcMessage(
-                    "Adaptive time stepping can only be used in combination with CFL condition."));
+                    calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion ||
+                    calculation_of_time_step_size == TimeStepCalculation::ErrorControlled,
+                  ExcMessage("Adaptive time stepping can only be used in combination with CFL "
+                             "condition or error control."));
     }
 
     if(temporal_discretization == TemporalDiscretization::ExplRK)
@@ -307,6 +327,14 @@ InputParameters::check_input_parameters()
                     ExcMessage(
                       "Invalid solver parameters. A purely diffusive problem is considered."));
       }
+
+      // the level DoFs of local smoothing can not be renumbered consistently with the active DoFs
+      if(use_dof_renumbering)
+      {
+        AssertThrow(multigrid_data.use_global_coarsening,
+                    ExcMessage(
+                      "DoF renumbering requires multigrid with use_global_coarsening = true."));
+      }
     }
   }
   else
@@ -473,6 +501,7 @@ InputParameters::print_parameters_temporal_discretization(ConditionalOStream & p
       print_parameter(pcout,
                       "Time integrator for OIF splitting",
                       enum_to_string(time_integrator_oif));
+      print_parameter(pcout, "Single-sweep OIF substepping", oif_single_sweep);
     }
   }
 
@@ -490,9 +519,16 @@ InputParameters::print_parameters_temporal_discretization(ConditionalOStream & p
 
     print_parameter(pcout, "Maximum allowable time step size", time_step_size_max);
 
-    print_parameter(pcout,
-                    "Type of CFL condition",
-                    enum_to_string(adaptive_time_stepping_cfl_type));
+    if(calculation_of_time_step_size == TimeStepCalculation::ErrorControlled)
+    {
+      error_control_data.print(pcout);
+    }
+    else
+    {
+      print_parameter(pcout,
+                      "Type of CFL condition",
+                      enum_to_string(adaptive_time_stepping_cfl_type));
+    }
   }
 
 
@@ -578,6 +614,7 @@ InputParameters::print_parameters_numerical_parameters(ConditionalOStream & pcou
   pcout << std::endl << "Numerical parameters:" << std::endl;
 
   print_parameter(pcout, "Use cell-based face loops", use_cell_based_face_loops);
+  print_parameter(pcout, "Use DoF renumbering", use_dof_renumbering);
 
   if(temporal_discretization == TemporalDiscretization::ExplRK)
     print_parameter(pcout, "Use combined operator", use_combined_operator);
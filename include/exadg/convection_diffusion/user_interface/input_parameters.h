@@ -33,6 +33,7 @@
 #include <exadg/solvers_and_preconditioners/solvers/enum_types.h>
 #include <exadg/solvers_and_preconditioners/solvers/solver_data.h>
 #include <exadg/time_integration/enum_types.h>
+#include <exadg/time_integration/error_control_data.h>
 #include <exadg/time_integration/restart_data.h>
 #include <exadg/time_integration/solver_info_data.h>
 
@@ -180,8 +181,13 @@ public:
   // user specified time step size:  note that this time_step_size is the first
   // in a series of time_step_size's when performing temporal convergence tests,
   // i.e., delta_t = time_step_size, time_step_size/2, ...
+  // In case of TimeStepCalculation::ErrorControlled, this is the initial time step size.
   double time_step_size;
 
+  // parameters of the time step size control for TimeStepCalculation::ErrorControlled, which is
+  // available for the low-storage explicit Runge-Kutta schemes with embedded error estimator
+  ErrorControlData error_control_data;
+
   // maximum number of time steps
   unsigned int max_number_of_time_steps;
 
@@ -200,6 +206,9 @@ public:
   // critical time step size arising from the CFL restriction)
   double cfl_oif;
 
+  // integrate all OIF history terms in a single sweep (linear instead of quadratic cost in order)
+  bool oif_single_sweep;
+
   // diffusion number (relevant number for limitation of time step size
   // when treating the diffusive term explicitly)
   double diffusion_number;
@@ -302,6 +311,10 @@ public:
   // can be changed to such an algorithm (cell_based_face_loops).
   bool use_cell_based_face_loops;
 
+  // Renumber the degrees of freedom for data locality in the matrix-free loops, see
+  // renumber_dofs_for_data_locality() for details and restrictions.
+  bool use_dof_renumbering;
+
   // Evaluate convective term and diffusive term at once instead of implementing each
   // operator separately and subsequently looping over all operators. This parameter is
   // only relevant in case of fully explicit time stepping. In case of semi-implicit or
@@ -182,6 +182,8 @@ Driver<dim, Number>::setup(std::shared_ptr<ApplicationBase<dim, Number>> app,
     structure_matrix_free_data->data.tasks_parallel_scheme =
       MatrixFree<dim, Number>::AdditionalData::partition_partition;
     structure_operator->fill_matrix_free_data(*structure_matrix_free_data);
+    if(structure_param.use_dof_renumbering)
+      structure_operator->renumber_dofs(*structure_matrix_free_data);
 
     structure_matrix_free.reset(new MatrixFree<dim, Number>());
     structure_matrix_free->reinit(*structure_mapping,
@@ -352,10 +354,14 @@ Driver<dim, Number>::setup(std::shared_ptr<ApplicationBase<dim, Number>> app,
         Categorization::do_cell_based_loops(*tria, ale_matrix_free_data->data);
       }
       ale_poisson_operator->fill_matrix_free_data(*ale_matrix_free_data);
+      if(ale_poisson_param.use_dof_renumbering)
+        ale_poisson_operator->renumber_dofs(*ale_matrix_free_data);
     }
     else if(fluid_param.mesh_movement_type == IncNS::MeshMovementType::Elasticity)
     {
       ale_elasticity_operator->fill_matrix_free_data(*ale_matrix_free_data);
+      if(ale_elasticity_param.use_dof_renumbering)
+        ale_elasticity_operator->renumber_dofs(*ale_matrix_free_data);
     }
     else
     {
@@ -470,6 +476,8 @@ Driver<dim, Number>::setup(std::shared_ptr<ApplicationBase<dim, Number>> app,
       Categorization::do_cell_based_loops(*tria, fluid_matrix_free_data->data);
     }
     fluid_operator->fill_matrix_free_data(*fluid_matrix_free_data);
+    if(fluid_param.use_dof_renumbering)
+      fluid_operator->renumber_dofs(*fluid_matrix_free_data);
 
     fluid_matrix_free.reset(new MatrixFree<dim, Number>());
     fluid_matrix_free->reinit(fluid_mesh->get_mapping(),
@@ -0,0 +1,211 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_GRID_GRID_CACHE_H_
+#define INCLUDE_EXADG_GRID_GRID_CACHE_H_
+
+// C/C++
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/config.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/revision.h>
+#include <deal.II/base/utilities.h>
+#include <deal.II/distributed/fully_distributed_tria.h>
+#include <deal.II/grid/tria_description.h>
+
+// ExaDG
+#include <exadg/configuration/config.h>
+
+namespace ExaDG
+{
+using namespace dealii;
+
+/*
+ * Utility functions to cache the setup of triangulations on disk. The cache files are identified
+ * by a hash of a key string, which has to contain all parameters that influence the grid (e.g. the
+ * geometry parameters and the number of refinements). Subsequent runs (and restarts) with the same
+ * key load the cached data instead of generating (and partitioning) the grid again. The versions
+ * of deal.II and ExaDG are added to the key, since the format of the cached data and the grid
+ * generation functions may change between versions. The key is stored in the cache files and
+ * compared when loading, so that a hash collision results in generating the grid again. The
+ * caching is disabled if the cache directory is empty.
+ *
+ * Note that the grid generation functions are not called if the cached data is used. Hence, data
+ * that is set up by these functions in addition to the triangulation (e.g. periodic faces) has to
+ * be set up independently. Manifolds have to be attached to the triangulation after loading.
+ */
+namespace GridCache
+{
+inline std::string
+get_filename(std::string const & cache_directory, std::string const & key)
+{
+  std::ostringstream filename;
+  filename << cache_directory << "/grid_" << std::hex << std::hash<std::string>()(key);
+
+  return filename.str();
+}
+
+inline std::string
+get_version_key()
+{
+  return std::string("_dealii_") + DEAL_II_PACKAGE_VERSION + "_" + DEAL_II_GIT_SHORTREV +
+         "_exadg_" + EXADG_GIT_SHORTREV;
+}
+
+/*
+ * Writes the key followed by the data to filename. The file is written to a temporary file first
+ * which is then renamed, so that other runs never read an incomplete cache file. Returns false if
+ * the file could not be written. The error is not thrown here since this function is called by
+ * each process individually, see create_fully_distributed_triangulation().
+ */
+inline bool
+write_cache_file(std::string const &       filename,
+                 std::string const &       key,
+                 std::vector<char> const & data)
+{
+  std::string const filename_tmp = filename + ".tmp";
+
+  bool success = false;
+
+  {
+    std::ofstream stream(filename_tmp.c_str(), std::ios::binary);
+
+    std::uint64_t const key_size = key.size();
+    stream.write(reinterpret_cast<char const *>(&key_size), sizeof(key_size));
+    stream.write(key.data(), key.size());
+    stream.write(data.data(), data.size());
+    stream.flush();
+
+    success = stream.good();
+  }
+
+  if(success)
+    success = (std::rename(filename_tmp.c_str(), filename.c_str()) == 0);
+
+  if(not success)
+    std::remove(filename_tmp.c_str());
+
+  return success;
+}
+
+/*
+ * Reads the data stored by write_cache_file(). Returns false if the file does not exist or if the
+ * file has been written for a different key (hash collision of the file names).
+ */
+inline bool
+read_cache_file(std::string const & filename, std::string const & key, std::vector<char> & data)
+{
+  std::ifstream stream(filename.c_str(), std::ios::binary);
+  if(not stream)
+    return false;
+
+  std::uint64_t key_size = 0;
+  stream.read(reinterpret_cast<char *>(&key_size), sizeof(key_size));
+  if(not stream || key_size != key.size())
+    return false;
+
+  std::string key_file(key_size, '\0');
+  stream.read(&key_file[0], key_size);
+  if(not stream || key_file != key)
+    return false;
+
+  data.assign((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+  return true;
+}
+
+/*
+ * Creates a fully distributed triangulation from the description obtained by
+ * TriangulationDescription::Utilities::create_description_from_triangulation_in_groups() with the
+ * given serial grid generator and partitioner. The description of each process is cached, i.e.,
+ * the cache is only valid for the same number of processes, which is therefore part of the key.
+ * This function has to be called by all processes of the communicator of the triangulation.
+ */
+template<int dim>
+void
+create_fully_distributed_triangulation(
+  parallel::fullydistributed::Triangulation<dim> &                   triangulation,
+  std::function<void(dealii::Triangulation<dim> &)> const &          serial_grid_generator,
+  std::function<void(dealii::Triangulation<dim> &, MPI_Comm const, unsigned int const)> const &
+                      serial_grid_partitioner,
+  unsigned int const  group_size,
+  std::string const & cache_directory,
+  std::string const & key)
+{
+  typedef TriangulationDescription::Description<dim, dim> Description;
+
+  MPI_Comm const     mpi_comm = triangulation.get_communicator();
+  unsigned int const n_ranks  = Utilities::MPI::n_mpi_processes(mpi_comm);
+  unsigned int const rank     = Utilities::MPI::this_mpi_process(mpi_comm);
+
+  std::string const key_ranks =
+    key + get_version_key() + "_ranks_" + Utilities::to_string(n_ranks);
+
+  std::string const filename = get_filename(cache_directory, key_ranks) + "." +
+                               Utilities::int_to_string(rank) + ".description";
+
+  std::vector<char> buffer;
+
+  // the cache may only be used if it is available on all processes
+  bool const use_cache =
+    not cache_directory.empty() &&
+    Utilities::MPI::min(read_cache_file(filename, key_ranks, buffer) ? 1 : 0, mpi_comm) == 1;
+
+  Description description;
+
+  if(use_cache)
+  {
+    description = Utilities::unpack<Description>(buffer, false);
+  }
+  else
+  {
+    description =
+      TriangulationDescription::Utilities::create_description_from_triangulation_in_groups<dim,
+                                                                                           dim>(
+        serial_grid_generator, serial_grid_partitioner, mpi_comm, group_size);
+
+    if(not cache_directory.empty())
+    {
+      bool const success =
+        write_cache_file(filename, key_ranks, Utilities::pack(description, false));
+
+      // all processes throw the exception to avoid a deadlock in subsequent collective calls
+      AssertThrow(Utilities::MPI::min(success ? 1 : 0, mpi_comm) == 1,
+                  ExcMessage("Could not write grid cache files to directory " + cache_directory +
+                             " on all processes."));
+    }
+  }
+
+  triangulation.create_triangulation(description);
+}
+
+} // namespace GridCache
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_GRID_GRID_CACHE_H_ */
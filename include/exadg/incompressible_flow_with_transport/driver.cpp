@@ -283,6 +283,12 @@ Driver<dim, Number>::setup(std::shared_ptr<ApplicationBase<dim, Number>> app,
   for(unsigned int i = 0; i < n_scalars; ++i)
     conv_diff_operator[i]->fill_matrix_free_data(*matrix_free_data);
 
+  if(fluid_param.use_dof_renumbering)
+    fluid_operator_base->renumber_dofs(*matrix_free_data);
+  for(unsigned int i = 0; i < n_scalars; ++i)
+    if(scalar_param[i].use_dof_renumbering)
+      conv_diff_operator[i]->renumber_dofs(*matrix_free_data);
+
   matrix_free.reset(new MatrixFree<dim, Number>());
   matrix_free->reinit(mesh->get_mapping(),
                       matrix_free_data->get_dof_handler_vector(),
@@ -19,6 +19,9 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <fstream>
+
 // likwid
 #ifdef LIKWID_PERFMON
 #  include <likwid.h>
@@ -143,6 +146,8 @@ Driver<dim, Number>::setup(std::shared_ptr<ApplicationBase<dim, Number>> app,
         Categorization::do_cell_based_loops(*tria, poisson_matrix_free_data->data);
       }
       poisson_operator->fill_matrix_free_data(*poisson_matrix_free_data);
+      if(poisson_param.use_dof_renumbering)
+        poisson_operator->renumber_dofs(*poisson_matrix_free_data);
 
       poisson_matrix_free.reset(new MatrixFree<dim, Number>());
       poisson_matrix_free->reinit(*mapping,
@@ -267,6 +272,8 @@ Driver<dim, Number>::setup(std::shared_ptr<ApplicationBase<dim, Number>> app,
     Categorization::do_cell_based_loops(*tria, matrix_free_data->data);
   }
   operator_base->fill_matrix_free_data(*matrix_free_data);
+  if(param.use_dof_renumbering)
+    operator_base->renumber_dofs(*matrix_free_data);
 
   matrix_free.reset(new MatrixFree<dim, Number>());
   matrix_free->reinit(mesh->get_mapping(),
@@ -743,6 +750,106 @@ Driver<dim, Number>::apply_operator(unsigned int const  degree,
   return std::tuple<unsigned int, types::global_dof_index, double>(fe_degree, dofs, throughput);
 }
 
+template<int dim, typename Number>
+std::tuple<unsigned int, types::global_dof_index, double>
+Driver<dim, Number>::measure_time_steps(unsigned int const  n_time_steps,
+                                        std::string const & summary_file,
+                                        bool const          is_test) const
+{
+  AssertThrow(param.problem_type == ProblemType::Unsteady &&
+                param.solver_type == SolverType::Unsteady && param.ale_formulation == false,
+              ExcMessage("Measuring the throughput of complete time steps is only implemented "
+                         "for unsteady problems on static meshes."));
+
+  pcout << std::endl << "Computing time steps ..." << std::endl;
+
+  MPI_Barrier(mpi_comm);
+
+  Timer timer;
+  timer.restart();
+
+#ifdef LIKWID_PERFMON
+  LIKWID_MARKER_START("time_steps");
+#endif
+
+  unsigned int n_steps = 0;
+  for(; n_steps < n_time_steps && not(time_integrator->finished()); ++n_steps)
+    time_integrator->advance_one_timestep();
+
+#ifdef LIKWID_PERFMON
+  LIKWID_MARKER_STOP("time_steps");
+#endif
+
+  MPI_Barrier(mpi_comm);
+  double const wall_time = Utilities::MPI::min_max_avg(timer.wall_time(), mpi_comm).avg;
+
+  AssertThrow(n_steps > 0, ExcMessage("No time step has been computed. Check end time."));
+
+  // throughput in DoFs * time steps / sec
+  types::global_dof_index const dofs =
+    operator_base->get_dof_handler_u().n_dofs() + operator_base->get_dof_handler_p().n_dofs();
+  unsigned int const fe_degree  = operator_base->get_polynomial_degree();
+  double const       throughput = (double)dofs * (double)n_steps / wall_time;
+
+  unsigned int const N_mpi_processes = Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  // wall times of sub-steps (average over processors) per time step
+  std::vector<std::pair<std::string, double>> sub_steps =
+    time_integrator->get_timings()->get_wall_times_of_direct_children();
+  for(auto & sub_step : sub_steps)
+    sub_step.second = Utilities::MPI::min_max_avg(sub_step.second, mpi_comm).avg / n_steps;
+
+  // average number of iterations
+  std::vector<std::string> names;
+  std::vector<double>      iterations;
+  time_integrator->get_iterations(names, iterations);
+
+  if(not(is_test))
+  {
+    // clang-format off
+    pcout << std::endl
+          << std::scientific << std::setprecision(4)
+          << "Time steps:                " << n_steps << std::endl
+          << "Wall time per time step:   " << wall_time / (double)n_steps << std::endl
+          << "DoFs*steps/sec:            " << throughput << std::endl
+          << "DoFs*steps/(sec*core):     " << throughput/(double)N_mpi_processes << std::endl;
+    // clang-format on
+
+    pcout << std::endl << "Wall times per time step:" << std::endl;
+    for(auto const & sub_step : sub_steps)
+      pcout << "  " << std::setw(26) << std::left << sub_step.first << sub_step.second << " s"
+            << std::endl;
+
+    pcout << std::endl << "Average number of iterations:" << std::endl;
+    print_list_of_iterations(pcout, names, iterations);
+
+    // append summary (one JSON object per line) to allow a comparison of different builds and
+    // hardware
+    if(Utilities::MPI::this_mpi_process(mpi_comm) == 0 && not(summary_file.empty()))
+    {
+      std::ofstream f(summary_file.c_str(), std::ios::app);
+
+      f << std::scientific << std::setprecision(6);
+      f << "{\"dim\": " << dim << ", \"precision\": \""
+        << (std::is_same<Number, float>::value ? "float" : "double") << "\", \"scheme\": \""
+        << enum_to_string(param.temporal_discretization) << "\", \"degree\": " << fe_degree
+        << ", \"dofs\": " << dofs << ", \"processes\": " << N_mpi_processes
+        << ", \"time_steps\": " << n_steps << ", \"wall_time\": " << wall_time
+        << ", \"dofs_steps_per_sec_per_core\": " << throughput / (double)N_mpi_processes
+        << ", \"wall_times_per_step\": {";
+      for(unsigned int i = 0; i < sub_steps.size(); ++i)
+        f << (i > 0 ? ", " : "") << "\"" << sub_steps[i].first << "\": " << sub_steps[i].second;
+      f << "}, \"iterations\": {";
+      for(unsigned int i = 0; i < names.size(); ++i)
+        f << (i > 0 ? ", " : "") << "\"" << names[i] << "\": " << iterations[i];
+      f << "}}" << std::endl;
+    }
+  }
+
+  pcout << std::endl << " ... done." << std::endl << std::endl;
+
+  return std::tuple<unsigned int, types::global_dof_index, double>(fe_degree, dofs, throughput);
+}
 
 template class Driver<2, float>;
 template class Driver<3, float>;
@@ -59,7 +59,8 @@ enum class OperatorType{
   HelmholtzOperator,        // mass + viscous (vectorial quantity, velocity)
   ProjectionOperator,       // mass + divergence penalty + continuity penalty (vectorial quantity, velocity)
   VelocityConvDiffOperator, // mass + convective + viscous (vectorial quantity, velocity)
-  InverseMassOperator       // inverse mass operator (vectorial quantity, velocity)
+  InverseMassOperator,      // inverse mass operator (vectorial quantity, velocity)
+  FullTimeStep              // complete time step including solvers and preconditioners (velocity and pressure)
 };
 // clang-format on
 
@@ -79,6 +80,7 @@ enum_to_string(OperatorType const enum_type)
     case OperatorType::ProjectionOperator:       string_type = "ProjectionOperator";       break;
     case OperatorType::VelocityConvDiffOperator: string_type = "VelocityConvDiffOperator"; break;
     case OperatorType::InverseMassOperator:      string_type = "InverseMassOperator";      break;
+    case OperatorType::FullTimeStep:             string_type = "FullTimeStep";             break;
 
     default:AssertThrow(false, ExcMessage("Not implemented.")); break;
       // clang-format on
@@ -99,6 +101,7 @@ string_to_enum(OperatorType & enum_type, std::string const string_type)
   else if(string_type == "ProjectionOperator")        enum_type = OperatorType::ProjectionOperator;
   else if(string_type == "VelocityConvDiffOperator")  enum_type = OperatorType::VelocityConvDiffOperator;
   else if(string_type == "InverseMassOperator")       enum_type = OperatorType::InverseMassOperator;
+  else if(string_type == "FullTimeStep")              enum_type = OperatorType::FullTimeStep;
   else AssertThrow(false, ExcMessage("Unknown operator type. Not implemented."));
   // clang-format on
 }
@@ -142,7 +145,8 @@ get_dofs_per_element(std::string const & input_file,
     AssertThrow(false, ExcMessage("Not implemented."));
 
   if(operator_type == OperatorType::CoupledNonlinearResidual ||
-     operator_type == OperatorType::CoupledLinearized)
+     operator_type == OperatorType::CoupledLinearized ||
+     operator_type == OperatorType::FullTimeStep)
   {
     return velocity_dofs_per_element + pressure_dofs_per_element;
   }
@@ -195,6 +199,17 @@ public:
                  unsigned int const  n_repetitions_outer,
                  bool const          is_test) const;
 
+  /*
+   * Measures the throughput of complete time steps (including all sub-steps, solver iterations,
+   * and preconditioners) in terms of DoFs * time steps / sec. A summary including the wall times
+   * of the sub-steps and the average number of iterations is appended to summary_file unless it
+   * is empty.
+   */
+  std::tuple<unsigned int, types::global_dof_index, double>
+  measure_time_steps(unsigned int const  n_time_steps,
+                     std::string const & summary_file,
+                     bool const          is_test) const;
+
 private:
   void
   ale_update() const;
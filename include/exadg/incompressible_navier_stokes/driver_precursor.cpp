@@ -19,6 +19,7 @@
  *  ______________________________________________________________________
  */
 
+
 #include <exadg/incompressible_navier_stokes/driver_precursor.h>
 #include <exadg/time_integration/time_step_calculation.h>
 #include <exadg/utilities/print_solver_results.h>
@@ -32,11 +33,143 @@ using namespace dealii;
 template<int dim, typename Number>
 DriverPrecursor<dim, Number>::DriverPrecursor(MPI_Comm const & comm)
   : mpi_comm(comm),
+    concurrent_execution(false),
+    is_precursor_process(true),
+    is_main_process(true),
+    n_processes_precursor(Utilities::MPI::n_mpi_processes(comm)),
+    sub_comm(comm),
+    mpi_comm_pre(comm),
+    mpi_comm_main(comm),
     pcout(std::cout, Utilities::MPI::this_mpi_process(mpi_comm) == 0),
     use_adaptive_time_stepping(false)
 {
 }
 
+template<int dim, typename Number>
+DriverPrecursor<dim, Number>::~DriverPrecursor()
+{
+  // release all objects depending on the sub-communicator before freeing it
+  inflow_data_communicator.reset();
+
+  if(concurrent_execution)
+  {
+    time_integrator_pre.reset();
+    time_integrator.reset();
+    postprocessor_pre.reset();
+    postprocessor.reset();
+    operator_coupled_pre.reset();
+    operator_dual_splitting_pre.reset();
+    operator_pressure_correction_pre.reset();
+    operator_base_pre.reset();
+    operator_coupled.reset();
+    operator_dual_splitting.reset();
+    operator_pressure_correction.reset();
+    operator_base.reset();
+    matrix_free_pre.reset();
+    matrix_free.reset();
+    triangulation_pre.reset();
+    triangulation.reset();
+
+    MPI_Comm_free(&sub_comm);
+  }
+}
+
+template<int dim, typename Number>
+std::shared_ptr<parallel::TriangulationBase<dim>>
+DriverPrecursor<dim, Number>::create_triangulation(TriangulationType const triangulation_type,
+                                                   MPI_Comm const &        comm) const
+{
+  std::shared_ptr<parallel::TriangulationBase<dim>> tria;
+
+  if(triangulation_type == TriangulationType::Distributed)
+  {
+    tria.reset(new parallel::distributed::Triangulation<dim>(
+      comm,
+      dealii::Triangulation<dim>::none,
+      parallel::distributed::Triangulation<dim>::construct_multigrid_hierarchy));
+  }
+  else if(triangulation_type == TriangulationType::FullyDistributed)
+  {
+    tria.reset(new parallel::fullydistributed::Triangulation<dim>(comm));
+  }
+  else
+  {
+    AssertThrow(false, ExcMessage("Invalid parameter triangulation_type."));
+  }
+
+  return tria;
+}
+
+template<int dim, typename Number>
+void
+DriverPrecursor<dim, Number>::split_communicator(unsigned int const degree,
+                                                 unsigned int const refine_space)
+{
+  unsigned int const n_processes = Utilities::MPI::n_mpi_processes(mpi_comm);
+  unsigned int const rank        = Utilities::MPI::this_mpi_process(mpi_comm);
+
+  AssertThrow(n_processes >= 2,
+              ExcMessage("Concurrent execution requires at least two MPI processes."));
+
+  AssertThrow(use_adaptive_time_stepping == false,
+              ExcMessage("Concurrent execution requires constant time step sizes, since the "
+                         "precursor domain runs ahead of the actual domain."));
+
+  double fraction = application->get_fraction_of_processes_precursor();
+
+  // Distribute the processes according to the workload, which is assumed to be proportional to
+  // the number of cells since both domains use the same polynomial degree. To this end, both
+  // grids are created once on all processes.
+  if(fraction == 0.0)
+  {
+    std::shared_ptr<Mapping<dim>>                                 mapping_tmp;
+    typename ApplicationBasePrecursor<dim, Number>::PeriodicFaces periodic_faces_tmp;
+
+    std::shared_ptr<parallel::TriangulationBase<dim>> tria_pre =
+      create_triangulation(param_pre.triangulation_type, mpi_comm);
+    application->create_grid_precursor(tria_pre,
+                                       periodic_faces_tmp,
+                                       refine_space,
+                                       mapping_tmp,
+                                       get_mapping_degree(param_pre.mapping, degree));
+
+    periodic_faces_tmp.clear();
+
+    std::shared_ptr<parallel::TriangulationBase<dim>> tria =
+      create_triangulation(param.triangulation_type, mpi_comm);
+    application->create_grid(tria,
+                             periodic_faces_tmp,
+                             refine_space,
+                             mapping_tmp,
+                             get_mapping_degree(param.mapping, degree));
+
+    double const n_cells_pre = tria_pre->n_global_active_cells();
+    double const n_cells     = tria->n_global_active_cells();
+
+    fraction = n_cells_pre / (n_cells_pre + n_cells);
+  }
+
+  n_processes_precursor =
+    std::min(std::max(static_cast<unsigned int>(std::round(fraction * n_processes)), 1u),
+             n_processes - 1);
+
+  // the first processes solve the precursor domain, the remaining ones the actual domain
+  is_precursor_process = rank < n_processes_precursor;
+  is_main_process      = not(is_precursor_process);
+
+  int const color = is_precursor_process ? 0 : 1;
+  MPI_Comm_split(mpi_comm, color, rank, &sub_comm);
+
+  mpi_comm_pre  = is_precursor_process ? sub_comm : MPI_COMM_NULL;
+  mpi_comm_main = is_main_process ? sub_comm : MPI_COMM_NULL;
+
+  pcout << std::endl
+        << "Concurrent execution of precursor domain and actual domain:" << std::endl
+        << std::endl;
+  print_parameter(pcout, "Processes precursor domain", n_processes_precursor);
+  print_parameter(pcout, "Processes actual domain", n_processes - n_processes_precursor);
+}
+
 template<int dim, typename Number>
 void
 DriverPrecursor<dim, Number>::set_start_time() const
@@ -45,8 +178,10 @@ DriverPrecursor<dim, Number>::set_start_time() const
   double const start_time = std::min(param_pre.start_time, param.start_time);
 
   // Set the same time step size for both time integrators
-  time_integrator_pre->reset_time(start_time);
-  time_integrator->reset_time(start_time);
+  if(is_precursor_process)
+    time_integrator_pre->reset_time(start_time);
+  if(is_main_process)
+    time_integrator->reset_time(start_time);
 }
 
 template<int dim, typename Number>
@@ -70,13 +205,19 @@ DriverPrecursor<dim, Number>::synchronize_time_step_size() const
   }
   else
   {
-    time_step_size_pre = time_integrator_pre->get_time_step_size();
-    time_step_size     = time_integrator->get_time_step_size();
+    if(is_precursor_process)
+      time_step_size_pre = time_integrator_pre->get_time_step_size();
+    if(is_main_process)
+      time_step_size = time_integrator->get_time_step_size();
   }
 
   // take the minimum
   time_step_size = std::min(time_step_size_pre, time_step_size);
 
+  // each process knows only the time step size of its own domain in case of concurrent execution
+  if(concurrent_execution)
+    time_step_size = Utilities::MPI::min(time_step_size, mpi_comm);
+
   // decrease time_step in order to exactly hit end_time
   if(use_adaptive_time_stepping == false)
   {
@@ -89,8 +230,10 @@ DriverPrecursor<dim, Number>::synchronize_time_step_size() const
   }
 
   // set the time step size
-  time_integrator_pre->set_current_time_step_size(time_step_size);
-  time_integrator->set_current_time_step_size(time_step_size);
+  if(is_precursor_process)
+    time_integrator_pre->set_current_time_step_size(time_step_size);
+  if(is_main_process)
+    time_integrator->set_current_time_step_size(time_step_size);
 }
 
 template<int dim, typename Number>
@@ -126,50 +269,72 @@ DriverPrecursor<dim, Number>::setup(std::shared_ptr<ApplicationBasePrecursor<dim
   AssertThrow(param_pre.ale_formulation == false, ExcMessage("not implemented."));
   AssertThrow(param.ale_formulation == false, ExcMessage("not implemented."));
 
-  // triangulation
-  if(param_pre.triangulation_type == TriangulationType::Distributed)
-  {
-    triangulation_pre.reset(new parallel::distributed::Triangulation<dim>(
-      mpi_comm,
-      dealii::Triangulation<dim>::none,
-      parallel::distributed::Triangulation<dim>::construct_multigrid_hierarchy));
-  }
-  else if(param_pre.triangulation_type == TriangulationType::FullyDistributed)
-  {
-    triangulation_pre.reset(new parallel::fullydistributed::Triangulation<dim>(mpi_comm));
-  }
-  else
-  {
-    AssertThrow(false, ExcMessage("Invalid parameter triangulation_type."));
-  }
+  // constant vs. adaptive time stepping
+  use_adaptive_time_stepping = param_pre.adaptive_time_stepping;
 
-  if(param.triangulation_type == TriangulationType::Distributed)
-  {
-    triangulation.reset(new parallel::distributed::Triangulation<dim>(
-      mpi_comm,
-      dealii::Triangulation<dim>::none,
-      parallel::distributed::Triangulation<dim>::construct_multigrid_hierarchy));
-  }
-  else if(param.triangulation_type == TriangulationType::FullyDistributed)
-  {
-    triangulation.reset(new parallel::fullydistributed::Triangulation<dim>(mpi_comm));
-  }
-  else
+  AssertThrow(param_pre.calculation_of_time_step_size == param.calculation_of_time_step_size,
+              ExcMessage("Type of time step calculation has to be the same for both domains."));
+
+  AssertThrow(param_pre.adaptive_time_stepping == param.adaptive_time_stepping,
+              ExcMessage("Type of time step calculation has to be the same for both domains."));
+
+  AssertThrow(param_pre.solver_type == SolverType::Unsteady &&
+                param.solver_type == SolverType::Unsteady,
+              ExcMessage("This is an unsteady solver. Check input parameters."));
+
+  // For the two-domain solver the parameter start_with_low_order has to be true.
+  // This is due to the fact that the setup function of the time integrator initializes
+  // the solution at previous time instants t_0 - dt, t_0 - 2*dt, ... in case of
+  // start_with_low_order == false. However, the combined time step size
+  // is not known at this point since the two domains have to first communicate with each other
+  // in order to find the minimum time step size. Hence, the easiest way to avoid these kind of
+  // inconsistencies is to preclude the case start_with_low_order == false.
+  AssertThrow(param_pre.start_with_low_order == true && param.start_with_low_order == true,
+              ExcMessage("start_with_low_order has to be true for two-domain solver."));
+
+  // distribute the processes to both domains
+  concurrent_execution = application->use_concurrent_execution();
+  if(concurrent_execution)
+    split_communicator(degree, refine_space);
+
+  if(is_precursor_process)
+    setup_precursor(degree, refine_space, is_test);
+
+  if(is_main_process)
+    setup_main(degree, refine_space, is_test);
+
+  // the root process of the precursor domain sends the inflow data to the root process of the
+  // actual domain, i.e. the first process of the respective sub-communicator
+  if(concurrent_execution)
   {
-    AssertThrow(false, ExcMessage("Invalid parameter triangulation_type."));
+    inflow_data_communicator.reset(new InflowDataCommunicator<dim>(application->get_inflow_data(),
+                                                                   mpi_comm,
+                                                                   sub_comm,
+                                                                   0 /* sender */,
+                                                                   n_processes_precursor,
+                                                                   is_precursor_process));
   }
 
+  timer_tree.insert({"Incompressible flow", "Setup"}, timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+DriverPrecursor<dim, Number>::setup_precursor(unsigned int const degree,
+                                              unsigned int const refine_space,
+                                              bool const         is_test)
+{
   // triangulation and mapping
+  triangulation_pre = create_triangulation(param_pre.triangulation_type, mpi_comm_pre);
+
   unsigned int const mapping_degree_pre = get_mapping_degree(param_pre.mapping, degree);
-  unsigned int const mapping_degree     = get_mapping_degree(param.mapping, degree);
 
   // create grid
   application->create_grid_precursor(
     triangulation_pre, periodic_faces_pre, refine_space, mapping_pre, mapping_degree_pre);
-  application->create_grid(triangulation, periodic_faces, refine_space, mapping, mapping_degree);
 
-  print_grid_data(pcout, refine_space, *triangulation_pre);
-  print_grid_data(pcout, refine_space, *triangulation);
+  ConditionalOStream pcout_pre(std::cout, Utilities::MPI::this_mpi_process(mpi_comm_pre) == 0);
+  print_grid_data(pcout_pre, refine_space, *triangulation_pre);
 
   boundary_descriptor_velocity_pre.reset(new BoundaryDescriptorU<dim>());
   boundary_descriptor_pressure_pre.reset(new BoundaryDescriptorP<dim>());
@@ -183,30 +348,8 @@ DriverPrecursor<dim, Number>::setup(std::shared_ptr<ApplicationBasePrecursor<dim
                              *triangulation_pre,
                              periodic_faces_pre);
 
-  boundary_descriptor_velocity.reset(new BoundaryDescriptorU<dim>());
-  boundary_descriptor_pressure.reset(new BoundaryDescriptorP<dim>());
-
-  application->set_boundary_conditions(boundary_descriptor_velocity, boundary_descriptor_pressure);
-  verify_boundary_conditions(*boundary_descriptor_velocity, *triangulation, periodic_faces);
-  verify_boundary_conditions(*boundary_descriptor_pressure, *triangulation, periodic_faces);
-
   field_functions_pre.reset(new FieldFunctions<dim>());
-  field_functions.reset(new FieldFunctions<dim>());
   application->set_field_functions_precursor(field_functions_pre);
-  application->set_field_functions(field_functions);
-
-  // constant vs. adaptive time stepping
-  use_adaptive_time_stepping = param_pre.adaptive_time_stepping;
-
-  AssertThrow(param_pre.calculation_of_time_step_size == param.calculation_of_time_step_size,
-              ExcMessage("Type of time step calculation has to be the same for both domains."));
-
-  AssertThrow(param_pre.adaptive_time_stepping == param.adaptive_time_stepping,
-              ExcMessage("Type of time step calculation has to be the same for both domains."));
-
-  AssertThrow(param_pre.solver_type == SolverType::Unsteady &&
-                param.solver_type == SolverType::Unsteady,
-              ExcMessage("This is an unsteady solver. Check input parameters."));
 
   // initialize operator_base_pre (precursor domain)
   if(this->param_pre.temporal_discretization == TemporalDiscretization::BDFCoupledSolution)
@@ -221,7 +364,7 @@ DriverPrecursor<dim, Number>::setup(std::shared_ptr<ApplicationBasePrecursor<dim
                                               field_functions_pre,
                                               param_pre,
                                               "fluid",
-                                              mpi_comm));
+                                              mpi_comm_pre));
 
     operator_base_pre = operator_coupled_pre;
   }
@@ -237,7 +380,7 @@ DriverPrecursor<dim, Number>::setup(std::shared_ptr<ApplicationBasePrecursor<dim
                                                     field_functions_pre,
                                                     param_pre,
                                                     "fluid",
-                                                    mpi_comm));
+                                                    mpi_comm_pre));
 
     operator_base_pre = operator_dual_splitting_pre;
   }
@@ -253,7 +396,7 @@ DriverPrecursor<dim, Number>::setup(std::shared_ptr<ApplicationBasePrecursor<dim
                                                          field_functions_pre,
                                                          param_pre,
                                                          "fluid",
-                                                         mpi_comm));
+                                                         mpi_comm_pre));
 
     operator_base_pre = operator_pressure_correction_pre;
   }
@@ -262,6 +405,104 @@ DriverPrecursor<dim, Number>::setup(std::shared_ptr<ApplicationBasePrecursor<dim
     AssertThrow(false, ExcMessage("Not implemented."));
   }
 
+  // initialize matrix_free precursor
+  matrix_free_data_pre.reset(new MatrixFreeData<dim, Number>());
+  matrix_free_data_pre->data.tasks_parallel_scheme =
+    MatrixFree<dim, Number>::AdditionalData::partition_partition;
+  if(param_pre.use_cell_based_face_loops)
+  {
+    auto tria =
+      std::dynamic_pointer_cast<parallel::distributed::Triangulation<dim> const>(triangulation_pre);
+    Categorization::do_cell_based_loops(*tria, matrix_free_data_pre->data);
+  }
+  operator_base_pre->fill_matrix_free_data(*matrix_free_data_pre);
+  if(param_pre.use_dof_renumbering)
+    operator_base_pre->renumber_dofs(*matrix_free_data_pre);
+  matrix_free_pre.reset(new MatrixFree<dim, Number>());
+  matrix_free_pre->reinit(*mapping_pre,
+                          matrix_free_data_pre->get_dof_handler_vector(),
+                          matrix_free_data_pre->get_constraint_vector(),
+                          matrix_free_data_pre->get_quadrature_vector(),
+                          matrix_free_data_pre->data);
+
+  // setup Navier-Stokes operator_base
+  operator_base_pre->setup(matrix_free_pre, matrix_free_data_pre);
+
+  // setup postprocessor
+  postprocessor_pre = application->construct_postprocessor_precursor(degree, mpi_comm_pre);
+  postprocessor_pre->setup(*operator_base_pre);
+
+  // Setup time integrator
+  if(this->param_pre.temporal_discretization == TemporalDiscretization::BDFCoupledSolution)
+  {
+    time_integrator_pre.reset(new IncNS::TimeIntBDFCoupled<dim, Number>(operator_coupled_pre,
+                                                                        param_pre,
+                                                                        0 /* refine_time */,
+                                                                        mpi_comm_pre,
+                                                                        not(is_test),
+                                                                        postprocessor_pre));
+  }
+  else if(this->param_pre.temporal_discretization == TemporalDiscretization::BDFDualSplittingScheme)
+  {
+    time_integrator_pre.reset(
+      new IncNS::TimeIntBDFDualSplitting<dim, Number>(operator_dual_splitting_pre,
+                                                      param_pre,
+                                                      0 /* refine_time */,
+                                                      mpi_comm_pre,
+                                                      not(is_test),
+                                                      postprocessor_pre));
+  }
+  else if(this->param_pre.temporal_discretization == TemporalDiscretization::BDFPressureCorrection)
+  {
+    time_integrator_pre.reset(
+      new IncNS::TimeIntBDFPressureCorrection<dim, Number>(operator_pressure_correction_pre,
+                                                           param_pre,
+                                                           0 /* refine_time */,
+                                                           mpi_comm_pre,
+                                                           not(is_test),
+                                                           postprocessor_pre));
+  }
+  else
+  {
+    AssertThrow(false, ExcMessage("Not implemented."));
+  }
+
+  // setup time integrator before calling setup_solvers (this is necessary since the setup of the
+  // solvers depends on quantities such as the time_step_size or gamma0!!!)
+  time_integrator_pre->setup(param_pre.restarted_simulation);
+
+  // setup solvers
+  operator_base_pre->setup_solvers(time_integrator_pre->get_scaling_factor_time_derivative_term(),
+                                   time_integrator_pre->get_velocity());
+}
+
+template<int dim, typename Number>
+void
+DriverPrecursor<dim, Number>::setup_main(unsigned int const degree,
+                                         unsigned int const refine_space,
+                                         bool const         is_test)
+{
+  // triangulation and mapping
+  triangulation = create_triangulation(param.triangulation_type, mpi_comm_main);
+
+  unsigned int const mapping_degree = get_mapping_degree(param.mapping, degree);
+
+  // create grid
+  application->create_grid(triangulation, periodic_faces, refine_space, mapping, mapping_degree);
+
+  ConditionalOStream pcout_main(std::cout, Utilities::MPI::this_mpi_process(mpi_comm_main) == 0);
+  print_grid_data(pcout_main, refine_space, *triangulation);
+
+  boundary_descriptor_velocity.reset(new BoundaryDescriptorU<dim>());
+  boundary_descriptor_pressure.reset(new BoundaryDescriptorP<dim>());
+
+  application->set_boundary_conditions(boundary_descriptor_velocity, boundary_descriptor_pressure);
+  verify_boundary_conditions(*boundary_descriptor_velocity, *triangulation, periodic_faces);
+  verify_boundary_conditions(*boundary_descriptor_pressure, *triangulation, periodic_faces);
+
+  field_functions.reset(new FieldFunctions<dim>());
+  application->set_field_functions(field_functions);
+
   // initialize operator_base (actual domain)
   if(this->param.temporal_discretization == TemporalDiscretization::BDFCoupledSolution)
   {
@@ -274,7 +515,7 @@ DriverPrecursor<dim, Number>::setup(std::shared_ptr<ApplicationBasePrecursor<dim
                                                                    field_functions,
                                                                    param,
                                                                    "fluid",
-                                                                   mpi_comm));
+                                                                   mpi_comm_main));
 
     operator_base = operator_coupled;
   }
@@ -290,7 +531,7 @@ DriverPrecursor<dim, Number>::setup(std::shared_ptr<ApplicationBasePrecursor<dim
                                                     field_functions,
                                                     param,
                                                     "fluid",
-                                                    mpi_comm));
+                                                    mpi_comm_main));
 
     operator_base = operator_dual_splitting;
   }
@@ -306,7 +547,7 @@ DriverPrecursor<dim, Number>::setup(std::shared_ptr<ApplicationBasePrecursor<dim
                                                          field_functions,
                                                          param,
                                                          "fluid",
-                                                         mpi_comm));
+                                                         mpi_comm_main));
 
     operator_base = operator_pressure_correction;
   }
@@ -315,24 +556,6 @@ DriverPrecursor<dim, Number>::setup(std::shared_ptr<ApplicationBasePrecursor<dim
     AssertThrow(false, ExcMessage("Not implemented."));
   }
 
-  // initialize matrix_free precursor
-  matrix_free_data_pre.reset(new MatrixFreeData<dim, Number>());
-  matrix_free_data_pre->data.tasks_parallel_scheme =
-    MatrixFree<dim, Number>::AdditionalData::partition_partition;
-  if(param_pre.use_cell_based_face_loops)
-  {
-    auto tria =
-      std::dynamic_pointer_cast<parallel::distributed::Triangulation<dim> const>(triangulation_pre);
-    Categorization::do_cell_based_loops(*tria, matrix_free_data_pre->data);
-  }
-  operator_base_pre->fill_matrix_free_data(*matrix_free_data_pre);
-  matrix_free_pre.reset(new MatrixFree<dim, Number>());
-  matrix_free_pre->reinit(*mapping_pre,
-                          matrix_free_data_pre->get_dof_handler_vector(),
-                          matrix_free_data_pre->get_constraint_vector(),
-                          matrix_free_data_pre->get_quadrature_vector(),
-                          matrix_free_data_pre->data);
-
   // initialize matrix_free
   matrix_free_data.reset(new MatrixFreeData<dim, Number>());
   matrix_free_data->data.tasks_parallel_scheme =
@@ -344,6 +567,8 @@ DriverPrecursor<dim, Number>::setup(std::shared_ptr<ApplicationBasePrecursor<dim
     Categorization::do_cell_based_loops(*tria, matrix_free_data->data);
   }
   operator_base->fill_matrix_free_data(*matrix_free_data);
+  if(param.use_dof_renumbering)
+    operator_base->renumber_dofs(*matrix_free_data);
   matrix_free.reset(new MatrixFree<dim, Number>());
   matrix_free->reinit(*mapping,
                       matrix_free_data->get_dof_handler_vector(),
@@ -351,64 +576,28 @@ DriverPrecursor<dim, Number>::setup(std::shared_ptr<ApplicationBasePrecursor<dim
                       matrix_free_data->get_quadrature_vector(),
                       matrix_free_data->data);
 
-
   // setup Navier-Stokes operator_base
-  operator_base_pre->setup(matrix_free_pre, matrix_free_data_pre);
   operator_base->setup(matrix_free, matrix_free_data);
 
   // setup postprocessor
-  postprocessor_pre = application->construct_postprocessor_precursor(degree, mpi_comm);
-  postprocessor_pre->setup(*operator_base_pre);
-
-  postprocessor = application->construct_postprocessor(degree, mpi_comm);
+  postprocessor = application->construct_postprocessor(degree, mpi_comm_main);
   postprocessor->setup(*operator_base);
 
-
   // Setup time integrator
-
-  if(this->param_pre.temporal_discretization == TemporalDiscretization::BDFCoupledSolution)
-  {
-    time_integrator_pre.reset(new IncNS::TimeIntBDFCoupled<dim, Number>(operator_coupled_pre,
-                                                                        param_pre,
-                                                                        0 /* refine_time */,
-                                                                        mpi_comm,
-                                                                        not(is_test),
-                                                                        postprocessor_pre));
-  }
-  else if(this->param_pre.temporal_discretization == TemporalDiscretization::BDFDualSplittingScheme)
-  {
-    time_integrator_pre.reset(
-      new IncNS::TimeIntBDFDualSplitting<dim, Number>(operator_dual_splitting_pre,
-                                                      param_pre,
-                                                      0 /* refine_time */,
-                                                      mpi_comm,
-                                                      not(is_test),
-                                                      postprocessor_pre));
-  }
-  else if(this->param_pre.temporal_discretization == TemporalDiscretization::BDFPressureCorrection)
-  {
-    time_integrator_pre.reset(
-      new IncNS::TimeIntBDFPressureCorrection<dim, Number>(operator_pressure_correction_pre,
-                                                           param_pre,
-                                                           0 /* refine_time */,
-                                                           mpi_comm,
-                                                           not(is_test),
-                                                           postprocessor_pre));
-  }
-  else
-  {
-    AssertThrow(false, ExcMessage("Not implemented."));
-  }
-
   if(this->param.temporal_discretization == TemporalDiscretization::BDFCoupledSolution)
   {
     time_integrator.reset(new IncNS::TimeIntBDFCoupled<dim, Number>(
-      operator_coupled, param, 0 /* refine_time */, mpi_comm, not(is_test), postprocessor));
+      operator_coupled, param, 0 /* refine_time */, mpi_comm_main, not(is_test), postprocessor));
   }
   else if(this->param.temporal_discretization == TemporalDiscretization::BDFDualSplittingScheme)
   {
-    time_integrator.reset(new IncNS::TimeIntBDFDualSplitting<dim, Number>(
-      operator_dual_splitting, param, 0 /* refine_time */, mpi_comm, not(is_test), postprocessor));
+    time_integrator.reset(
+      new IncNS::TimeIntBDFDualSplitting<dim, Number>(operator_dual_splitting,
+                                                      param,
+                                                      0 /* refine_time */,
+                                                      mpi_comm_main,
+                                                      not(is_test),
+                                                      postprocessor));
   }
   else if(this->param.temporal_discretization == TemporalDiscretization::BDFPressureCorrection)
   {
@@ -416,7 +605,7 @@ DriverPrecursor<dim, Number>::setup(std::shared_ptr<ApplicationBasePrecursor<dim
       new IncNS::TimeIntBDFPressureCorrection<dim, Number>(operator_pressure_correction,
                                                            param,
                                                            0 /* refine_time */,
-                                                           mpi_comm,
+                                                           mpi_comm_main,
                                                            not(is_test),
                                                            postprocessor));
   }
@@ -425,31 +614,13 @@ DriverPrecursor<dim, Number>::setup(std::shared_ptr<ApplicationBasePrecursor<dim
     AssertThrow(false, ExcMessage("Not implemented."));
   }
 
-
-  // For the two-domain solver the parameter start_with_low_order has to be true.
-  // This is due to the fact that the setup function of the time integrator initializes
-  // the solution at previous time instants t_0 - dt, t_0 - 2*dt, ... in case of
-  // start_with_low_order == false. However, the combined time step size
-  // is not known at this point since the two domains have to first communicate with each other
-  // in order to find the minimum time step size. Hence, the easiest way to avoid these kind of
-  // inconsistencies is to preclude the case start_with_low_order == false.
-  AssertThrow(param_pre.start_with_low_order == true && param.start_with_low_order == true,
-              ExcMessage("start_with_low_order has to be true for two-domain solver."));
-
   // setup time integrator before calling setup_solvers (this is necessary since the setup of the
   // solvers depends on quantities such as the time_step_size or gamma0!!!)
-  time_integrator_pre->setup(param_pre.restarted_simulation);
   time_integrator->setup(param.restarted_simulation);
 
   // setup solvers
-
-  operator_base_pre->setup_solvers(time_integrator_pre->get_scaling_factor_time_derivative_term(),
-                                   time_integrator_pre->get_velocity());
-
   operator_base->setup_solvers(time_integrator->get_scaling_factor_time_derivative_term(),
                                time_integrator->get_velocity());
-
-  timer_tree.insert({"Incompressible flow", "Setup"}, timer.wall_time());
 }
 
 template<int dim, typename Number>
@@ -460,6 +631,36 @@ DriverPrecursor<dim, Number>::solve() const
 
   synchronize_time_step_size();
 
+  if(concurrent_execution)
+  {
+    // Both domains are advanced concurrently with the same sequence of time steps. The precursor
+    // domain sends the inflow data after each time step and thereby runs ahead of the actual
+    // domain, which waits for the inflow data at the new time before advancing its time step.
+    if(is_precursor_process)
+    {
+      do
+      {
+        time_integrator_pre->advance_one_timestep();
+
+        inflow_data_communicator->send(time_integrator_pre->finished());
+      } while(!time_integrator_pre->finished());
+    }
+    else
+    {
+      bool precursor_finished = false;
+
+      do
+      {
+        if(not(precursor_finished))
+          precursor_finished = inflow_data_communicator->receive();
+
+        time_integrator->advance_one_timestep();
+      } while(!precursor_finished || !time_integrator->finished());
+    }
+
+    return;
+  }
+
   // time loop
   do
   {
@@ -497,23 +698,45 @@ DriverPrecursor<dim, Number>::print_performance_results(double const total_time,
               << "Average number of iterations for incompressible Navier-Stokes solver:"
               << std::endl;
 
-  this->pcout << std::endl << "Precursor:" << std::endl;
+  // In case of concurrent execution, the results of each domain are printed by the root process
+  // of the respective sub-communicator.
+  if(is_precursor_process)
+  {
+    ConditionalOStream pcout_pre(std::cout, Utilities::MPI::this_mpi_process(mpi_comm_pre) == 0);
+    pcout_pre << std::endl << "Precursor:" << std::endl;
 
-  time_integrator_pre->print_iterations();
+    time_integrator_pre->print_iterations();
+  }
 
-  this->pcout << std::endl << "Main:" << std::endl;
+  if(concurrent_execution)
+    MPI_Barrier(mpi_comm);
 
-  time_integrator->print_iterations();
+  if(is_main_process)
+  {
+    ConditionalOStream pcout_main(std::cout, Utilities::MPI::this_mpi_process(mpi_comm_main) == 0);
+    pcout_main << std::endl << "Main:" << std::endl;
+
+    time_integrator->print_iterations();
+  }
+
+  if(concurrent_execution)
+    MPI_Barrier(mpi_comm);
 
   // Wall times
   this->pcout << std::endl << "Wall times for incompressible Navier-Stokes solver:" << std::endl;
 
   timer_tree.insert({"Incompressible flow"}, total_time);
 
-  timer_tree.insert({"Incompressible flow"},
-                    time_integrator_pre->get_timings(),
-                    "Timeloop precursor");
-  timer_tree.insert({"Incompressible flow"}, time_integrator->get_timings(), "Timeloop main");
+  // The timer tree is evaluated collectively over all processes and therefore has to have the
+  // same structure on all processes, which is not the case for the timings of the time loops in
+  // case of concurrent execution.
+  if(not(concurrent_execution))
+  {
+    timer_tree.insert({"Incompressible flow"},
+                      time_integrator_pre->get_timings(),
+                      "Timeloop precursor");
+    timer_tree.insert({"Incompressible flow"}, time_integrator->get_timings(), "Timeloop main");
+  }
 
   if(not(is_test))
   {
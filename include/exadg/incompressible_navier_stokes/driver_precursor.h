@@ -24,6 +24,7 @@
 
 #include <exadg/functions_and_boundary_conditions/verify_boundary_conditions.h>
 #include <exadg/grid/mapping_degree.h>
+#include <exadg/incompressible_navier_stokes/postprocessor/inflow_data_calculator.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/postprocessor_base.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operator_coupled.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operator_dual_splitting.h>
@@ -47,6 +48,8 @@ class DriverPrecursor
 public:
   DriverPrecursor(MPI_Comm const & mpi_comm);
 
+  ~DriverPrecursor();
+
   void
   setup(std::shared_ptr<ApplicationBasePrecursor<dim, Number>> application,
         unsigned int const                                     degree,
@@ -60,6 +63,18 @@ public:
   print_performance_results(double const total_time, bool const is_test) const;
 
 private:
+  std::shared_ptr<parallel::TriangulationBase<dim>>
+  create_triangulation(TriangulationType const triangulation_type, MPI_Comm const & comm) const;
+
+  void
+  split_communicator(unsigned int const degree, unsigned int const refine_space);
+
+  void
+  setup_precursor(unsigned int const degree, unsigned int const refine_space, bool const is_test);
+
+  void
+  setup_main(unsigned int const degree, unsigned int const refine_space, bool const is_test);
+
   void
   set_start_time() const;
 
@@ -69,6 +84,19 @@ private:
   // MPI communicator
   MPI_Comm const & mpi_comm;
 
+  // Solve the precursor domain and the actual domain concurrently on disjoint sets of processes?
+  bool concurrent_execution;
+
+  // Does the current process solve the precursor domain and/or the actual domain? Both are true
+  // if the domains are solved one after the other by all processes.
+  bool is_precursor_process, is_main_process;
+
+  // number of processes solving the precursor domain in case of concurrent execution
+  unsigned int n_processes_precursor;
+
+  // communicators of the precursor domain and the actual domain
+  MPI_Comm sub_comm, mpi_comm_pre, mpi_comm_main;
+
   // output to std::cout
   ConditionalOStream pcout;
 
@@ -133,6 +161,9 @@ private:
 
   bool use_adaptive_time_stepping;
 
+  // transfer of inflow data in case of concurrent execution
+  std::shared_ptr<InflowDataCommunicator<dim>> inflow_data_communicator;
+
   /*
    * Computation time (wall clock time).
    */
@@ -19,6 +19,11 @@
  *  ______________________________________________________________________
  */
 
+// C++
+#include <algorithm>
+#include <limits>
+
+// ExaDG
 #include <exadg/functions_and_boundary_conditions/linear_interpolation.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/inflow_data_calculator.h>
 #include <exadg/vector_tools/interpolate_solution.h>
@@ -33,26 +38,93 @@ using namespace dealii;
 template<int dim, typename Number>
 InflowDataCalculator<dim, Number>::InflowDataCalculator(InflowData<dim> const & inflow_data_in,
                                                         MPI_Comm const &        comm)
-  : inflow_data(inflow_data_in), inflow_data_has_been_initialized(false), mpi_comm(comm)
+  : inflow_data(inflow_data_in),
+    inflow_data_has_been_initialized(false),
+    mpi_comm(comm),
+    time_last_record(std::numeric_limits<double>::lowest())
 {
 }
 
 template<int dim, typename Number>
 void
 InflowDataCalculator<dim, Number>::setup(DoFHandler<dim> const & dof_handler_velocity_in,
-                                         Mapping<dim> const &    mapping_in)
+                                         Mapping<dim> const &    mapping_in,
+                                         bool const              do_restart)
 {
   dof_handler_velocity = &dof_handler_velocity_in;
   mapping              = &mapping_in;
 
   array_dof_indices_and_shape_values.resize(inflow_data.n_points_y * inflow_data.n_points_z);
   array_counter.resize(inflow_data.n_points_y * inflow_data.n_points_z);
+
+  // write header of the inflow database, or continue an existing inflow database in case of a
+  // restart
+  if(inflow_data.write_inflow_data == true && inflow_data.write_inflow_database == true &&
+     Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    AssertThrow(inflow_data.write_every_timesteps > 0,
+                ExcMessage("Invalid parameter write_every_timesteps."));
+
+    unsigned int const header[3] = {static_cast<unsigned int>(dim),
+                                    inflow_data.n_points_y,
+                                    inflow_data.n_points_z};
+
+    bool append = false;
+    if(do_restart)
+    {
+      std::ifstream existing_database(inflow_data.filename.c_str(), std::ios::binary);
+      if(existing_database.good())
+      {
+        unsigned int existing_header[3];
+        existing_database.read(reinterpret_cast<char *>(&existing_header[0]), sizeof(header));
+        AssertThrow(existing_database.good() && std::equal(header, header + 3, existing_header),
+                    ExcMessage("The inflow database " + inflow_data.filename +
+                               " does not match the specified inflow data."));
+
+        std::streamoff const record_size =
+          (1 + dim * inflow_data.n_points_y * inflow_data.n_points_z) * sizeof(double);
+
+        existing_database.seekg(0, std::ios::end);
+        std::streamoff const size_records =
+          static_cast<std::streamoff>(existing_database.tellg()) - sizeof(header);
+        AssertThrow(size_records % record_size == 0,
+                    ExcMessage("The inflow database " + inflow_data.filename +
+                               " contains an incomplete record."));
+
+        // records written after the restart data have been written are not written again, see
+        // write_record()
+        if(size_records > 0)
+        {
+          existing_database.seekg(sizeof(header) + size_records - record_size);
+          existing_database.read(reinterpret_cast<char *>(&time_last_record), sizeof(double));
+        }
+
+        append = true;
+      }
+    }
+
+    if(append)
+    {
+      database.open(inflow_data.filename.c_str(), std::ios::binary | std::ios::app);
+      AssertThrow(database.good(), ExcMessage("Could not open file " + inflow_data.filename + "."));
+    }
+    else
+    {
+      database.open(inflow_data.filename.c_str(), std::ios::binary | std::ios::trunc);
+      AssertThrow(database.good(), ExcMessage("Could not open file " + inflow_data.filename + "."));
+
+      database.write(reinterpret_cast<char const *>(&header[0]), sizeof(header));
+      database.flush();
+    }
+  }
 }
 
 template<int dim, typename Number>
 void
 InflowDataCalculator<dim, Number>::calculate(
-  LinearAlgebra::distributed::Vector<Number> const & velocity)
+  LinearAlgebra::distributed::Vector<Number> const & velocity,
+  double const                                       time,
+  int const                                          time_step_number)
 {
   if(inflow_data.write_inflow_data == true)
   {
@@ -147,7 +219,119 @@ InflowDataCalculator<dim, Number>::calculate(
           (*inflow_data.array)[array_index] /= Number(array_counter[array_index]);
       }
     }
+
+    // record inflow data
+    if(inflow_data.write_inflow_database == true &&
+       time_step_number % inflow_data.write_every_timesteps == 0 &&
+       Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    {
+      write_record(time);
+    }
+  }
+}
+
+template<int dim, typename Number>
+void
+InflowDataCalculator<dim, Number>::write_record(double const time)
+{
+  // the records of the inflow database have to be sorted in time
+  if(time <= time_last_record)
+    return;
+
+  database.write(reinterpret_cast<char const *>(&time), sizeof(double));
+  database.write(reinterpret_cast<char const *>(&(*inflow_data.array)[0][0]),
+                 dim * inflow_data.array->size() * sizeof(double));
+
+  // flush so that the inflow database remains usable if the simulation is aborted
+  database.flush();
+
+  AssertThrow(database.good(),
+              ExcMessage("Could not write to file " + inflow_data.filename + "."));
+
+  time_last_record = time;
+}
+
+template<int dim>
+InflowDataCommunicator<dim>::InflowDataCommunicator(InflowData<dim> const & inflow_data_in,
+                                                    MPI_Comm const &        comm_in,
+                                                    MPI_Comm const &        comm_receiver_in,
+                                                    unsigned int const      sender_in,
+                                                    unsigned int const      receiver_in,
+                                                    bool const              is_sender_in)
+  : inflow_data(inflow_data_in),
+    comm_receiver(comm_receiver_in),
+    sender(sender_in),
+    receiver(receiver_in),
+    is_sender(is_sender_in),
+    request(MPI_REQUEST_NULL)
+{
+  MPI_Comm_dup(comm_in, &comm);
+
+  unsigned int const size = 1 + dim * inflow_data.array->size();
+  buffer.resize(size);
+  buffer_in_flight.resize(size);
+
+  // post receive of the first message
+  if(Utilities::MPI::this_mpi_process(comm) == static_cast<unsigned int>(receiver))
+    MPI_Irecv(buffer_in_flight.data(), size, MPI_DOUBLE, sender, 0, comm, &request);
+}
+
+template<int dim>
+InflowDataCommunicator<dim>::~InflowDataCommunicator()
+{
+  if(request != MPI_REQUEST_NULL)
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+  MPI_Comm_free(&comm);
+}
+
+template<int dim>
+void
+InflowDataCommunicator<dim>::send(bool const last_message)
+{
+  AssertThrow(is_sender, ExcMessage("Inflow data can only be sent by the precursor domain."));
+
+  if(Utilities::MPI::this_mpi_process(comm) == static_cast<unsigned int>(sender))
+  {
+    // the buffer of the previous message must not be overwritten before the send has completed
+    if(request != MPI_REQUEST_NULL)
+      MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+    buffer_in_flight[0] = last_message ? 1.0 : 0.0;
+    std::copy(&(*inflow_data.array)[0][0],
+              &(*inflow_data.array)[0][0] + dim * inflow_data.array->size(),
+              buffer_in_flight.begin() + 1);
+
+    MPI_Isend(
+      buffer_in_flight.data(), buffer_in_flight.size(), MPI_DOUBLE, receiver, 0, comm, &request);
+  }
+}
+
+template<int dim>
+bool
+InflowDataCommunicator<dim>::receive()
+{
+  AssertThrow(not(is_sender),
+              ExcMessage("Inflow data can only be received by the actual domain."));
+
+  if(Utilities::MPI::this_mpi_process(comm) == static_cast<unsigned int>(receiver))
+  {
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+    buffer.swap(buffer_in_flight);
+
+    // post receive of the next message
+    if(buffer[0] == 0.0)
+      MPI_Irecv(
+        buffer_in_flight.data(), buffer_in_flight.size(), MPI_DOUBLE, sender, 0, comm, &request);
   }
+
+  // forward inflow data to all processes of the actual domain
+  MPI_Bcast(buffer.data(), buffer.size(), MPI_DOUBLE, 0, comm_receiver);
+
+  std::copy(buffer.begin() + 1, buffer.end(), &(*inflow_data.array)[0][0]);
+
+  return buffer[0] != 0.0;
 }
 
 template class InflowDataCalculator<2, float>;
@@ -156,5 +340,8 @@ template class InflowDataCalculator<2, double>;
 template class InflowDataCalculator<3, float>;
 template class InflowDataCalculator<3, double>;
 
+template class InflowDataCommunicator<2>;
+template class InflowDataCommunicator<3>;
+
 } // namespace IncNS
 } // namespace ExaDG
@@ -29,6 +29,9 @@
 #include <deal.II/fe/mapping_q.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
+// C++
+#include <fstream>
+
 // ExaDG
 #include <exadg/utilities/print_functions.h>
 
@@ -43,6 +46,12 @@ using namespace dealii;
  *
  * The outflow boundary has to be the y-z plane at a given x-coordinate. The velocity is written at
  * n_points_y in y-direction and n_points_z in z-direction, which has to be specified by the user.
+ *
+ * Optionally, the inflow data is recorded to an inflow database on disk so that subsequent
+ * simulations can replay the inflow data without solving the precursor domain (see
+ * InflowDataReader). The inflow database is a binary file consisting of a header with the
+ * dimension and the number of points (n_points_y, n_points_z), followed by one record per write
+ * event containing the time and the velocity values at all n_points_y*n_points_z points.
  */
 enum class InflowGeometry
 {
@@ -60,6 +69,9 @@ struct InflowData
       normal_coordinate(0.0),
       n_points_y(2),
       n_points_z(2),
+      write_inflow_database(false),
+      filename("inflow_database"),
+      write_every_timesteps(1),
       y_values(nullptr),
       z_values(nullptr),
       array(nullptr)
@@ -75,6 +87,12 @@ struct InflowData
       print_parameter(pcout, "Normal coordinate", normal_coordinate);
       print_parameter(pcout, "Number of points in y-direction", n_points_y);
       print_parameter(pcout, "Number of points in z-direction", n_points_z);
+      print_parameter(pcout, "Write inflow database", write_inflow_database);
+      if(write_inflow_database == true)
+      {
+        print_parameter(pcout, "Filename", filename);
+        print_parameter(pcout, "Write every timesteps", write_every_timesteps);
+      }
     }
   }
 
@@ -91,6 +109,13 @@ struct InflowData
   unsigned int n_points_y;
   unsigned int n_points_z;
 
+  // record the inflow data to an inflow database on disk?
+  bool write_inflow_database;
+  // filename of the inflow database
+  std::string filename;
+  // write a record every ... time steps
+  unsigned int write_every_timesteps;
+
   // Vectors with the y-coordinates, z-coordinates (in physical space)
   std::vector<double> * y_values;
   std::vector<double> * z_values;
@@ -104,13 +129,24 @@ class InflowDataCalculator
 public:
   InflowDataCalculator(InflowData<dim> const & inflow_data, MPI_Comm const & comm);
 
+  /*
+   * In case of a restart (do_restart = true), the records are appended to an existing inflow
+   * database.
+   */
   void
-  setup(DoFHandler<dim> const & dof_handler_velocity, Mapping<dim> const & mapping);
+  setup(DoFHandler<dim> const & dof_handler_velocity,
+        Mapping<dim> const &    mapping,
+        bool const              do_restart);
 
   void
-  calculate(LinearAlgebra::distributed::Vector<Number> const & velocity);
+  calculate(LinearAlgebra::distributed::Vector<Number> const & velocity,
+            double const                                       time,
+            int const                                          time_step_number);
 
 private:
+  void
+  write_record(double const time);
+
   SmartPointer<DoFHandler<dim> const> dof_handler_velocity;
   SmartPointer<Mapping<dim> const>    mapping;
   InflowData<dim>                     inflow_data;
@@ -122,6 +158,63 @@ private:
     array_dof_indices_and_shape_values;
 
   std::vector<unsigned int> array_counter;
+
+  std::ofstream database;
+
+  // time of the last record of the inflow database
+  double time_last_record;
+};
+
+/*
+ * Transfers the inflow data from the processes of the precursor domain to the processes of the
+ * actual domain if both domains are solved concurrently on disjoint sets of processes. The root
+ * process of the precursor domain sends the inflow data by non-blocking point-to-point
+ * communication to the root process of the actual domain, which forwards the data to all processes
+ * of the actual domain. The receive of the next message is posted immediately so that the
+ * transfer overlaps with the time step of the actual domain.
+ */
+template<int dim>
+class InflowDataCommunicator
+{
+public:
+  InflowDataCommunicator(InflowData<dim> const & inflow_data,
+                         MPI_Comm const &        comm,
+                         MPI_Comm const &        comm_receiver,
+                         unsigned int const      sender,
+                         unsigned int const      receiver,
+                         bool const              is_sender);
+
+  ~InflowDataCommunicator();
+
+  /*
+   * Called by all processes of the precursor domain. The flag last_message indicates that no
+   * further inflow data will be sent.
+   */
+  void
+  send(bool const last_message);
+
+  /*
+   * Called by all processes of the actual domain. Returns true if this has been the last message.
+   */
+  bool
+  receive();
+
+private:
+  InflowData<dim> inflow_data;
+
+  // duplicate of the communicator comprising both domains to separate the messages from other
+  // communication
+  MPI_Comm comm;
+
+  MPI_Comm const & comm_receiver;
+
+  int const  sender, receiver;
+  bool const is_sender;
+
+  // the first entry contains the flag last_message, followed by the inflow data
+  std::vector<double> buffer, buffer_in_flight;
+
+  MPI_Request request;
 };
 
 } // namespace IncNS
@@ -0,0 +1,162 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// C++
+#include <algorithm>
+#include <limits>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/inflow_data_reader.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+using namespace dealii;
+
+template<int dim>
+InflowDataReader<dim>::InflowDataReader(InflowData<dim> const & inflow_data_in)
+  : inflow_data(inflow_data_in),
+    n_values(dim * inflow_data_in.n_points_y * inflow_data_in.n_points_z),
+    header_size(3 * sizeof(unsigned int)),
+    record_size((1 + n_values) * sizeof(double)),
+    interval(numbers::invalid_unsigned_int),
+    current_time(std::numeric_limits<double>::quiet_NaN())
+{
+  AssertThrow(inflow_data.array != nullptr && inflow_data.array->size() * dim == n_values,
+              ExcMessage("Size of inflow data array does not match the number of points."));
+
+  database.open(inflow_data.filename.c_str(), std::ios::binary);
+  AssertThrow(database.good(), ExcMessage("Could not open file " + inflow_data.filename + "."));
+
+  // check that the inflow database matches the inflow data
+  unsigned int header[3];
+  database.read(reinterpret_cast<char *>(&header[0]), sizeof(header));
+  AssertThrow(database.good() && header[0] == static_cast<unsigned int>(dim) &&
+                header[1] == inflow_data.n_points_y && header[2] == inflow_data.n_points_z,
+              ExcMessage("The inflow database " + inflow_data.filename +
+                         " does not match the specified inflow data."));
+
+  // read time stamps of all records
+  database.seekg(0, std::ios::end);
+  std::streamoff const file_size = database.tellg();
+  unsigned int const   n_records = (file_size - header_size) / record_size;
+
+  AssertThrow(n_records >= 2,
+              ExcMessage("The inflow database " + inflow_data.filename +
+                         " has to contain at least two records."));
+
+  times.resize(n_records);
+  for(unsigned int i = 0; i < n_records; ++i)
+  {
+    database.seekg(header_size + i * record_size);
+    database.read(reinterpret_cast<char *>(&times[i]), sizeof(double));
+  }
+
+  AssertThrow(std::is_sorted(times.begin(), times.end()),
+              ExcMessage("Records of the inflow database have to be sorted in time."));
+
+  values_begin.resize(n_values);
+  values_end.resize(n_values);
+}
+
+template<int dim>
+void
+InflowDataReader<dim>::read_record(unsigned int const index, std::vector<double> & values)
+{
+  database.seekg(header_size + index * record_size + sizeof(double));
+  database.read(reinterpret_cast<char *>(&values[0]), n_values * sizeof(double));
+
+  AssertThrow(database.good(), ExcMessage("Could not read file " + inflow_data.filename + "."));
+}
+
+template<int dim>
+void
+InflowDataReader<dim>::update(double const time)
+{
+  // nothing to do if the time has not changed
+  if(time == current_time)
+    return;
+
+  double const EPSILON = 1.e-10 * (times.back() - times.front());
+
+  AssertThrow(time > times.front() - EPSILON && time < times.back() + EPSILON,
+              ExcMessage("The inflow database " + inflow_data.filename +
+                         " does not cover time t = " + Utilities::to_string(time) + "."));
+
+  // find the interval [times[i], times[i+1]] containing time
+  unsigned int i = std::upper_bound(times.begin(), times.end(), time) - times.begin();
+  i              = std::min(std::max(i, 1u), static_cast<unsigned int>(times.size() - 1)) - 1;
+
+  // read records, reusing the previous record when moving forward by one interval
+  if(i != interval)
+  {
+    if(interval != numbers::invalid_unsigned_int && i == interval + 1)
+    {
+      values_begin.swap(values_end);
+    }
+    else
+    {
+      read_record(i, values_begin);
+    }
+
+    read_record(i + 1, values_end);
+
+    interval = i;
+  }
+
+  // linear interpolation in time
+  double const dt     = times[i + 1] - times[i];
+  double const weight = dt > 0.0 ? std::min(std::max((time - times[i]) / dt, 0.0), 1.0) : 0.0;
+
+  std::vector<Tensor<1, dim, double>> & array = *inflow_data.array;
+  for(unsigned int p = 0; p < array.size(); ++p)
+  {
+    for(unsigned int d = 0; d < dim; ++d)
+    {
+      unsigned int const index = p * dim + d;
+      array[p][d] = (1.0 - weight) * values_begin[index] + weight * values_end[index];
+    }
+  }
+
+  current_time = time;
+}
+
+template<int dim>
+double
+InflowDataReader<dim>::get_start_time() const
+{
+  return times.front();
+}
+
+template<int dim>
+double
+InflowDataReader<dim>::get_end_time() const
+{
+  return times.back();
+}
+
+template class InflowDataReader<2>;
+template class InflowDataReader<3>;
+
+} // namespace IncNS
+} // namespace ExaDG
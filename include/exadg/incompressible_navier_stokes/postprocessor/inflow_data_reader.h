@@ -0,0 +1,87 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_INFLOW_DATA_READER_H_
+#define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_INFLOW_DATA_READER_H_
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/inflow_data_calculator.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+using namespace dealii;
+
+/*
+ * Replays the inflow data recorded by InflowDataCalculator to an inflow database, i.e. the
+ * precursor domain does not have to be solved. The velocity values at a given time are obtained by
+ * linear interpolation in time between the two records enclosing this time and are written to the
+ * array of InflowData.
+ *
+ * Only the two records enclosing the current time are held in memory and the records are read on
+ * demand. Since no communication is involved, update() may be called independently on each
+ * process, e.g. when setting the time of the function describing the inflow boundary condition.
+ */
+template<int dim>
+class InflowDataReader
+{
+public:
+  InflowDataReader(InflowData<dim> const & inflow_data);
+
+  void
+  update(double const time);
+
+  double
+  get_start_time() const;
+
+  double
+  get_end_time() const;
+
+private:
+  void
+  read_record(unsigned int const index, std::vector<double> & values);
+
+  InflowData<dim> inflow_data;
+
+  std::ifstream database;
+
+  // number of values per record
+  unsigned int n_values;
+
+  // size of header and records in bytes
+  std::streamoff header_size, record_size;
+
+  // time stamps of all records
+  std::vector<double> times;
+
+  // the interval [times[interval], times[interval+1]] whose records are currently held in memory
+  unsigned int        interval;
+  std::vector<double> values_begin, values_end;
+
+  double current_time;
+};
+
+} // namespace IncNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_INFLOW_DATA_READER_H_ */
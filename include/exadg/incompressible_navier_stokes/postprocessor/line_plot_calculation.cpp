@@ -48,6 +48,28 @@ LinePlotCalculator<dim, Number>::setup(DoFHandler<dim> const & dof_handler_veloc
   dof_handler_pressure = &dof_handler_pressure_in;
   mapping              = &mapping_in;
   data                 = line_plot_data_in;
+
+  if(data.calculate == true)
+  {
+    unsigned int const n_lines = data.line_data.lines.size();
+
+    points.resize(n_lines);
+    velocity_evaluator.resize(n_lines);
+    pressure_evaluator.resize(n_lines);
+
+    for(unsigned int l = 0; l < n_lines; ++l)
+    {
+      Line<dim> const & line = *data.line_data.lines[l];
+
+      // we consider straight lines with an equidistant distribution of points along the line
+      points[l].resize(line.n_points);
+      for(unsigned int i = 0; i < line.n_points; ++i)
+        points[l][i] = line.begin + double(i) / double(line.n_points - 1) * (line.end - line.begin);
+
+      velocity_evaluator[l].setup(*dof_handler_velocity, *mapping, points[l], mpi_comm);
+      pressure_evaluator[l].setup(*dof_handler_pressure, *mapping, points[l], mpi_comm);
+    }
+  }
 }
 
 template<int dim, typename Number>
@@ -61,41 +83,27 @@ LinePlotCalculator<dim, Number>::evaluate(VectorType const & velocity,
     unsigned int const precision = data.line_data.precision;
 
     // loop over all lines
-    for(typename std::vector<std::shared_ptr<Line<dim>>>::const_iterator line =
-          data.line_data.lines.begin();
-        line != data.line_data.lines.end();
-        ++line)
+    for(unsigned int l = 0; l < data.line_data.lines.size(); ++l)
     {
-      // store all points along current line in a vector
-      unsigned int            n_points = (*line)->n_points;
-      std::vector<Point<dim>> points(n_points);
+      Line<dim> const & line = *data.line_data.lines[l];
 
-      // we consider straight lines with an equidistant distribution of points along the line
-      for(unsigned int i = 0; i < n_points; ++i)
-        points[i] =
-          (*line)->begin + double(i) / double(n_points - 1) * ((*line)->end - (*line)->begin);
+      // points along current line
+      unsigned int const              n_points = line.n_points;
+      std::vector<Point<dim>> const & points   = this->points[l];
 
       // filename prefix for current line
-      std::string filename_prefix = data.line_data.directory + (*line)->name;
+      std::string filename_prefix = data.line_data.directory + line.name;
 
       // write output for all specified quantities
-      for(std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-            (*line)->quantities.begin();
-          quantity != (*line)->quantities.end();
+      for(std::vector<std::shared_ptr<Quantity>>::const_iterator quantity = line.quantities.begin();
+          quantity != line.quantities.end();
           ++quantity)
       {
         if((*quantity)->type == QuantityType::Velocity)
         {
-          std::vector<Tensor<1, dim, Number>> solution_vector(n_points);
-
           // calculate velocity for all points along line
-          for(unsigned int i = 0; i < n_points; ++i)
-          {
-            Tensor<1, dim, Number> u;
-            evaluate_vectorial_quantity_in_point(
-              u, *dof_handler_velocity, *mapping, velocity, points[i], mpi_comm);
-            solution_vector[i] = u;
-          }
+          std::vector<Tensor<1, dim, Number>> solution_vector;
+          velocity_evaluator[l].evaluate_vectorial(solution_vector, velocity);
 
           // write output to file
           if(Utilities::MPI::this_mpi_process(mpi_comm) == 0)
@@ -137,16 +145,9 @@ LinePlotCalculator<dim, Number>::evaluate(VectorType const & velocity,
         }
         else if((*quantity)->type == QuantityType::Pressure)
         {
-          std::vector<Number> solution_vector(n_points);
-
           // calculate pressure for all points along line
-          for(unsigned int i = 0; i < n_points; ++i)
-          {
-            Number p;
-            evaluate_scalar_quantity_in_point(
-              p, *dof_handler_pressure, *mapping, pressure, points[i], mpi_comm);
-            solution_vector[i] = p;
-          }
+          std::vector<Number> solution_vector;
+          pressure_evaluator[l].evaluate_scalar(solution_vector, pressure);
 
           // write output to file
           if(Utilities::MPI::this_mpi_process(mpi_comm) == 0)
@@ -39,6 +39,8 @@ using namespace dealii;
  *   - straight lines, points are distributed equidistantly along the line
  *
  *   - no statistical averaging, instantaneous quantities are calculated
+ *
+ *   - the points are located only once, i.e., the mesh is assumed to be fixed
  */
 template<int dim, typename Number>
 class LinePlotCalculator
@@ -67,6 +69,11 @@ private:
   SmartPointer<Mapping<dim> const>    mapping;
 
   LinePlotDataInstantaneous<dim> data;
+
+  // points along the lines and cached point evaluation for velocity and pressure (one per line)
+  std::vector<std::vector<Point<dim>>>      points;
+  std::vector<PointValueCache<dim, Number>> velocity_evaluator;
+  std::vector<PointValueCache<dim, Number>> pressure_evaluator;
 };
 
 } // namespace IncNS
@@ -392,44 +392,54 @@ OutputGenerator<dim, Number>::calculate_additional_fields(VectorType const & vel
 {
   if(output_data.write_output)
   {
+    // all derived quantities written in this output step are computed in one loop over all cells
+    std::vector<VectorType *>    derived_quantities;
+    std::vector<DerivedQuantity> quantity_types;
+
     bool vorticity_is_up_to_date = false;
     if(output_data.write_vorticity == true)
     {
-      navier_stokes_operator->compute_vorticity(vorticity, velocity);
+      derived_quantities.push_back(&vorticity);
+      quantity_types.push_back(DerivedQuantity::Vorticity);
       vorticity_is_up_to_date = true;
     }
 
     if(output_data.write_divergence == true)
     {
-      navier_stokes_operator->compute_divergence(divergence, velocity);
+      derived_quantities.push_back(&divergence);
+      quantity_types.push_back(DerivedQuantity::Divergence);
     }
 
     if(output_data.write_velocity_magnitude == true)
     {
-      navier_stokes_operator->compute_velocity_magnitude(velocity_magnitude, velocity);
+      derived_quantities.push_back(&velocity_magnitude);
+      quantity_types.push_back(DerivedQuantity::VelocityMagnitude);
     }
 
     if(output_data.write_vorticity_magnitude == true)
     {
-      AssertThrow(vorticity_is_up_to_date == true,
-                  ExcMessage("Vorticity vector needs to be updated to compute its magnitude."));
+      derived_quantities.push_back(&vorticity_magnitude);
+      quantity_types.push_back(DerivedQuantity::VorticityMagnitude);
+    }
 
-      navier_stokes_operator->compute_vorticity_magnitude(vorticity_magnitude, vorticity);
+    if(output_data.write_q_criterion == true)
+    {
+      derived_quantities.push_back(&q_criterion);
+      quantity_types.push_back(DerivedQuantity::QCriterion);
     }
 
+    navier_stokes_operator->compute_derived_quantities(derived_quantities,
+                                                       quantity_types,
+                                                       velocity);
+
     if(output_data.write_streamfunction == true)
     {
       AssertThrow(vorticity_is_up_to_date == true,
-                  ExcMessage("Vorticity vector needs to be updated to compute its magnitude."));
+                  ExcMessage("Vorticity vector needs to be updated to compute streamfunction."));
 
       navier_stokes_operator->compute_streamfunction(streamfunction, vorticity);
     }
 
-    if(output_data.write_q_criterion == true)
-    {
-      navier_stokes_operator->compute_q_criterion(q_criterion, velocity);
-    }
-
     if(output_data.mean_velocity.calculate == true)
     {
       if(time_step_number >= 0) // unsteady problems
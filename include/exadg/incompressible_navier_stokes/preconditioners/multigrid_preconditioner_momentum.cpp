@@ -79,6 +79,13 @@ MultigridPreconditioner<dim, Number>::initialize(MultigridData const &
     AssertThrow(false, ExcMessage("Not implemented."));
   }
 
+  // The turbulent viscosity is not available on the multigrid levels, which therefore use the
+  // constant (laminar) viscosity. The wall model only contributes to the inhomogeneous part of
+  // the viscous operator.
+  data.viscous_kernel_data.viscosity_is_variable          = false;
+  data.viscous_kernel_data.turbulent_viscosity_on_the_fly = false;
+  data.viscous_kernel_data.use_wall_model                 = false;
+
   Base::initialize(
     mg_data, tria, fe, mapping, false /*operator_is_singular*/, dirichlet_bc, periodic_face_pairs);
 }
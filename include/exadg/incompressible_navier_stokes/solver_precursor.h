@@ -27,6 +27,7 @@
 
 // ExaDG
 #include <exadg/configuration/config.h>
+#include <exadg/incompressible_navier_stokes/driver.h>
 #include <exadg/incompressible_navier_stokes/driver_precursor.h>
 #include <exadg/utilities/general_parameters.h>
 
@@ -113,17 +114,33 @@ run(std::string const & input_file,
   Timer timer;
   timer.restart();
 
-  std::shared_ptr<IncNS::DriverPrecursor<dim, Number>> driver;
-  driver.reset(new IncNS::DriverPrecursor<dim, Number>(mpi_comm));
-
   std::shared_ptr<IncNS::ApplicationBasePrecursor<dim, Number>> application =
     get_application<dim, Number>(input_file);
 
-  driver->setup(application, degree, refine_space, is_test);
+  if(application->precursor_is_active())
+  {
+    std::shared_ptr<IncNS::DriverPrecursor<dim, Number>> driver;
+    driver.reset(new IncNS::DriverPrecursor<dim, Number>(mpi_comm));
+
+    driver->setup(application, degree, refine_space, is_test);
+
+    driver->solve();
+
+    driver->print_performance_results(timer.wall_time(), is_test);
+  }
+  else
+  {
+    // the inflow data is replayed from an inflow database so that the precursor domain does not
+    // have to be solved
+    std::shared_ptr<IncNS::Driver<dim, Number>> driver;
+    driver.reset(new IncNS::Driver<dim, Number>(mpi_comm));
 
-  driver->solve();
+    driver->setup(application, degree, refine_space, 0 /* refine_time */, is_test, false);
 
-  driver->print_performance_results(timer.wall_time(), is_test);
+    driver->solve();
+
+    driver->print_performance_results(timer.wall_time(), is_test);
+  }
 }
 } // namespace ExaDG
 
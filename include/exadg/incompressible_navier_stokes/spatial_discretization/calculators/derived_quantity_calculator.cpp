@@ -0,0 +1,168 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <exadg/incompressible_navier_stokes/spatial_discretization/calculators/derived_quantity_calculator.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+using namespace dealii;
+
+template<int dim, typename Number>
+DerivedQuantityCalculator<dim, Number>::DerivedQuantityCalculator()
+  : matrix_free(nullptr), dof_index_u(0), dof_index_u_scalar(0), quad_index(0)
+{
+}
+
+template<int dim, typename Number>
+void
+DerivedQuantityCalculator<dim, Number>::initialize(MatrixFree<dim, Number> const & matrix_free_in,
+                                                   unsigned int const dof_index_u_in,
+                                                   unsigned int const dof_index_u_scalar_in,
+                                                   unsigned int const quad_index_in)
+{
+  matrix_free        = &matrix_free_in;
+  dof_index_u        = dof_index_u_in;
+  dof_index_u_scalar = dof_index_u_scalar_in;
+  quad_index         = quad_index_in;
+}
+
+template<int dim, typename Number>
+void
+DerivedQuantityCalculator<dim, Number>::compute(std::vector<VectorType *> const &    dst,
+                                                std::vector<DerivedQuantity> const & quantities,
+                                                VectorType const &                   src) const
+{
+  AssertThrow(dst.size() == quantities.size(),
+              ExcMessage("The number of vectors does not match the number of quantities."));
+
+  if(quantities.empty())
+    return;
+
+  this->quantities = quantities;
+
+  std::vector<VectorType *> dst_vectors(dst);
+  for(auto vector : dst_vectors)
+    *vector = 0;
+
+  matrix_free->cell_loop(&This::cell_loop, this, dst_vectors, src);
+}
+
+template<int dim, typename Number>
+void
+DerivedQuantityCalculator<dim, Number>::cell_loop(MatrixFree<dim, Number> const & matrix_free,
+                                                  std::vector<VectorType *> &     dst,
+                                                  VectorType const &              src,
+                                                  Range const &                   cell_range) const
+{
+  bool evaluate_values = false, evaluate_gradients = false;
+  for(auto const & quantity : quantities)
+  {
+    if(quantity == DerivedQuantity::VelocityMagnitude)
+      evaluate_values = true;
+    else
+      evaluate_gradients = true;
+  }
+
+  CellIntegratorVector integrator_velocity(matrix_free, dof_index_u, quad_index);
+  CellIntegratorVector integrator_vector(matrix_free, dof_index_u, quad_index);
+  CellIntegratorScalar integrator_scalar(matrix_free, dof_index_u_scalar, quad_index);
+
+  for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+  {
+    // evaluate velocity only once for all quantities
+    integrator_velocity.reinit(cell);
+    integrator_velocity.gather_evaluate(src, evaluate_values, evaluate_gradients);
+
+    for(unsigned int i = 0; i < quantities.size(); ++i)
+    {
+      if(quantities[i] == DerivedQuantity::Vorticity)
+      {
+        integrator_vector.reinit(cell);
+
+        for(unsigned int q = 0; q < integrator_vector.n_q_points; ++q)
+          integrator_vector.submit_value(calculate_vorticity(integrator_velocity.get_gradient(q)),
+                                         q);
+
+        integrator_vector.integrate_scatter(true, false, *dst[i]);
+      }
+      else
+      {
+        integrator_scalar.reinit(cell);
+
+        for(unsigned int q = 0; q < integrator_scalar.n_q_points; ++q)
+        {
+          scalar value;
+
+          if(quantities[i] == DerivedQuantity::VelocityMagnitude)
+          {
+            value = integrator_velocity.get_value(q).norm();
+          }
+          else
+          {
+            tensor const gradu = integrator_velocity.get_gradient(q);
+
+            if(quantities[i] == DerivedQuantity::Divergence)
+            {
+              value = trace(gradu);
+            }
+            else if(quantities[i] == DerivedQuantity::VorticityMagnitude)
+            {
+              value = calculate_vorticity(gradu).norm();
+            }
+            else if(quantities[i] == DerivedQuantity::QCriterion)
+            {
+              tensor Om, S;
+              for(unsigned int d = 0; d < dim; d++)
+              {
+                for(unsigned int e = 0; e < dim; e++)
+                {
+                  Om[d][e] = 0.5 * (gradu[d][e] - gradu[e][d]);
+                  S[d][e]  = 0.5 * (gradu[d][e] + gradu[e][d]);
+                }
+              }
+
+              value = 0.5 * (Om.norm_square() - S.norm_square());
+            }
+            else
+            {
+              AssertThrow(false, ExcMessage("Not implemented."));
+            }
+          }
+
+          integrator_scalar.submit_value(value, q);
+        }
+
+        integrator_scalar.integrate_scatter(true, false, *dst[i]);
+      }
+    }
+  }
+}
+
+template class DerivedQuantityCalculator<2, float>;
+template class DerivedQuantityCalculator<2, double>;
+
+template class DerivedQuantityCalculator<3, float>;
+template class DerivedQuantityCalculator<3, double>;
+
+} // namespace IncNS
+} // namespace ExaDG
@@ -0,0 +1,132 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_CALCULATORS_DERIVED_QUANTITY_CALCULATOR_H_
+#define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_CALCULATORS_DERIVED_QUANTITY_CALCULATOR_H_
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/matrix_free/integrators.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+using namespace dealii;
+
+enum class DerivedQuantity
+{
+  Vorticity,          // vectorial quantity
+  Divergence,         // scalar quantity
+  VelocityMagnitude,  // scalar quantity
+  VorticityMagnitude, // scalar quantity
+  QCriterion          // scalar quantity
+};
+
+/*
+ *  Computes the right-hand side vectors of the L2-projections of several quantities derived from
+ *  the velocity field in a single cell loop, i.e., the velocity (and its gradient) is evaluated
+ *  only once per cell for all quantities. The inverse mass operator has to be applied to the
+ *  resulting vectors.
+ */
+template<int dim, typename Number>
+class DerivedQuantityCalculator
+{
+private:
+  typedef DerivedQuantityCalculator<dim, Number> This;
+
+  typedef LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef VectorizedArray<Number>                 scalar;
+  typedef Tensor<1, dim, VectorizedArray<Number>> vector;
+  typedef Tensor<2, dim, VectorizedArray<Number>> tensor;
+
+  typedef std::pair<unsigned int, unsigned int> Range;
+
+  typedef CellIntegrator<dim, dim, Number> CellIntegratorVector;
+  typedef CellIntegrator<dim, 1, Number>   CellIntegratorScalar;
+
+public:
+  DerivedQuantityCalculator();
+
+  void
+  initialize(MatrixFree<dim, Number> const & matrix_free_in,
+             unsigned int const              dof_index_u_in,
+             unsigned int const              dof_index_u_scalar_in,
+             unsigned int const              quad_index_in);
+
+  /*
+   *  dst[i] is the vector of quantities[i]. Vectorial quantities require vectors of the velocity
+   *  space, scalar quantities vectors of the scalar velocity space.
+   */
+  void
+  compute(std::vector<VectorType *> const &    dst,
+          std::vector<DerivedQuantity> const & quantities,
+          VectorType const &                   src) const;
+
+private:
+  void
+  cell_loop(MatrixFree<dim, Number> const & matrix_free,
+            std::vector<VectorType *> &     dst,
+            VectorType const &              src,
+            Range const &                   cell_range) const;
+
+  /*
+   *  omega is a scalar quantity in 2D and a vector with dim components in 3D. In 2D, omega is
+   *  stored in the first component of the returned vector, and the second component is zero.
+   */
+  static inline DEAL_II_ALWAYS_INLINE //
+    vector
+    calculate_vorticity(tensor const & gradu)
+  {
+    vector omega;
+
+    if(dim == 2)
+    {
+      omega[0] = gradu[1][0] - gradu[0][1];
+    }
+    else if(dim == 3)
+    {
+      omega[0]       = gradu[dim - 1][1] - gradu[1][dim - 1];
+      omega[1]       = gradu[0][dim - 1] - gradu[dim - 1][0];
+      omega[dim - 1] = gradu[1][0] - gradu[0][1];
+    }
+
+    return omega;
+  }
+
+  MatrixFree<dim, Number> const * matrix_free;
+
+  unsigned int dof_index_u;
+  unsigned int dof_index_u_scalar;
+  unsigned int quad_index;
+
+  // quantities computed in the current call of compute()
+  mutable std::vector<DerivedQuantity> quantities;
+};
+
+} // namespace IncNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_CALCULATORS_DERIVED_QUANTITY_CALCULATOR_H_ \
+        */
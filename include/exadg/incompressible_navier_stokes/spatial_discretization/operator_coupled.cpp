@@ -301,9 +301,14 @@ OperatorCoupled<dim, Number>::evaluate_nonlinear_residual(BlockVectorType &
   // velocity-block
 
   if(this->unsteady_problem_has_to_be_solved())
+  {
     this->mass_operator.apply_scale(dst.block(0), scaling_factor_mass, src.block(0));
+    this->apply_local_time_step_scaling(dst.block(0));
+  }
   else
+  {
     dst.block(0) = 0.0;
+  }
 
   AssertThrow(this->param.convective_problem() == true, ExcMessage("Invalid parameters."));
 
@@ -481,6 +486,9 @@ OperatorCoupled<dim, Number>::setup_multigrid_preconditioner_momentum()
     dynamic_cast<parallel::TriangulationBase<dim> const *>(&dof_handler.get_triangulation());
   FiniteElement<dim> const & fe = dof_handler.get_fe();
 
+  if(this->param.use_dof_renumbering)
+    mg_preconditioner->set_dof_numbering_fine_level(dof_handler);
+
   mg_preconditioner->initialize(this->param.multigrid_data_velocity_block,
                                 tria,
                                 fe,
@@ -612,6 +620,9 @@ OperatorCoupled<dim, Number>::setup_multigrid_preconditioner_schur_complement()
     dynamic_cast<const parallel::TriangulationBase<dim> *>(&dof_handler.get_triangulation());
   const FiniteElement<dim> & fe = dof_handler.get_fe();
 
+  if(this->param.use_dof_renumbering)
+    mg_preconditioner->set_dof_numbering_fine_level(dof_handler);
+
   mg_preconditioner->initialize(mg_data,
                                 tria,
                                 fe,
@@ -52,7 +52,8 @@ OperatorDualSplitting<dim, Number>::OperatorDualSplitting(
                    field_functions_in,
                    parameters_in,
                    field_in,
-                   mpi_comm_in)
+                   mpi_comm_in),
+    rhs_ppe_data(nullptr)
 {
 }
 
@@ -129,6 +130,9 @@ OperatorDualSplitting<dim, Number>::initialize_helmholtz_preconditioner()
 
     const FiniteElement<dim> & fe = dof_handler.get_fe();
 
+    if(this->param.use_dof_renumbering)
+      mg_preconditioner->set_dof_numbering_fine_level(dof_handler);
+
     mg_preconditioner->initialize(this->param.multigrid_data_viscous,
                                   tria,
                                   fe,
@@ -235,79 +239,6 @@ OperatorDualSplitting<dim, Number>::rhs_velocity_divergence_term(
   this->divergence_operator.rhs(dst, evaluation_time);
 }
 
-template<int dim, typename Number>
-void
-OperatorDualSplitting<dim, Number>::rhs_ppe_div_term_body_forces_add(VectorType &   dst,
-                                                                     double const & time)
-{
-  this->evaluation_time = time;
-
-  VectorType src_dummy;
-  this->get_matrix_free().loop(&This::cell_loop_empty,
-                               &This::face_loop_empty,
-                               &This::local_rhs_ppe_div_term_body_forces_boundary_face,
-                               this,
-                               dst,
-                               src_dummy);
-}
-
-template<int dim, typename Number>
-void
-OperatorDualSplitting<dim, Number>::local_rhs_ppe_div_term_body_forces_boundary_face(
-  MatrixFree<dim, Number> const & matrix_free,
-  VectorType &                    dst,
-  VectorType const &,
-  Range const & face_range) const
-{
-  unsigned int dof_index_pressure  = this->get_dof_index_pressure();
-  unsigned int quad_index_pressure = this->get_quad_index_pressure();
-
-  FaceIntegratorP integrator(matrix_free, true, dof_index_pressure, quad_index_pressure);
-
-  for(unsigned int face = face_range.first; face < face_range.second; face++)
-  {
-    integrator.reinit(face);
-
-    BoundaryTypeU boundary_type =
-      this->boundary_descriptor_velocity->get_boundary_type(matrix_free.get_boundary_id(face));
-
-    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
-    {
-      if(boundary_type == BoundaryTypeU::Dirichlet ||
-         boundary_type == BoundaryTypeU::DirichletMortar)
-      {
-        Point<dim, scalar> q_points = integrator.quadrature_point(q);
-
-        // evaluate right-hand side
-        vector rhs =
-          FunctionEvaluator<1, dim, Number>::value(this->field_functions->right_hand_side,
-                                                   q_points,
-                                                   this->evaluation_time);
-
-        scalar flux_times_normal = rhs * integrator.get_normal_vector(q);
-        // minus sign is introduced here which allows to call a function of type ...add()
-        // and avoids a scaling of the resulting vector by the factor -1.0
-        integrator.submit_value(-flux_times_normal, q);
-      }
-      else if(boundary_type == BoundaryTypeU::Neumann || boundary_type == BoundaryTypeU::Symmetry)
-      {
-        // Do nothing on Neumann and symmetry boundaries.
-        // Remark: On symmetry boundaries it follows from g_u * n = 0 that also g_{u_hat} * n = 0.
-        // Hence, a symmetry boundary for u is also a symmetry boundary for u_hat. Hence, there
-        // are no inhomogeneous contributions on symmetry boundaries.
-        scalar zero = make_vectorized_array<Number>(0.0);
-        integrator.submit_value(zero, q);
-      }
-      else
-      {
-        AssertThrow(false, ExcMessage("Boundary type of face is invalid or not implemented."));
-      }
-    }
-    integrator.integrate(true, false);
-    integrator.distribute_local_to_global(dst);
-  }
-}
-
 template<int dim, typename Number>
 void
 OperatorDualSplitting<dim, Number>::rhs_velocity_divergence_term_dirichlet_bc_from_dof_vector(
@@ -319,469 +250,460 @@ OperatorDualSplitting<dim, Number>::rhs_velocity_divergence_term_dirichlet_bc_fr
 
 template<int dim, typename Number>
 void
-OperatorDualSplitting<dim, Number>::rhs_ppe_div_term_convective_term_add(
-  VectorType &       dst,
-  VectorType const & src) const
+OperatorDualSplitting<dim, Number>::rhs_ppe(VectorType &                   dst,
+                                            RhsPPEData<VectorType> const & data) const
 {
-  this->get_matrix_free().loop(&This::cell_loop_empty,
-                               &This::face_loop_empty,
-                               &This::local_rhs_ppe_div_term_convective_term_boundary_face,
+  AssertThrow(data.factors_div_term_convective.size() == data.velocities.size() &&
+                data.factors_nbc_convective.size() == data.velocities.size(),
+              ExcMessage("Number of factors does not match number of velocity vectors."));
+
+  AssertThrow(data.times_div_term_dirichlet.size() == data.factors_div_term_dirichlet.size() ||
+                data.velocities_div_term_dirichlet.size() == data.factors_div_term_dirichlet.size(),
+              ExcMessage("Number of factors does not match number of Dirichlet boundary data."));
+
+  rhs_ppe_data = &data;
+
+  if(data.laplace_dirichlet)
+    this->laplace_operator.set_time(data.time);
+
+  /*
+   * All terms are evaluated in one loop so that the right-hand side vector is written only once.
+   * Compared to the evaluation of the individual terms in separate loops, the result is equal up
+   * to round-off errors but not bitwise identical: the factors of the individual terms are applied
+   * to the cell-local integrals instead of the global vectors, and the contributions are summed up
+   * in the cell-local dof values in a different order than when adding global vectors.
+   */
+  VectorType src_dummy;
+  this->get_matrix_free().loop(&This::local_rhs_ppe_cell,
+                               &This::local_rhs_ppe_face,
+                               &This::local_rhs_ppe_boundary_face,
                                this,
                                dst,
-                               src);
+                               data.velocity_np != nullptr ? *data.velocity_np : src_dummy,
+                               true /*zero_dst_vector = true*/);
+
+  rhs_ppe_data = nullptr;
 }
 
 template<int dim, typename Number>
 void
-OperatorDualSplitting<dim, Number>::local_rhs_ppe_div_term_convective_term_boundary_face(
+OperatorDualSplitting<dim, Number>::local_rhs_ppe_cell(
   MatrixFree<dim, Number> const & matrix_free,
   VectorType &                    dst,
   VectorType const &              src,
-  Range const &                   face_range) const
+  Range const &                   cell_range) const
 {
-  unsigned int const dof_index_velocity = this->get_dof_index_velocity();
-  unsigned int const dof_index_pressure = this->get_dof_index_pressure();
-  unsigned int const quad_index         = this->get_quad_index_velocity_nonlinear();
+  RhsPPEData<VectorType> const & data = *rhs_ppe_data;
 
-  FaceIntegratorU velocity(matrix_free, true, dof_index_velocity, quad_index);
-  FaceIntegratorP pressure(matrix_free, true, dof_index_pressure, quad_index);
+  if(data.velocity_np == nullptr)
+    return;
 
-  FaceIntegratorU grid_velocity(matrix_free, true, dof_index_velocity, quad_index);
+  DivergenceOperatorData<dim> const & div_data = this->divergence_operator.get_operator_data();
 
-  for(unsigned int face = face_range.first; face < face_range.second; face++)
+  CellIntegratorU velocity(matrix_free, div_data.dof_index_velocity, div_data.quad_index);
+  CellIntegratorP pressure(matrix_free, div_data.dof_index_pressure, div_data.quad_index);
+
+  bool const weak = div_data.integration_by_parts == true &&
+                    div_data.formulation == FormulationVelocityDivergenceTerm::Weak;
+
+  for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
   {
-    velocity.reinit(face);
-    velocity.gather_evaluate(src, true, true);
+    pressure.reinit(cell);
+    velocity.reinit(cell);
 
-    if(this->param.ale_formulation && this->param.store_previous_boundary_values)
+    if(weak)
     {
-      grid_velocity.reinit(face);
-      grid_velocity.gather_evaluate(this->convective_kernel->get_grid_velocity(), true, false);
+      velocity.gather_evaluate(src, true, false, false);
+      this->divergence_operator.do_cell_integral_weak(pressure, velocity);
+      pressure.integrate(false, true);
     }
-
-    pressure.reinit(face);
-
-    BoundaryTypeU boundary_type =
-      this->boundary_descriptor_velocity->get_boundary_type(matrix_free.get_boundary_id(face));
-
-    for(unsigned int q = 0; q < pressure.n_q_points; ++q)
+    else
     {
-      if(boundary_type == BoundaryTypeU::Dirichlet ||
-         boundary_type == BoundaryTypeU::DirichletMortar)
-      {
-        vector normal = pressure.get_normal_vector(q);
-
-        vector u      = velocity.get_value(q);
-        tensor grad_u = velocity.get_gradient(q);
-
-        vector flux;
-        if(this->param.formulation_convective_term_bc ==
-           FormulationConvectiveTerm::DivergenceFormulation)
-        {
-          scalar div_u = velocity.get_divergence(q);
-          flux         = grad_u * u + div_u * u;
-        }
-        else if(this->param.formulation_convective_term_bc ==
-                FormulationConvectiveTerm::ConvectiveFormulation)
-        {
-          flux = grad_u * u;
-        }
-        else
-        {
-          AssertThrow(false, ExcMessage("Not implemented."));
-        }
-
-        if(this->param.ale_formulation && this->param.store_previous_boundary_values)
-        {
-          flux -= grad_u * grid_velocity.get_value(q);
-        }
+      velocity.gather_evaluate(src, false, true, false);
+      this->divergence_operator.do_cell_integral_strong(pressure, velocity);
+      pressure.integrate(true, false);
+    }
 
-        scalar flux_times_normal = flux * normal;
+    for(unsigned int i = 0; i < pressure.dofs_per_cell; ++i)
+      pressure.begin_dof_values()[i] *= Number(data.factor_div_term);
 
-        pressure.submit_value(flux_times_normal, q);
-      }
-      else if(boundary_type == BoundaryTypeU::Neumann || boundary_type == BoundaryTypeU::Symmetry)
-      {
-        // Do nothing on Neumann and symmetry boundaries.
-        // Remark: On symmetry boundaries it follows from g_u * n = 0 that also g_{u_hat} * n = 0.
-        // Hence, a symmetry boundary for u is also a symmetry boundary for u_hat. Hence, there
-        // are no inhomogeneous contributions on symmetry boundaries.
-        scalar zero = make_vectorized_array<Number>(0.0);
-        pressure.submit_value(zero, q);
-      }
-      else
-      {
-        AssertThrow(false, ExcMessage("Boundary type of face is invalid or not implemented."));
-      }
-    }
-    pressure.integrate_scatter(true, false, dst);
+    pressure.distribute_local_to_global(dst);
   }
 }
 
 template<int dim, typename Number>
 void
-OperatorDualSplitting<dim, Number>::rhs_ppe_nbc_analytical_time_derivative_add(VectorType &   dst,
-                                                                               double const & time)
+OperatorDualSplitting<dim, Number>::local_rhs_ppe_face(
+  MatrixFree<dim, Number> const & matrix_free,
+  VectorType &                    dst,
+  VectorType const &              src,
+  Range const &                   face_range) const
 {
-  this->evaluation_time = time;
+  RhsPPEData<VectorType> const & data = *rhs_ppe_data;
 
-  VectorType src_dummy;
-  this->get_matrix_free().loop(
-    &This::cell_loop_empty,
-    &This::face_loop_empty,
-    &This::local_rhs_ppe_nbc_analytical_time_derivative_add_boundary_face,
-    this,
-    dst,
-    src_dummy);
-}
+  DivergenceOperatorData<dim> const & div_data = this->divergence_operator.get_operator_data();
 
-template<int dim, typename Number>
-void
-OperatorDualSplitting<dim, Number>::local_rhs_ppe_nbc_analytical_time_derivative_add_boundary_face(
-  MatrixFree<dim, Number> const & data,
-  VectorType &                    dst,
-  VectorType const &,
-  Range const & face_range) const
-{
-  unsigned int dof_index_pressure  = this->get_dof_index_pressure();
-  unsigned int quad_index_pressure = this->get_quad_index_pressure();
+  if(data.velocity_np == nullptr || div_data.integration_by_parts == false)
+    return;
 
-  FaceIntegratorP integrator(data, true, dof_index_pressure, quad_index_pressure);
+  FaceIntegratorU velocity_m(matrix_free, true, div_data.dof_index_velocity, div_data.quad_index);
+  FaceIntegratorU velocity_p(matrix_free, false, div_data.dof_index_velocity, div_data.quad_index);
+
+  FaceIntegratorP pressure_m(matrix_free, true, div_data.dof_index_pressure, div_data.quad_index);
+  FaceIntegratorP pressure_p(matrix_free, false, div_data.dof_index_pressure, div_data.quad_index);
 
   for(unsigned int face = face_range.first; face < face_range.second; face++)
   {
-    integrator.reinit(face);
+    pressure_m.reinit(face);
+    pressure_p.reinit(face);
 
-    types::boundary_id boundary_id = data.get_boundary_id(face);
-    BoundaryTypeP      boundary_type =
-      this->boundary_descriptor_pressure->get_boundary_type(boundary_id);
-
-    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
-    {
-      if(boundary_type == BoundaryTypeP::Neumann)
-      {
-        Point<dim, scalar> q_points = integrator.quadrature_point(q);
+    velocity_m.reinit(face);
+    velocity_p.reinit(face);
 
-        // evaluate boundary condition
-        typename std::map<types::boundary_id, std::shared_ptr<Function<dim>>>::iterator it =
-          this->boundary_descriptor_pressure->neumann_bc.find(boundary_id);
-        vector dudt =
-          FunctionEvaluator<1, dim, Number>::value(it->second, q_points, this->evaluation_time);
+    velocity_m.gather_evaluate(src, true, false);
+    velocity_p.gather_evaluate(src, true, false);
 
-        vector normal = integrator.get_normal_vector(q);
+    this->divergence_operator.do_face_integral(velocity_m, velocity_p, pressure_m, pressure_p);
 
-        scalar h = -normal * dudt;
+    pressure_m.integrate(true, false);
+    pressure_p.integrate(true, false);
 
-        integrator.submit_value(h, q);
-      }
-      else if(boundary_type == BoundaryTypeP::Dirichlet)
-      {
-        scalar zero = make_vectorized_array<Number>(0.0);
-        integrator.submit_value(zero, q);
-      }
-      else
-      {
-        AssertThrow(false, ExcMessage("Boundary type of face is invalid or not implemented."));
-      }
+    for(unsigned int i = 0; i < pressure_m.dofs_per_cell; ++i)
+    {
+      pressure_m.begin_dof_values()[i] *= Number(data.factor_div_term);
+      pressure_p.begin_dof_values()[i] *= Number(data.factor_div_term);
     }
-    integrator.integrate(true, false);
-    integrator.distribute_local_to_global(dst);
-  }
-}
 
-template<int dim, typename Number>
-void
-OperatorDualSplitting<dim, Number>::rhs_ppe_nbc_numerical_time_derivative_add(
-  VectorType &       dst,
-  VectorType const & acceleration)
-{
-  this->get_matrix_free().loop(&This::cell_loop_empty,
-                               &This::face_loop_empty,
-                               &This::local_rhs_ppe_nbc_numerical_time_derivative_add_boundary_face,
-                               this,
-                               dst,
-                               acceleration);
+    pressure_m.distribute_local_to_global(dst);
+    pressure_p.distribute_local_to_global(dst);
+  }
 }
 
 template<int dim, typename Number>
 void
-OperatorDualSplitting<dim, Number>::local_rhs_ppe_nbc_numerical_time_derivative_add_boundary_face(
-  MatrixFree<dim, Number> const & data,
+OperatorDualSplitting<dim, Number>::local_rhs_ppe_boundary_face(
+  MatrixFree<dim, Number> const & matrix_free,
   VectorType &                    dst,
-  VectorType const &              acceleration,
+  VectorType const &              src,
   Range const &                   face_range) const
 {
-  unsigned int dof_index_velocity  = this->get_dof_index_velocity();
-  unsigned int dof_index_pressure  = this->get_dof_index_pressure();
-  unsigned int quad_index_velocity = this->get_quad_index_velocity_linear();
+  RhsPPEData<VectorType> const & data = *rhs_ppe_data;
 
-  FaceIntegratorU integrator_velocity(data, true, dof_index_velocity, quad_index_velocity);
-  FaceIntegratorP integrator_pressure(data, true, dof_index_pressure, quad_index_velocity);
+  unsigned int const dof_index_velocity = this->get_dof_index_velocity();
+  unsigned int const dof_index_pressure = this->get_dof_index_pressure();
+
+  // The individual terms are integrated with different quadrature rules: the convective terms
+  // with the quadrature rule for nonlinear terms, the terms evaluated from analytical functions
+  // with the pressure quadrature rule, and the terms evaluated from dof vectors with the linear
+  // velocity quadrature rule. The contributions of all terms are summed up in the cell-local
+  // dof values and written into the global vector once per face.
+  unsigned int const quad_index_nonlinear = this->get_quad_index_velocity_nonlinear();
+  unsigned int const quad_index_pressure  = this->get_quad_index_pressure();
+  unsigned int const quad_index_linear    = this->get_quad_index_velocity_linear();
+
+  FaceIntegratorU velocity(matrix_free, true, dof_index_velocity, quad_index_nonlinear);
+  FaceIntegratorU grid_velocity(matrix_free, true, dof_index_velocity, quad_index_nonlinear);
+  FaceIntegratorP pressure_nonlinear(matrix_free, true, dof_index_pressure, quad_index_nonlinear);
+
+  FaceIntegratorP pressure(matrix_free, true, dof_index_pressure, quad_index_pressure);
+
+  FaceIntegratorU acceleration(matrix_free, true, dof_index_velocity, quad_index_linear);
+  FaceIntegratorU omega(matrix_free, true, dof_index_velocity, quad_index_linear);
+  FaceIntegratorP pressure_linear(matrix_free, true, dof_index_pressure, quad_index_linear);
+
+  // velocity divergence term and Laplace operator with the quadrature rules of these operators
+  DivergenceOperatorData<dim> const & div_data = this->divergence_operator.get_operator_data();
+
+  FaceIntegratorU velocity_div(matrix_free, true, div_data.dof_index_velocity, div_data.quad_index);
+  FaceIntegratorU velocity_dirichlet(matrix_free,
+                                     true,
+                                     div_data.dof_index_velocity,
+                                     div_data.quad_index);
+  FaceIntegratorP pressure_div(matrix_free, true, div_data.dof_index_pressure, div_data.quad_index);
+
+  FaceIntegratorP pressure_laplace(matrix_free,
+                                   true,
+                                   this->laplace_operator.get_data().dof_index,
+                                   this->laplace_operator.get_data().quad_index);
+
+  bool const div_term_homogeneous =
+    data.velocity_np != nullptr && div_data.integration_by_parts == true;
+  bool const div_term_dirichlet = not data.factors_div_term_dirichlet.empty() &&
+                                  div_data.integration_by_parts == true &&
+                                  div_data.use_boundary_data == true;
+  bool const convective_term = not data.velocities.empty();
+  bool const analytical_terms =
+    data.div_term_body_forces || data.nbc_body_forces || data.nbc_analytical_time_derivative;
+  bool const linear_terms = data.acceleration != nullptr || data.vorticity != nullptr;
+
+  bool const ale = this->param.ale_formulation && this->param.store_previous_boundary_values;
+
+  AlignedVector<scalar> flux_times_normal(pressure_nonlinear.n_q_points);
+  AlignedVector<scalar> dof_values(pressure.dofs_per_cell);
 
   for(unsigned int face = face_range.first; face < face_range.second; face++)
   {
-    integrator_velocity.reinit(face);
-    integrator_velocity.gather_evaluate(acceleration, true, false);
-
-    integrator_pressure.reinit(face);
-
-    types::boundary_id boundary_id = data.get_boundary_id(face);
-    BoundaryTypeP      boundary_type =
+    types::boundary_id const boundary_id = matrix_free.get_boundary_id(face);
+
+    // Inhomogeneous contributions of the velocity divergence term only occur on Dirichlet
+    // boundaries of the velocity.
+    // Remark: On symmetry boundaries it follows from g_u * n = 0 that also g_{u_hat} * n = 0.
+    // Hence, a symmetry boundary for u is also a symmetry boundary for u_hat. Hence, there
+    // are no inhomogeneous contributions on symmetry boundaries. The same holds for wall-modeled
+    // boundaries.
+    BoundaryTypeU const boundary_type_u =
+      this->boundary_descriptor_velocity->get_boundary_type(boundary_id);
+    AssertThrow(boundary_type_u == BoundaryTypeU::Dirichlet ||
+                  boundary_type_u == BoundaryTypeU::DirichletMortar ||
+                  boundary_type_u == BoundaryTypeU::Neumann ||
+                  boundary_type_u == BoundaryTypeU::Symmetry ||
+                  boundary_type_u == BoundaryTypeU::WallModel,
+                ExcMessage("Boundary type of face is invalid or not implemented."));
+    bool const dirichlet_u = boundary_type_u == BoundaryTypeU::Dirichlet ||
+                             boundary_type_u == BoundaryTypeU::DirichletMortar;
+
+    // contributions of the pressure Neumann boundary condition
+    BoundaryTypeP const boundary_type_p =
       this->boundary_descriptor_pressure->get_boundary_type(boundary_id);
+    AssertThrow(boundary_type_p == BoundaryTypeP::Dirichlet ||
+                  boundary_type_p == BoundaryTypeP::Neumann,
+                ExcMessage("Boundary type of face is invalid or not implemented."));
+    bool const neumann_p = boundary_type_p == BoundaryTypeP::Neumann;
 
-    for(unsigned int q = 0; q < integrator_pressure.n_q_points; ++q)
-    {
-      if(boundary_type == BoundaryTypeP::Neumann)
-      {
-        vector normal = integrator_velocity.get_normal_vector(q);
-        vector dudt   = integrator_velocity.get_value(q);
-        scalar h      = -normal * dudt;
+    // the Neumann boundary condition of the Laplace operator is homogeneous
+    bool const laplace = data.laplace_dirichlet && boundary_type_p == BoundaryTypeP::Dirichlet;
 
-        integrator_pressure.submit_value(h, q);
-      }
-      else if(boundary_type == BoundaryTypeP::Dirichlet)
-      {
-        scalar zero = make_vectorized_array<Number>(0.0);
-        integrator_pressure.submit_value(zero, q);
-      }
-      else
-      {
-        AssertThrow(false, ExcMessage("Boundary type of face is invalid or not implemented."));
-      }
-    }
+    if(not div_term_homogeneous && not laplace && not dirichlet_u && not neumann_p)
+      continue;
 
-    integrator_pressure.integrate(true, false);
-    integrator_pressure.distribute_local_to_global(dst);
-  }
-}
+    pressure.reinit(face);
 
-template<int dim, typename Number>
-void
-OperatorDualSplitting<dim, Number>::rhs_ppe_nbc_body_force_term_add(VectorType &   dst,
-                                                                    double const & time)
-{
-  this->evaluation_time = time;
+    for(unsigned int i = 0; i < pressure.dofs_per_cell; ++i)
+      dof_values[i] = make_vectorized_array<Number>(0.0);
 
-  VectorType src_dummy;
-  this->get_matrix_free().loop(&This::cell_loop_empty,
-                               &This::face_loop_empty,
-                               &This::local_rhs_ppe_nbc_body_force_term_add_boundary_face,
-                               this,
-                               dst,
-                               src_dummy);
-}
+    // homogeneous part of velocity divergence term
+    if(div_term_homogeneous)
+    {
+      velocity_div.reinit(face);
+      velocity_div.gather_evaluate(src, true, false);
 
-template<int dim, typename Number>
-void
-OperatorDualSplitting<dim, Number>::local_rhs_ppe_nbc_body_force_term_add_boundary_face(
-  MatrixFree<dim, Number> const & data,
-  VectorType &                    dst,
-  VectorType const &,
-  Range const & face_range) const
-{
-  unsigned int dof_index_pressure  = this->get_dof_index_pressure();
-  unsigned int quad_index_pressure = this->get_quad_index_pressure();
+      pressure_div.reinit(face);
 
-  FaceIntegratorP integrator(data, true, dof_index_pressure, quad_index_pressure);
+      this->divergence_operator.do_boundary_integral(
+        velocity_div, pressure_div, OperatorType::homogeneous, boundary_id, data.time);
 
-  for(unsigned int face = face_range.first; face < face_range.second; face++)
-  {
-    integrator.reinit(face);
+      pressure_div.integrate(true, false);
 
-    types::boundary_id boundary_id = data.get_boundary_id(face);
-    BoundaryTypeP      boundary_type =
-      this->boundary_descriptor_pressure->get_boundary_type(boundary_id);
+      for(unsigned int i = 0; i < pressure.dofs_per_cell; ++i)
+        dof_values[i] += Number(data.factor_div_term) * pressure_div.begin_dof_values()[i];
+    }
 
-    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    // inhomogeneous part of velocity divergence term
+    if(div_term_dirichlet && dirichlet_u)
     {
-      if(boundary_type == BoundaryTypeP::Neumann)
-      {
-        Point<dim, scalar> q_points = integrator.quadrature_point(q);
+      velocity_div.reinit(face);
 
-        // evaluate right-hand side
-        vector rhs =
-          FunctionEvaluator<1, dim, Number>::value(this->field_functions->right_hand_side,
-                                                   q_points,
-                                                   this->evaluation_time);
+      for(unsigned int j = 0; j < data.factors_div_term_dirichlet.size(); ++j)
+      {
+        pressure_div.reinit(face);
 
-        vector normal = integrator.get_normal_vector(q);
+        if(data.velocities_div_term_dirichlet.empty())
+        {
+          this->divergence_operator.do_boundary_integral(velocity_div,
+                                                         pressure_div,
+                                                         OperatorType::inhomogeneous,
+                                                         boundary_id,
+                                                         data.times_div_term_dirichlet[j]);
+        }
+        else
+        {
+          velocity_dirichlet.reinit(face);
+          velocity_dirichlet.gather_evaluate(*data.velocities_div_term_dirichlet[j], true, false);
+
+          this->divergence_operator.do_boundary_integral_from_dof_vector(
+            velocity_div,
+            velocity_dirichlet,
+            pressure_div,
+            OperatorType::inhomogeneous,
+            boundary_id);
+        }
 
-        scalar h = normal * rhs;
+        pressure_div.integrate(true, false);
 
-        integrator.submit_value(h, q);
-      }
-      else if(boundary_type == BoundaryTypeP::Dirichlet)
-      {
-        scalar zero = make_vectorized_array<Number>(0.0);
-        integrator.submit_value(zero, q);
-      }
-      else
-      {
-        AssertThrow(false, ExcMessage("Boundary type of face is invalid or not implemented."));
+        // minus sign since the boundary face integrals are shifted to the right-hand side
+        for(unsigned int i = 0; i < pressure.dofs_per_cell; ++i)
+          dof_values[i] -=
+            Number(data.factors_div_term_dirichlet[j]) * pressure_div.begin_dof_values()[i];
       }
     }
-    integrator.integrate(true, false);
-    integrator.distribute_local_to_global(dst);
-  }
-}
-
-template<int dim, typename Number>
-void
-OperatorDualSplitting<dim, Number>::rhs_ppe_convective_add(VectorType &       dst,
-                                                           VectorType const & src) const
-{
-  this->get_matrix_free().loop(&This::cell_loop_empty,
-                               &This::face_loop_empty,
-                               &This::local_rhs_ppe_nbc_convective_add_boundary_face,
-                               this,
-                               dst,
-                               src);
-}
 
-template<int dim, typename Number>
-void
-OperatorDualSplitting<dim, Number>::local_rhs_ppe_nbc_convective_add_boundary_face(
-  MatrixFree<dim, Number> const & matrix_free,
-  VectorType &                    dst,
-  VectorType const &              src,
-  Range const &                   face_range) const
-{
-  unsigned int const dof_index_velocity = this->get_dof_index_velocity();
-  unsigned int const dof_index_pressure = this->get_dof_index_pressure();
-  unsigned int const quad_index         = this->get_quad_index_velocity_nonlinear();
+    // inhomogeneous part of Laplace operator
+    if(laplace)
+    {
+      pressure_laplace.reinit(face);
 
-  FaceIntegratorU velocity(matrix_free, true, dof_index_velocity, quad_index);
-  FaceIntegratorP pressure(matrix_free, true, dof_index_pressure, quad_index);
-  FaceIntegratorU grid_velocity(matrix_free, true, dof_index_velocity, quad_index);
+      this->laplace_operator.integrate_boundary_face_inhom_operator(pressure_laplace, boundary_id);
 
-  for(unsigned int face = face_range.first; face < face_range.second; face++)
-  {
-    velocity.reinit(face);
-    velocity.gather_evaluate(src, true, true);
+      // minus sign since the boundary face integrals are shifted to the right-hand side
+      for(unsigned int i = 0; i < pressure.dofs_per_cell; ++i)
+        dof_values[i] -= pressure_laplace.begin_dof_values()[i];
+    }
 
-    if(this->param.ale_formulation && this->param.store_previous_boundary_values)
+    // convective terms: each velocity vector is read only once for both terms
+    if(convective_term && (dirichlet_u || neumann_p))
     {
-      grid_velocity.reinit(face);
-      grid_velocity.gather_evaluate(this->convective_kernel->get_grid_velocity(), true, false);
-    }
+      pressure_nonlinear.reinit(face);
 
-    pressure.reinit(face);
+      if(ale)
+      {
+        grid_velocity.reinit(face);
+        grid_velocity.gather_evaluate(this->convective_kernel->get_grid_velocity(), true, false);
+      }
 
-    BoundaryTypeP boundary_type =
-      this->boundary_descriptor_pressure->get_boundary_type(matrix_free.get_boundary_id(face));
+      for(unsigned int q = 0; q < pressure_nonlinear.n_q_points; ++q)
+        flux_times_normal[q] = make_vectorized_array<Number>(0.0);
 
-    for(unsigned int q = 0; q < pressure.n_q_points; ++q)
-    {
-      if(boundary_type == BoundaryTypeP::Neumann)
+      for(unsigned int i = 0; i < data.velocities.size(); ++i)
       {
-        vector normal = pressure.get_normal_vector(q);
+        double const factor = (dirichlet_u ? data.factors_div_term_convective[i] : 0.0) -
+                              (neumann_p ? data.factors_nbc_convective[i] : 0.0);
 
-        vector u      = velocity.get_value(q);
-        tensor grad_u = velocity.get_gradient(q);
+        if(factor == 0.0)
+          continue;
 
-        vector flux;
-        if(this->param.formulation_convective_term_bc ==
-           FormulationConvectiveTerm::DivergenceFormulation)
-        {
-          scalar div_u = velocity.get_divergence(q);
-          flux         = grad_u * u + div_u * u;
-        }
-        else if(this->param.formulation_convective_term_bc ==
-                FormulationConvectiveTerm::ConvectiveFormulation)
-        {
-          flux = grad_u * u;
-        }
-        else
-        {
-          AssertThrow(false, ExcMessage("Not implemented."));
-        }
+        velocity.reinit(face);
+        velocity.gather_evaluate(*data.velocities[i], true, true);
 
-        if(this->param.ale_formulation && this->param.store_previous_boundary_values)
+        for(unsigned int q = 0; q < pressure_nonlinear.n_q_points; ++q)
         {
-          flux -= grad_u * grid_velocity.get_value(q);
+          vector u      = velocity.get_value(q);
+          tensor grad_u = velocity.get_gradient(q);
+
+          vector flux;
+          if(this->param.formulation_convective_term_bc ==
+             FormulationConvectiveTerm::DivergenceFormulation)
+          {
+            scalar div_u = velocity.get_divergence(q);
+            flux         = grad_u * u + div_u * u;
+          }
+          else if(this->param.formulation_convective_term_bc ==
+                  FormulationConvectiveTerm::ConvectiveFormulation)
+          {
+            flux = grad_u * u;
+          }
+          else
+          {
+            AssertThrow(false, ExcMessage("Not implemented."));
+          }
+
+          if(ale)
+          {
+            flux -= grad_u * grid_velocity.get_value(q);
+          }
+
+          flux_times_normal[q] += Number(factor) * (flux * pressure_nonlinear.get_normal_vector(q));
         }
-
-        pressure.submit_value(-normal * flux, q);
-      }
-      else if(boundary_type == BoundaryTypeP::Dirichlet)
-      {
-        pressure.submit_value(make_vectorized_array<Number>(0.0), q);
-      }
-      else
-      {
-        AssertThrow(false, ExcMessage("Boundary type of face is invalid or not implemented."));
       }
-    }
 
-    pressure.integrate_scatter(true, false, dst);
-  }
-}
+      for(unsigned int q = 0; q < pressure_nonlinear.n_q_points; ++q)
+        pressure_nonlinear.submit_value(flux_times_normal[q], q);
 
-template<int dim, typename Number>
-void
-OperatorDualSplitting<dim, Number>::rhs_ppe_viscous_add(VectorType &       dst,
-                                                        VectorType const & src) const
-{
-  this->get_matrix_free().loop(&This::cell_loop_empty,
-                               &This::face_loop_empty,
-                               &This::local_rhs_ppe_nbc_viscous_add_boundary_face,
-                               this,
-                               dst,
-                               src);
-}
+      pressure_nonlinear.integrate(true, false);
 
-template<int dim, typename Number>
-void
-OperatorDualSplitting<dim, Number>::local_rhs_ppe_nbc_viscous_add_boundary_face(
-  MatrixFree<dim, Number> const & matrix_free,
-  VectorType &                    dst,
-  VectorType const &              src,
-  Range const &                   face_range) const
-{
-  unsigned int const dof_index_velocity = this->get_dof_index_velocity();
-  unsigned int const dof_index_pressure = this->get_quad_index_pressure();
-  unsigned int const quad_index         = this->get_quad_index_velocity_linear();
+      for(unsigned int i = 0; i < pressure.dofs_per_cell; ++i)
+        dof_values[i] += pressure_nonlinear.begin_dof_values()[i];
+    }
 
-  FaceIntegratorU omega(matrix_free, true, dof_index_velocity, quad_index);
+    // terms evaluated from analytical functions: body forces and analytical time derivative
+    if(analytical_terms && (dirichlet_u || neumann_p))
+    {
+      for(unsigned int q = 0; q < pressure.n_q_points; ++q)
+      {
+        Point<dim, scalar> q_points = pressure.quadrature_point(q);
+        vector             normal   = pressure.get_normal_vector(q);
 
-  FaceIntegratorP pressure(matrix_free, true, dof_index_pressure, quad_index);
+        scalar h = make_vectorized_array<Number>(0.0);
 
-  for(unsigned int face = face_range.first; face < face_range.second; face++)
-  {
-    pressure.reinit(face);
+        if((dirichlet_u && data.div_term_body_forces) || (neumann_p && data.nbc_body_forces))
+        {
+          vector rhs = FunctionEvaluator<1, dim, Number>::value(
+            this->field_functions->right_hand_side, q_points, data.time);
 
-    omega.reinit(face);
-    omega.gather_evaluate(src, false, true);
+          scalar rhs_times_normal = rhs * normal;
 
-    BoundaryTypeP boundary_type =
-      this->boundary_descriptor_pressure->get_boundary_type(matrix_free.get_boundary_id(face));
+          // minus sign of velocity divergence term
+          if(dirichlet_u && data.div_term_body_forces)
+            h -= rhs_times_normal;
 
-    for(unsigned int q = 0; q < pressure.n_q_points; ++q)
-    {
-      scalar viscosity = this->get_viscosity_boundary_face(face, q);
+          if(neumann_p && data.nbc_body_forces)
+            h += rhs_times_normal;
+        }
 
-      if(boundary_type == BoundaryTypeP::Neumann)
-      {
-        scalar h = make_vectorized_array<Number>(0.0);
+        if(neumann_p && data.nbc_analytical_time_derivative)
+        {
+          typename std::map<types::boundary_id, std::shared_ptr<Function<dim>>>::iterator it =
+            this->boundary_descriptor_pressure->neumann_bc.find(boundary_id);
+          vector dudt = FunctionEvaluator<1, dim, Number>::value(it->second, q_points, data.time);
 
-        vector normal = pressure.get_normal_vector(q);
+          h -= normal * dudt;
+        }
 
-        vector curl_omega = CurlCompute<dim, FaceIntegratorU>::compute(omega, q);
+        pressure.submit_value(h, q);
+      }
 
-        h = -normal * (viscosity * curl_omega);
+      pressure.integrate(true, false);
 
-        pressure.submit_value(h, q);
+      for(unsigned int i = 0; i < pressure.dofs_per_cell; ++i)
+        dof_values[i] += pressure.begin_dof_values()[i];
+    }
+
+    // terms evaluated from dof vectors: numerical time derivative and viscous term
+    if(linear_terms && neumann_p)
+    {
+      pressure_linear.reinit(face);
+
+      if(data.acceleration != nullptr)
+      {
+        acceleration.reinit(face);
+        acceleration.gather_evaluate(*data.acceleration, true, false);
       }
-      else if(boundary_type == BoundaryTypeP::Dirichlet)
+
+      if(data.vorticity != nullptr)
       {
-        pressure.submit_value(make_vectorized_array<Number>(0.0), q);
+        omega.reinit(face);
+        omega.gather_evaluate(*data.vorticity, false, true);
       }
-      else
+
+      for(unsigned int q = 0; q < pressure_linear.n_q_points; ++q)
       {
-        AssertThrow(false, ExcMessage("Boundary type of face is invalid or not implemented."));
+        vector normal = pressure_linear.get_normal_vector(q);
+
+        scalar h = make_vectorized_array<Number>(0.0);
+
+        if(data.acceleration != nullptr)
+          h -= normal * acceleration.get_value(q);
+
+        if(data.vorticity != nullptr)
+        {
+          scalar viscosity  = this->get_viscosity_boundary_face(face, q);
+          vector curl_omega = CurlCompute<dim, FaceIntegratorU>::compute(omega, q);
+
+          h -= normal * (viscosity * curl_omega);
+        }
+
+        pressure_linear.submit_value(h, q);
       }
+
+      pressure_linear.integrate(true, false);
+
+      for(unsigned int i = 0; i < pressure.dofs_per_cell; ++i)
+        dof_values[i] += pressure_linear.begin_dof_values()[i];
     }
-    pressure.integrate_scatter(true, false, dst);
+
+    for(unsigned int i = 0; i < pressure.dofs_per_cell; ++i)
+      pressure.begin_dof_values()[i] = dof_values[i];
+
+    pressure.distribute_local_to_global(dst);
   }
 }
 
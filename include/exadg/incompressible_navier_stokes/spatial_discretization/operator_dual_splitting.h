@@ -32,6 +32,65 @@ namespace IncNS
 {
 using namespace dealii;
 
+/*
+ * Data of the right-hand side of the pressure Poisson equation, all terms of which are evaluated in
+ * a single loop over cells, interior faces, and boundary faces, see
+ * OperatorDualSplitting::rhs_ppe().
+ */
+template<typename VectorType>
+struct RhsPPEData
+{
+  RhsPPEData()
+    : time(0.0),
+      velocity_np(nullptr),
+      factor_div_term(0.0),
+      laplace_dirichlet(false),
+      div_term_body_forces(false),
+      nbc_body_forces(false),
+      nbc_analytical_time_derivative(false),
+      acceleration(nullptr),
+      vorticity(nullptr)
+  {
+  }
+
+  // evaluation time of body forces and boundary conditions
+  double time;
+
+  // homogeneous part of the velocity divergence term (cell, interior face, and boundary face
+  // integrals) for the velocity velocity_np, scaled by factor_div_term (evaluated if not nullptr)
+  VectorType const * velocity_np;
+  double             factor_div_term;
+
+  // inhomogeneous part of the velocity divergence term (Dirichlet boundaries of the velocity),
+  // scaled by factors_div_term_dirichlet and evaluated either from the boundary descriptor at the
+  // times times_div_term_dirichlet or from the dof vectors velocities_div_term_dirichlet
+  std::vector<double>             factors_div_term_dirichlet;
+  std::vector<double>             times_div_term_dirichlet;
+  std::vector<VectorType const *> velocities_div_term_dirichlet;
+
+  // inhomogeneous part of the Laplace operator (Dirichlet boundaries of the pressure)
+  bool laplace_dirichlet;
+
+  // velocities u_i entering the convective term along with the factors of the velocity
+  // divergence term (Dirichlet boundaries of the velocity) and of the pressure Neumann boundary
+  // condition (Neumann boundaries of the pressure). A factor of zero switches off the term.
+  std::vector<VectorType const *> velocities;
+  std::vector<double>             factors_div_term_convective;
+  std::vector<double>             factors_nbc_convective;
+
+  // body force term of velocity divergence term and of pressure Neumann boundary condition
+  bool div_term_body_forces;
+  bool nbc_body_forces;
+
+  // temporal derivative of velocity in pressure Neumann boundary condition, either analytical or
+  // numerical (evaluated from the vector acceleration if not nullptr)
+  bool               nbc_analytical_time_derivative;
+  VectorType const * acceleration;
+
+  // viscous term of pressure Neumann boundary condition (evaluated if not nullptr)
+  VectorType const * vorticity;
+};
+
 template<int dim, typename Number = double>
 class OperatorDualSplitting : public OperatorProjectionMethods<dim, Number>
 {
@@ -48,6 +107,9 @@ private:
 
   typedef typename Base::Range Range;
 
+  typedef CellIntegrator<dim, dim, Number> CellIntegratorU;
+  typedef CellIntegrator<dim, 1, Number>   CellIntegratorP;
+
   typedef typename Base::FaceIntegratorU FaceIntegratorU;
   typedef typename Base::FaceIntegratorP FaceIntegratorP;
 
@@ -91,29 +153,10 @@ public:
   rhs_velocity_divergence_term_dirichlet_bc_from_dof_vector(VectorType &       dst,
                                                             VectorType const & velocity) const;
 
+  // rhs pressure: all terms of the right-hand side (velocity divergence term, inhomogeneous part
+  // of the Laplace operator, and pressure Neumann boundary condition) evaluated in a single loop
   void
-  rhs_ppe_div_term_body_forces_add(VectorType & dst, double const & time);
-
-  void
-  rhs_ppe_div_term_convective_term_add(VectorType & dst, VectorType const & src) const;
-
-  // rhs pressure
-  void
-  rhs_ppe_nbc_body_force_term_add(VectorType & dst, double const & time);
-
-  void
-  rhs_ppe_nbc_analytical_time_derivative_add(VectorType & dst, double const & time);
-
-  void
-  rhs_ppe_nbc_numerical_time_derivative_add(VectorType & dst, VectorType const & src);
-
-  // rhs pressure: Neumann BC convective term
-  void
-  rhs_ppe_convective_add(VectorType & dst, VectorType const & src) const;
-
-  // rhs pressure: Neumann BC viscous term
-  void
-  rhs_ppe_viscous_add(VectorType & dst, VectorType const & src) const;
+  rhs_ppe(VectorType & dst, RhsPPEData<VectorType> const & data) const;
 
   void
   rhs_ppe_laplace_add(VectorType & dst, double const & time) const;
@@ -155,76 +198,26 @@ private:
    */
 
   void
-  cell_loop_empty(MatrixFree<dim, Number> const &,
-                  VectorType &,
-                  VectorType const &,
-                  Range const &) const
-  {
-  }
-
-  void
-  face_loop_empty(MatrixFree<dim, Number> const &,
-                  VectorType &,
-                  VectorType const &,
-                  Range const &) const
-  {
-  }
-
-  // rhs PPE: velocity divergence term
-
-  // convective term
-  void
-  local_rhs_ppe_div_term_convective_term_boundary_face(MatrixFree<dim, Number> const & matrix_free,
-                                                       VectorType &                    dst,
-                                                       VectorType const &              src,
-                                                       Range const & face_range) const;
-
-  // body force term
-  void
-  local_rhs_ppe_div_term_body_forces_boundary_face(MatrixFree<dim, Number> const & matrix_free,
-                                                   VectorType &                    dst,
-                                                   VectorType const &              src,
-                                                   Range const & face_range) const;
-
-  // Neumann boundary condition term
-
-  // dg_u/dt term with analytical derivative
-  void
-  local_rhs_ppe_nbc_analytical_time_derivative_add_boundary_face(
-    MatrixFree<dim, Number> const & matrix_free,
-    VectorType &                    dst,
-    VectorType const &              src,
-    Range const &                   face_range) const;
-
-  // dg_u/dt with numerical time derivative
-  void
-  local_rhs_ppe_nbc_numerical_time_derivative_add_boundary_face(
-    MatrixFree<dim, Number> const & matrix_free,
-    VectorType &                    dst,
-    VectorType const &              src,
-    Range const &                   face_range) const;
-
-  // body force term
-  void
-  local_rhs_ppe_nbc_body_force_term_add_boundary_face(MatrixFree<dim, Number> const & matrix_free,
-                                                      VectorType &                    dst,
-                                                      VectorType const &              src,
-                                                      Range const & face_range) const;
+  local_rhs_ppe_cell(MatrixFree<dim, Number> const & matrix_free,
+                     VectorType &                    dst,
+                     VectorType const &              src,
+                     Range const &                   cell_range) const;
 
-  // convective term
   void
-  local_rhs_ppe_nbc_convective_add_boundary_face(MatrixFree<dim, Number> const & matrix_free,
-                                                 VectorType &                    dst,
-                                                 VectorType const &              src,
-                                                 Range const &                   face_range) const;
+  local_rhs_ppe_face(MatrixFree<dim, Number> const & matrix_free,
+                     VectorType &                    dst,
+                     VectorType const &              src,
+                     Range const &                   face_range) const;
 
-  // viscous term
   void
-  local_rhs_ppe_nbc_viscous_add_boundary_face(MatrixFree<dim, Number> const & matrix_free,
-                                              VectorType &                    dst,
-                                              VectorType const &              src,
-                                              Range const &                   face_range) const;
+  local_rhs_ppe_boundary_face(MatrixFree<dim, Number> const & matrix_free,
+                              VectorType &                    dst,
+                              VectorType const &              src,
+                              Range const &                   face_range) const;
 
+  // data of the right-hand side, needed since the MatrixFree interface only provides one source
+  // vector
+  mutable RhsPPEData<VectorType> const * rhs_ppe_data;
 
   /*
    * Viscous step (Helmholtz-like equation).
@@ -137,6 +137,9 @@ OperatorPressureCorrection<dim, Number>::initialize_momentum_preconditioner()
 
     const FiniteElement<dim> & fe = dof_handler.get_fe();
 
+    if(this->param.use_dof_renumbering)
+      mg_preconditioner->set_dof_numbering_fine_level(dof_handler);
+
     mg_preconditioner->initialize(this->param.multigrid_data_momentum,
                                   tria,
                                   fe,
@@ -302,6 +305,7 @@ OperatorPressureCorrection<dim, Number>::evaluate_nonlinear_residual(
   double const &     scaling_factor_mass) const
 {
   this->mass_operator.apply_scale(dst, scaling_factor_mass, src);
+  this->apply_local_time_step_scaling(dst);
 
   // always evaluate convective term since this function is only called
   // if a nonlinear problem has to be solved, i.e., if the convective operator
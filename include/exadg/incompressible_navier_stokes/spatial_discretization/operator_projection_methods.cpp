@@ -187,6 +187,9 @@ OperatorProjectionMethods<dim, Number>::initialize_preconditioner_pressure_poiss
         &this->get_dof_handler_p().get_triangulation());
     const FiniteElement<dim> & fe = this->get_dof_handler_p().get_fe();
 
+    if(this->param.use_dof_renumbering)
+      mg_preconditioner->set_dof_numbering_fine_level(this->get_dof_handler_p());
+
     mg_preconditioner->initialize(mg_data,
                                   tria,
                                   fe,
@@ -151,41 +151,51 @@ public:
 
     IntegratorCell integrator(*matrix_free, dof_index, quad_index);
 
-    AlignedVector<scalar> JxW_values(integrator.n_q_points);
-
     unsigned int n_cells = matrix_free->n_cell_batches() + matrix_free->n_ghost_cell_batches();
     for(unsigned int cell = 0; cell < n_cells; ++cell)
     {
       integrator.reinit(cell);
       integrator.read_dof_values(velocity);
       integrator.evaluate(true, false);
-      scalar volume      = make_vectorized_array<Number>(0.0);
-      scalar norm_U_mean = make_vectorized_array<Number>(0.0);
-
-      for(unsigned int q = 0; q < integrator.n_q_points; ++q)
-      {
-        volume += integrator.JxW(q);
-        norm_U_mean += integrator.JxW(q) * integrator.get_value(q).norm();
-      }
-
-      norm_U_mean /= volume;
-
-      scalar tau_convective = norm_U_mean;
-      scalar h_eff          = std::exp(std::log(volume) / (double)dim) / (double)(data.degree + 1);
-      scalar tau_viscous    = make_vectorized_array<Number>(data.viscosity) / h_eff;
-
-      if(data.type_penalty_parameter == TypePenaltyParameter::ConvectiveTerm)
-      {
-        array_penalty_parameter[cell] = data.penalty_factor * tau_convective;
-      }
-      else if(data.type_penalty_parameter == TypePenaltyParameter::ViscousTerm)
-      {
-        array_penalty_parameter[cell] = data.penalty_factor * tau_viscous;
-      }
-      else if(data.type_penalty_parameter == TypePenaltyParameter::ViscousAndConvectiveTerms)
-      {
-        array_penalty_parameter[cell] = data.penalty_factor * (tau_convective + tau_viscous);
-      }
+
+      calculate_penalty_parameter(integrator, cell);
+    }
+  }
+
+  /*
+   * Calculates the penalty parameter of one cell batch. The integrator has to be initialized for
+   * this cell batch (with the dof index and quadrature index of this kernel) and the velocity
+   * values have to be evaluated in the quadrature points.
+   */
+  void
+  calculate_penalty_parameter(IntegratorCell const & integrator, unsigned int const cell)
+  {
+    scalar volume      = make_vectorized_array<Number>(0.0);
+    scalar norm_U_mean = make_vectorized_array<Number>(0.0);
+
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      volume += integrator.JxW(q);
+      norm_U_mean += integrator.JxW(q) * integrator.get_value(q).norm();
+    }
+
+    norm_U_mean /= volume;
+
+    scalar tau_convective = norm_U_mean;
+    scalar h_eff          = std::exp(std::log(volume) / (double)dim) / (double)(data.degree + 1);
+    scalar tau_viscous    = make_vectorized_array<Number>(data.viscosity) / h_eff;
+
+    if(data.type_penalty_parameter == TypePenaltyParameter::ConvectiveTerm)
+    {
+      array_penalty_parameter[cell] = data.penalty_factor * tau_convective;
+    }
+    else if(data.type_penalty_parameter == TypePenaltyParameter::ViscousTerm)
+    {
+      array_penalty_parameter[cell] = data.penalty_factor * tau_viscous;
+    }
+    else if(data.type_penalty_parameter == TypePenaltyParameter::ViscousAndConvectiveTerms)
+    {
+      array_penalty_parameter[cell] = data.penalty_factor * (tau_convective + tau_viscous);
     }
   }
 
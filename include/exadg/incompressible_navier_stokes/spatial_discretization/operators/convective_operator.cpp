@@ -7,6 +7,7 @@
 
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operators/convective_operator.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operators/weak_boundary_conditions.h>
+#include <exadg/time_integration/time_step_calculation.h>
 
 namespace ExaDG
 {
@@ -90,6 +91,28 @@ ConvectiveOperator<dim, Number>::evaluate_nonlinear_operator_add(VectorType &
                           MatrixFree<dim, Number>::DataAccessOnFaces::values);
 }
 
+template<int dim, typename Number>
+double
+ConvectiveOperator<dim, Number>::evaluate_nonlinear_operator_and_calculate_time_step_cfl(
+  VectorType &           dst,
+  VectorType const &     src,
+  Number const           time,
+  CFLConditionType const cfl_condition_type) const
+{
+  AssertThrow(operator_data.kernel_data.ale == false,
+              ExcMessage("The relative velocity is not available in the ALE case."));
+
+  this->calculate_time_step_cfl = true;
+  this->cfl_condition_type      = cfl_condition_type;
+  this->time_step_cfl           = std::numeric_limits<double>::max();
+
+  evaluate_nonlinear_operator(dst, src, time);
+
+  this->calculate_time_step_cfl = false;
+
+  return this->time_step_cfl;
+}
+
 template<int dim, typename Number>
 void
 ConvectiveOperator<dim, Number>::evaluate_linear_transport(
@@ -188,6 +211,17 @@ ConvectiveOperator<dim, Number>::cell_loop_nonlinear_operator(
       integrator_grid_velocity.gather_evaluate(kernel->get_grid_velocity(), true, false, false);
     }
 
+    // the velocity values are overwritten by the cell integral
+    if(calculate_time_step_cfl)
+    {
+      double const dt =
+        (cfl_condition_type == CFLConditionType::VelocityNorm) ?
+          calculate_time_step_cfl_cell_batch<CFLConditionType::VelocityNorm>(integrator) :
+          calculate_time_step_cfl_cell_batch<CFLConditionType::VelocityComponents>(integrator);
+
+      time_step_cfl = std::min(time_step_cfl, dt);
+    }
+
     do_cell_integral_nonlinear_operator(integrator, integrator_grid_velocity);
 
     integrator.integrate_scatter(this->integrator_flags.cell_integrate.value,
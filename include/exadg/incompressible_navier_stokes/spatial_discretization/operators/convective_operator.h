@@ -895,7 +895,7 @@ public:
     {
       delta_uP = delta_uM;
     }
-    else if(boundary_type == BoundaryTypeU::Symmetry)
+    else if(boundary_type == BoundaryTypeU::Symmetry || boundary_type == BoundaryTypeU::WallModel)
     {
       Tensor<1, dim, VectorizedArray<Number>> normalM = integrator.get_normal_vector(q);
       delta_uP = delta_uM - 2. * (delta_uM * normalM) * normalM;
@@ -968,7 +968,11 @@ public:
   typedef typename Base::IntegratorCell IntegratorCell;
   typedef typename Base::IntegratorFace IntegratorFace;
 
-  ConvectiveOperator() : velocity_linear_transport(nullptr)
+  ConvectiveOperator()
+    : velocity_linear_transport(nullptr),
+      calculate_time_step_cfl(false),
+      cfl_condition_type(CFLConditionType::VelocityNorm),
+      time_step_cfl(std::numeric_limits<double>::max())
   {
   }
 
@@ -998,6 +1002,19 @@ public:
                                   VectorType const & src,
                                   Number const       time) const;
 
+  /*
+   * Evaluate nonlinear operator and calculate the time step size according to the local CFL
+   * criterion for the velocity src as a by-product of the cell integrals (see
+   * calculate_time_step_cfl_cell_batch()). Returns the minimum over the cells of the current
+   * process.
+   */
+  double
+  evaluate_nonlinear_operator_and_calculate_time_step_cfl(
+    VectorType &           dst,
+    VectorType const &     src,
+    Number const           time,
+    CFLConditionType const cfl_condition_type) const;
+
   /*
    * Evaluate operator (linear transport with a divergence-free velocity). This function
    * is required in case of operator-integration-factor (OIF) splitting.
@@ -1157,6 +1174,11 @@ private:
   // OIF substepping
   mutable VectorType const * velocity_linear_transport;
 
+  // local CFL time step size calculated in the cell loop of the nonlinear operator
+  mutable bool             calculate_time_step_cfl;
+  mutable CFLConditionType cfl_condition_type;
+  mutable double           time_step_cfl;
+
   std::shared_ptr<Operators::ConvectiveKernel<dim, Number>> kernel;
 };
 
@@ -211,10 +211,12 @@ DivergenceOperator<dim, Number>::do_face_integral(FaceIntegratorU & velocity_m,
 
 template<int dim, typename Number>
 void
-DivergenceOperator<dim, Number>::do_boundary_integral(FaceIntegratorU &          velocity,
-                                                      FaceIntegratorP &          pressure,
-                                                      OperatorType const &       operator_type,
-                                                      types::boundary_id const & boundary_id) const
+DivergenceOperator<dim, Number>::do_boundary_integral(
+  FaceIntegratorU &          velocity,
+  FaceIntegratorP &          pressure,
+  OperatorType const &       operator_type,
+  types::boundary_id const & boundary_id,
+  double const &             evaluation_time) const
 {
   BoundaryTypeU boundary_type = data.bc->get_boundary_type(boundary_id);
 
@@ -225,7 +227,7 @@ DivergenceOperator<dim, Number>::do_boundary_integral(FaceIntegratorU &
     if(data.use_boundary_data == true)
     {
       value_p = calculate_exterior_value(
-        value_m, q, velocity, operator_type, boundary_type, boundary_id, data.bc, time);
+        value_m, q, velocity, operator_type, boundary_type, boundary_id, data.bc, evaluation_time);
     }
     else // use_boundary_data == false
     {
@@ -385,7 +387,8 @@ DivergenceOperator<dim, Number>::boundary_face_loop_hom_operator(
       do_boundary_integral(velocity,
                            pressure,
                            OperatorType::homogeneous,
-                           matrix_free.get_boundary_id(face));
+                           matrix_free.get_boundary_id(face),
+                           time);
 
       pressure.integrate_scatter(true, false, dst);
     }
@@ -416,7 +419,8 @@ DivergenceOperator<dim, Number>::boundary_face_loop_full_operator(
       do_boundary_integral(velocity,
                            pressure,
                            OperatorType::full,
-                           matrix_free.get_boundary_id(face));
+                           matrix_free.get_boundary_id(face),
+                           time);
 
       pressure.integrate_scatter(true, false, dst);
     }
@@ -463,7 +467,8 @@ DivergenceOperator<dim, Number>::boundary_face_loop_inhom_operator(
       do_boundary_integral(velocity,
                            pressure,
                            OperatorType::inhomogeneous,
-                           matrix_free.get_boundary_id(face));
+                           matrix_free.get_boundary_id(face),
+                           time);
 
       pressure.integrate_scatter(true, false, dst);
     }
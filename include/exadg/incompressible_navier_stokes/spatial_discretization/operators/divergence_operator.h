@@ -156,7 +156,11 @@ public:
   void
   evaluate_add(VectorType & dst, VectorType const & src, Number const evaluation_time) const;
 
-private:
+  /*
+   * Integrals of a single cell or face. These functions are public so that the velocity divergence
+   * term can be evaluated together with other terms in one loop, see
+   * OperatorDualSplitting::rhs_ppe().
+   */
   void
   do_cell_integral_weak(CellIntegratorP & pressure, CellIntegratorU & velocity) const;
 
@@ -173,7 +177,8 @@ private:
   do_boundary_integral(FaceIntegratorU &          velocity,
                        FaceIntegratorP &          pressure,
                        OperatorType const &       operator_type,
-                       types::boundary_id const & boundary_id) const;
+                       types::boundary_id const & boundary_id,
+                       double const &             evaluation_time) const;
 
   void
   do_boundary_integral_from_dof_vector(FaceIntegratorU &          velocity,
@@ -182,6 +187,7 @@ private:
                                        OperatorType const &       operator_type,
                                        types::boundary_id const & boundary_id) const;
 
+private:
   void
   cell_loop(MatrixFree<dim, Number> const & matrix_free,
             VectorType &                    dst,
@@ -137,46 +137,60 @@ public:
 
     IntegratorCell integrator(*matrix_free, dof_index, quad_index);
 
-    AlignedVector<scalar> JxW_values(integrator.n_q_points);
-
     unsigned int n_cells = matrix_free->n_cell_batches() + matrix_free->n_ghost_cell_batches();
     for(unsigned int cell = 0; cell < n_cells; ++cell)
     {
-      scalar tau_convective = make_vectorized_array<Number>(0.0);
-      scalar tau_viscous    = make_vectorized_array<Number>(data.viscosity);
-
       if(data.type_penalty_parameter == TypePenaltyParameter::ConvectiveTerm ||
          data.type_penalty_parameter == TypePenaltyParameter::ViscousAndConvectiveTerms)
       {
         integrator.reinit(cell);
         integrator.read_dof_values(velocity);
         integrator.evaluate(true, false);
-
-        scalar volume      = make_vectorized_array<Number>(0.0);
-        scalar norm_U_mean = make_vectorized_array<Number>(0.0);
-        for(unsigned int q = 0; q < integrator.n_q_points; ++q)
-        {
-          volume += integrator.JxW(q);
-          norm_U_mean += integrator.JxW(q) * integrator.get_value(q).norm();
-        }
-        norm_U_mean /= volume;
-
-        tau_convective =
-          norm_U_mean * std::exp(std::log(volume) / (double)dim) / (double)(data.degree + 1);
       }
 
-      if(data.type_penalty_parameter == TypePenaltyParameter::ConvectiveTerm)
-      {
-        array_penalty_parameter[cell] = data.penalty_factor * tau_convective;
-      }
-      else if(data.type_penalty_parameter == TypePenaltyParameter::ViscousTerm)
-      {
-        array_penalty_parameter[cell] = data.penalty_factor * tau_viscous;
-      }
-      else if(data.type_penalty_parameter == TypePenaltyParameter::ViscousAndConvectiveTerms)
+      calculate_penalty_parameter(integrator, cell);
+    }
+  }
+
+  /*
+   * Calculates the penalty parameter of one cell batch. The integrator has to be initialized for
+   * this cell batch (with the dof index and quadrature index of this kernel) and the velocity
+   * values have to be evaluated in the quadrature points, which allows to calculate the penalty
+   * parameter within loops that evaluate the velocity anyway.
+   */
+  void
+  calculate_penalty_parameter(IntegratorCell const & integrator, unsigned int const cell)
+  {
+    scalar tau_convective = make_vectorized_array<Number>(0.0);
+    scalar tau_viscous    = make_vectorized_array<Number>(data.viscosity);
+
+    if(data.type_penalty_parameter == TypePenaltyParameter::ConvectiveTerm ||
+       data.type_penalty_parameter == TypePenaltyParameter::ViscousAndConvectiveTerms)
+    {
+      scalar volume      = make_vectorized_array<Number>(0.0);
+      scalar norm_U_mean = make_vectorized_array<Number>(0.0);
+      for(unsigned int q = 0; q < integrator.n_q_points; ++q)
       {
-        array_penalty_parameter[cell] = data.penalty_factor * (tau_convective + tau_viscous);
+        volume += integrator.JxW(q);
+        norm_U_mean += integrator.JxW(q) * integrator.get_value(q).norm();
       }
+      norm_U_mean /= volume;
+
+      tau_convective =
+        norm_U_mean * std::exp(std::log(volume) / (double)dim) / (double)(data.degree + 1);
+    }
+
+    if(data.type_penalty_parameter == TypePenaltyParameter::ConvectiveTerm)
+    {
+      array_penalty_parameter[cell] = data.penalty_factor * tau_convective;
+    }
+    else if(data.type_penalty_parameter == TypePenaltyParameter::ViscousTerm)
+    {
+      array_penalty_parameter[cell] = data.penalty_factor * tau_viscous;
+    }
+    else if(data.type_penalty_parameter == TypePenaltyParameter::ViscousAndConvectiveTerms)
+    {
+      array_penalty_parameter[cell] = data.penalty_factor * (tau_convective + tau_viscous);
     }
   }
 
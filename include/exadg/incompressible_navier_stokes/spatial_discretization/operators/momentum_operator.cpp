@@ -7,7 +7,8 @@ namespace IncNS
 using namespace dealii;
 
 template<int dim, typename Number>
-MomentumOperator<dim, Number>::MomentumOperator() : scaling_factor_mass(1.0)
+MomentumOperator<dim, Number>::MomentumOperator()
+  : scaling_factor_mass(1.0), cell_scaling_mass(nullptr)
 {
 }
 
@@ -84,6 +85,10 @@ MomentumOperator<dim, Number>::initialize(
   this->convective_kernel = convective_kernel;
   this->viscous_kernel    = viscous_kernel;
 
+  // the viscous kernel is shared with other operators that may use a different quadrature rule
+  if(operator_data.viscous_problem)
+    this->viscous_kernel->initialize_quadrature(matrix_free, operator_data.quad_index);
+
   if(operator_data.unsteady_problem)
     this->integrator_flags = this->integrator_flags || this->mass_kernel->get_integrator_flags();
   if(operator_data.convective_problem)
@@ -166,6 +171,14 @@ MomentumOperator<dim, Number>::set_scaling_factor_mass_operator(Number const & n
   this->scaling_factor_mass = number;
 }
 
+template<int dim, typename Number>
+void
+MomentumOperator<dim, Number>::set_cell_scaling_mass_operator(
+  AlignedVector<scalar> const * cell_scaling)
+{
+  this->cell_scaling_mass = cell_scaling;
+}
+
 template<int dim, typename Number>
 void
 MomentumOperator<dim, Number>::rhs(VectorType & dst) const
@@ -217,6 +230,9 @@ MomentumOperator<dim, Number>::reinit_cell(unsigned int const cell) const
 
   if(operator_data.convective_problem)
     convective_kernel->reinit_cell(cell);
+
+  if(operator_data.viscous_problem)
+    viscous_kernel->reinit_cell(cell, operator_data.quad_index);
 }
 
 template<int dim, typename Number>
@@ -229,7 +245,10 @@ MomentumOperator<dim, Number>::reinit_face(unsigned int const face) const
     convective_kernel->reinit_face(face);
 
   if(operator_data.viscous_problem)
-    viscous_kernel->reinit_face(*this->integrator_m, *this->integrator_p);
+    viscous_kernel->reinit_face(face,
+                                operator_data.quad_index,
+                                *this->integrator_m,
+                                *this->integrator_p);
 }
 
 template<int dim, typename Number>
@@ -242,7 +261,7 @@ MomentumOperator<dim, Number>::reinit_boundary_face(unsigned int const face) con
     convective_kernel->reinit_boundary_face(face);
 
   if(operator_data.viscous_problem)
-    viscous_kernel->reinit_boundary_face(*this->integrator_m);
+    viscous_kernel->reinit_boundary_face(face, operator_data.quad_index, *this->integrator_m);
 }
 
 template<int dim, typename Number>
@@ -257,13 +276,18 @@ MomentumOperator<dim, Number>::reinit_face_cell_based(unsigned int const       c
     convective_kernel->reinit_face_cell_based(cell, face, boundary_id);
 
   if(operator_data.viscous_problem)
-    viscous_kernel->reinit_face_cell_based(boundary_id, *this->integrator_m, *this->integrator_p);
+    viscous_kernel->reinit_face_cell_based(
+      cell, face, boundary_id, operator_data.quad_index, *this->integrator_m, *this->integrator_p);
 }
 
 template<int dim, typename Number>
 void
 MomentumOperator<dim, Number>::do_cell_integral(IntegratorCell & integrator) const
 {
+  scalar scaling_factor_mass_cell = make_vectorized_array<Number>(scaling_factor_mass);
+  if(cell_scaling_mass != nullptr)
+    scaling_factor_mass_cell *= integrator.read_cell_data(*cell_scaling_mass);
+
   for(unsigned int q = 0; q < integrator.n_q_points; ++q)
   {
     vector value_flux;
@@ -279,7 +303,7 @@ MomentumOperator<dim, Number>::do_cell_integral(IntegratorCell & integrator) con
 
     if(operator_data.unsteady_problem)
     {
-      value_flux += mass_kernel->get_volume_flux(scaling_factor_mass, value);
+      value_flux += mass_kernel->get_volume_flux(scaling_factor_mass_cell, value);
     }
 
     if(operator_data.convective_problem)
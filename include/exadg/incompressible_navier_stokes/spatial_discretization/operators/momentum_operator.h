@@ -105,6 +105,13 @@ public:
   void
   set_scaling_factor_mass_operator(Number const & number);
 
+  /*
+   * Additional cell-wise scaling of the mass term (one factor per cell of each cell batch), e.g.,
+   * for local time stepping. The cell-wise scaling is disabled for nullptr.
+   */
+  void
+  set_cell_scaling_mass_operator(AlignedVector<scalar> const * cell_scaling);
+
   /*
    * Interfaces of OperatorBase.
    */
@@ -174,6 +181,8 @@ private:
   std::shared_ptr<Operators::ViscousKernel<dim, Number>>    viscous_kernel;
 
   double scaling_factor_mass;
+
+  AlignedVector<scalar> const * cell_scaling_mass;
 };
 
 } // namespace IncNS
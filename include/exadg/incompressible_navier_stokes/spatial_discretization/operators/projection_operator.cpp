@@ -144,6 +144,16 @@ ProjectionOperator<dim, Number>::update(VectorType const & velocity, double cons
   time_step_size = dt;
 }
 
+template<int dim, typename Number>
+void
+ProjectionOperator<dim, Number>::set_velocity_and_time_step_size(VectorType const & velocity,
+                                                                 double const &     dt)
+{
+  this->velocity = &velocity;
+
+  time_step_size = dt;
+}
+
 template<int dim, typename Number>
 void
 ProjectionOperator<dim, Number>::reinit_cell(unsigned int const cell) const
@@ -115,6 +115,13 @@ public:
   void
   update(VectorType const & velocity, double const & dt);
 
+  /*
+   * Same as update(), but the penalty parameters are not calculated. This function is used if the
+   * penalty parameters are calculated by the kernels within another loop over all cells.
+   */
+  void
+  set_velocity_and_time_step_size(VectorType const & velocity, double const & dt);
+
 private:
   void
   reinit_cell(unsigned int const cell) const;
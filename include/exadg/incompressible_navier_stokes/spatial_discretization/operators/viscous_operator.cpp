@@ -28,6 +28,8 @@ ViscousOperator<dim, Number>::initialize(
 
   Base::reinit(matrix_free, affine_constraints, data);
 
+  kernel->initialize_quadrature(matrix_free, operator_data.quad_index);
+
   this->integrator_flags = kernel->get_integrator_flags();
 }
 
@@ -38,13 +40,22 @@ ViscousOperator<dim, Number>::update()
   kernel->calculate_penalty_parameter(this->get_matrix_free(), operator_data.dof_index);
 }
 
+template<int dim, typename Number>
+void
+ViscousOperator<dim, Number>::reinit_cell(unsigned int const cell) const
+{
+  Base::reinit_cell(cell);
+
+  kernel->reinit_cell(cell, operator_data.quad_index);
+}
+
 template<int dim, typename Number>
 void
 ViscousOperator<dim, Number>::reinit_face(unsigned int const face) const
 {
   Base::reinit_face(face);
 
-  kernel->reinit_face(*this->integrator_m, *this->integrator_p);
+  kernel->reinit_face(face, operator_data.quad_index, *this->integrator_m, *this->integrator_p);
 }
 
 template<int dim, typename Number>
@@ -53,7 +64,7 @@ ViscousOperator<dim, Number>::reinit_boundary_face(unsigned int const face) cons
 {
   Base::reinit_boundary_face(face);
 
-  kernel->reinit_boundary_face(*this->integrator_m);
+  kernel->reinit_boundary_face(face, operator_data.quad_index, *this->integrator_m);
 }
 
 template<int dim, typename Number>
@@ -64,7 +75,8 @@ ViscousOperator<dim, Number>::reinit_face_cell_based(unsigned int const       ce
 {
   Base::reinit_face_cell_based(cell, face, boundary_id);
 
-  kernel->reinit_face_cell_based(boundary_id, *this->integrator_m, *this->integrator_p);
+  kernel->reinit_face_cell_based(
+    cell, face, boundary_id, operator_data.quad_index, *this->integrator_m, *this->integrator_p);
 }
 
 template<int dim, typename Number>
@@ -177,6 +189,18 @@ ViscousOperator<dim, Number>::do_boundary_integral(IntegratorFace &           in
 {
   BoundaryTypeU boundary_type = operator_data.bc->get_boundary_type(boundary_id);
 
+  // the modeled wall shear stress is an inhomogeneous contribution
+  bool const wall_model =
+    boundary_type == BoundaryTypeU::WallModel && operator_type != OperatorType::homogeneous;
+
+  std::shared_ptr<Function<dim>> wall_distance;
+  if(wall_model)
+  {
+    kernel->reinit_boundary_face_wall_model(integrator.get_current_cell_index(),
+                                            operator_data.quad_index);
+    wall_distance = operator_data.bc->wall_model_bc.find(boundary_id)->second;
+  }
+
   for(unsigned int q = 0; q < integrator.n_q_points; ++q)
   {
     vector value_m = calculate_interior_value(q, integrator, operator_type);
@@ -209,6 +233,15 @@ ViscousOperator<dim, Number>::do_boundary_integral(IntegratorFace &           in
                                          this->time,
                                          kernel->get_data().variable_normal_vector);
 
+    if(wall_model)
+    {
+      scalar y = FunctionEvaluator<0, dim, Number>::value(wall_distance,
+                                                          integrator.quadrature_point(q),
+                                                          this->time);
+
+      normal_gradient_p += kernel->calculate_wall_model_normal_gradient(q, normal, y, viscosity);
+    }
+
     vector value_flux = kernel->calculate_value_flux(
       normal_gradient_m, normal_gradient_p, value_m, value_p, normal, viscosity);
 
@@ -8,6 +8,8 @@
 #ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_OPERATORS_VISCOUS_OPERATOR_H_
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_OPERATORS_VISCOUS_OPERATOR_H_
 
+#include <exadg/incompressible_navier_stokes/spatial_discretization/operators/turbulence_model_kernel.h>
+#include <exadg/incompressible_navier_stokes/spatial_discretization/operators/wall_model_kernel.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operators/weak_boundary_conditions.h>
 #include <exadg/incompressible_navier_stokes/user_interface/input_parameters.h>
 #include <exadg/matrix_free/integrators.h>
@@ -32,7 +34,9 @@ struct ViscousKernelData
       penalty_term_div_formulation(PenaltyTermDivergenceFormulation::Symmetrized),
       IP_formulation(InteriorPenaltyFormulation::SIPG),
       viscosity_is_variable(false),
-      variable_normal_vector(false)
+      variable_normal_vector(false),
+      turbulent_viscosity_on_the_fly(false),
+      use_wall_model(false)
   {
   }
 
@@ -43,12 +47,22 @@ struct ViscousKernelData
   InteriorPenaltyFormulation       IP_formulation;
   bool                             viscosity_is_variable;
   bool                             variable_normal_vector;
+
+  // evaluate the eddy viscosity of the turbulence model in every quadrature point instead of
+  // reading it from precomputed tables (only relevant if viscosity_is_variable == true)
+  bool turbulent_viscosity_on_the_fly;
+
+  // wall-stress boundary condition on boundaries of type BoundaryTypeU::WallModel
+  bool          use_wall_model;
+  WallModelData wall_model_data;
 };
 
 template<int dim, typename Number>
 class ViscousKernel
 {
 private:
+  typedef LinearAlgebra::distributed::Vector<Number> VectorType;
+
   typedef VectorizedArray<Number>                 scalar;
   typedef Tensor<1, dim, VectorizedArray<Number>> vector;
   typedef Tensor<2, dim, VectorizedArray<Number>> tensor;
@@ -57,7 +71,14 @@ private:
   typedef FaceIntegrator<dim, dim, Number> IntegratorFace;
 
 public:
-  ViscousKernel() : degree(1), tau(make_vectorized_array<Number>(0.0))
+  ViscousKernel()
+    : degree(1),
+      tau(make_vectorized_array<Number>(0.0)),
+      dof_index_velocity(0),
+      integrator_velocity(nullptr),
+      integrator_velocity_m(nullptr),
+      integrator_velocity_p(nullptr),
+      filter_width(nullptr)
   {
   }
 
@@ -68,6 +89,8 @@ public:
   {
     this->data = data;
 
+    dof_index_velocity = dof_index;
+
     FiniteElement<dim> const & fe = matrix_free.get_dof_handler(dof_index).get_fe();
     degree                        = fe.degree;
 
@@ -75,13 +98,101 @@ public:
 
     AssertThrow(data.viscosity >= 0.0, ExcMessage("Viscosity is not set!"));
 
-    if(data.viscosity_is_variable)
+    if(data.viscosity_is_variable && not(data.turbulent_viscosity_on_the_fly))
     {
       // allocate vectors for variable coefficients and initialize with constant viscosity
       viscosity_coefficients.initialize(matrix_free, degree, data.viscosity);
     }
   }
 
+  /*
+   * Initializes the on-the-fly evaluation of the turbulence model. The filter width is owned by
+   * the TurbulenceModel and has to outlive this kernel.
+   */
+  void
+  initialize_turbulence_model(MatrixFree<dim, Number> const & matrix_free,
+                              TurbulenceModelData const &     turbulence_model_data,
+                              AlignedVector<scalar> const &   filter_width_vector)
+  {
+    AssertThrow(data.viscosity_is_variable && data.turbulent_viscosity_on_the_fly,
+                ExcMessage("On-the-fly evaluation of turbulence model is not activated."));
+
+    AssertThrow(turbulence_model_data.dof_index == dof_index_velocity,
+                ExcMessage("Turbulence model has to use the velocity of the viscous kernel."));
+
+    turbulence_model_kernel.reinit(turbulence_model_data);
+
+    filter_width = &filter_width_vector;
+
+    initialize_quadrature(matrix_free, turbulence_model_data.quad_index);
+  }
+
+  /*
+   * Initializes the wall model, which evaluates the velocity field set via set_velocity_copy() on
+   * boundary faces of type BoundaryTypeU::WallModel.
+   */
+  void
+  initialize_wall_model(MatrixFree<dim, Number> const & matrix_free,
+                        unsigned int const              dof_index,
+                        unsigned int const              quad_index)
+  {
+    AssertThrow(data.use_wall_model, ExcMessage("Wall model is not activated."));
+
+    AssertThrow(dof_index == dof_index_velocity,
+                ExcMessage("Wall model has to use the velocity of the viscous kernel."));
+
+    wall_model_kernel.reinit(data.wall_model_data);
+
+    initialize_quadrature(matrix_free, quad_index);
+  }
+
+  /*
+   * Has to be called by every operator using this kernel with the quadrature rule of the
+   * operator. The eddy viscosity evaluated on the fly and the velocity of the wall model are
+   * computed in the quadrature points of the operator, which may differ between operators sharing
+   * this kernel (e.g. the viscous operator and the linearized momentum operator with
+   * over-integration). The precomputed tables of the eddy viscosity only exist for the standard
+   * quadrature rule with degree + 1 points per direction.
+   */
+  void
+  initialize_quadrature(MatrixFree<dim, Number> const & matrix_free, unsigned int const quad_index)
+  {
+    if(data.turbulent_viscosity_on_the_fly || data.use_wall_model)
+    {
+      if(integrators_velocity.find(quad_index) == integrators_velocity.end())
+      {
+        IntegratorsVelocity & integrators = integrators_velocity[quad_index];
+
+        integrators.cell.reset(new IntegratorCell(matrix_free, dof_index_velocity, quad_index));
+        integrators.face_m.reset(
+          new IntegratorFace(matrix_free, true, dof_index_velocity, quad_index));
+        integrators.face_p.reset(
+          new IntegratorFace(matrix_free, false, dof_index_velocity, quad_index));
+      }
+
+      if(velocity.size() == 0)
+        matrix_free.initialize_dof_vector(velocity, dof_index_velocity);
+    }
+    else if(data.viscosity_is_variable)
+    {
+      AssertThrow(matrix_free.get_quadrature(quad_index).size() ==
+                    Utilities::pow(degree + 1, dim),
+                  ExcMessage("The eddy viscosity is only stored for the standard quadrature rule. "
+                             "Use QuadratureRuleLinearization::Standard or evaluate the "
+                             "turbulence model on the fly."));
+    }
+  }
+
+  /*
+   * Sets the velocity field from which the eddy viscosity and the wall shear stress are computed.
+   */
+  void
+  set_velocity_copy(VectorType const & src)
+  {
+    velocity = src;
+    velocity.update_ghost_values();
+  }
+
   void
   calculate_penalty_parameter(MatrixFree<dim, Number> const & matrix_free,
                               unsigned int const              dof_index)
@@ -150,22 +261,68 @@ public:
   }
 
   void
-  reinit_face(IntegratorFace & integrator_m, IntegratorFace & integrator_p) const
+  reinit_cell(unsigned int const cell, unsigned int const quad_index) const
+  {
+    if(data.turbulent_viscosity_on_the_fly)
+    {
+      select_integrators_velocity(quad_index);
+
+      integrator_velocity->reinit(cell);
+      integrator_velocity->gather_evaluate(velocity, false, true, false);
+
+      filter_width_m = integrator_velocity->read_cell_data(*filter_width);
+    }
+  }
+
+  void
+  reinit_face(unsigned int const face,
+              unsigned int const quad_index,
+              IntegratorFace &   integrator_m,
+              IntegratorFace &   integrator_p) const
   {
     tau = std::max(integrator_m.read_cell_data(array_penalty_parameter),
                    integrator_p.read_cell_data(array_penalty_parameter)) *
           IP::get_penalty_factor<Number>(degree, data.IP_factor);
+
+    if(data.turbulent_viscosity_on_the_fly)
+    {
+      select_integrators_velocity(quad_index);
+
+      integrator_velocity_m->reinit(face);
+      integrator_velocity_m->gather_evaluate(velocity, false, true);
+
+      integrator_velocity_p->reinit(face);
+      integrator_velocity_p->gather_evaluate(velocity, false, true);
+
+      filter_width_m = integrator_velocity_m->read_cell_data(*filter_width);
+      filter_width_p = integrator_velocity_p->read_cell_data(*filter_width);
+    }
   }
 
   void
-  reinit_boundary_face(IntegratorFace & integrator_m) const
+  reinit_boundary_face(unsigned int const face,
+                       unsigned int const quad_index,
+                       IntegratorFace &   integrator_m) const
   {
     tau = integrator_m.read_cell_data(array_penalty_parameter) *
           IP::get_penalty_factor<Number>(degree, data.IP_factor);
+
+    if(data.turbulent_viscosity_on_the_fly)
+    {
+      select_integrators_velocity(quad_index);
+
+      integrator_velocity_m->reinit(face);
+      integrator_velocity_m->gather_evaluate(velocity, false, true);
+
+      filter_width_m = integrator_velocity_m->read_cell_data(*filter_width);
+    }
   }
 
   void
-  reinit_face_cell_based(types::boundary_id const boundary_id,
+  reinit_face_cell_based(unsigned int const       cell,
+                         unsigned int const       face,
+                         types::boundary_id const boundary_id,
+                         unsigned int const       quad_index,
                          IntegratorFace &         integrator_m,
                          IntegratorFace &         integrator_p) const
   {
@@ -180,6 +337,62 @@ public:
       tau = integrator_m.read_cell_data(array_penalty_parameter) *
             IP::get_penalty_factor<Number>(degree, data.IP_factor);
     }
+
+    if(data.turbulent_viscosity_on_the_fly)
+    {
+      select_integrators_velocity(quad_index);
+
+      integrator_velocity_m->reinit(cell, face);
+      integrator_velocity_m->gather_evaluate(velocity, false, true);
+
+      filter_width_m = integrator_velocity_m->read_cell_data(*filter_width);
+
+      if(boundary_id == numbers::internal_face_boundary_id) // internal face
+      {
+        integrator_velocity_p->reinit(cell, face);
+        integrator_velocity_p->gather_evaluate(velocity, false, true);
+
+        filter_width_p = integrator_velocity_p->read_cell_data(*filter_width);
+      }
+    }
+  }
+
+  /*
+   * Evaluates the velocity on a boundary face for the wall model. This is only needed if
+   * inhomogeneous contributions of the viscous operator are evaluated.
+   */
+  void
+  reinit_boundary_face_wall_model(unsigned int const face, unsigned int const quad_index) const
+  {
+    select_integrators_velocity(quad_index);
+
+    integrator_velocity_m->reinit(face);
+    integrator_velocity_m->gather_evaluate(velocity, true, data.turbulent_viscosity_on_the_fly);
+  }
+
+  /*
+   * Returns the part of the exterior normal gradient F(u⁺)*n on wall-modeled boundaries that
+   * prescribes the wall shear stress, i.e., the average {{F(u)}}*n contains the tangential
+   * traction tau_w / viscosity. The wall shear stress is computed from the tangential part of the
+   * interior velocity in the boundary quadrature point (exchange location) and the wall distance
+   * assigned to it. The law of the wall is evaluated with the laminar viscosity.
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    vector
+    calculate_wall_model_normal_gradient(unsigned int const q,
+                                         vector const &     normal,
+                                         scalar const &     wall_distance,
+                                         scalar const &     viscosity) const
+  {
+    vector u_m                 = integrator_velocity_m->get_value(q);
+    vector velocity_tangential = u_m - (u_m * normal) * normal;
+
+    vector wall_shear_stress =
+      wall_model_kernel.calculate_wall_shear_stress(velocity_tangential,
+                                                    wall_distance,
+                                                    make_vectorized_array<Number>(data.viscosity));
+
+    return 2.0 * wall_shear_stress / viscosity;
   }
 
   /*
@@ -193,7 +406,11 @@ public:
 
     if(data.viscosity_is_variable)
     {
-      viscosity = viscosity_coefficients.get_coefficient_cell(cell, q);
+      if(data.turbulent_viscosity_on_the_fly)
+        viscosity = turbulence_model_kernel.calculate_viscosity(
+          filter_width_m, integrator_velocity->get_gradient(q));
+      else
+        viscosity = viscosity_coefficients.get_coefficient_cell(cell, q);
     }
 
     return viscosity;
@@ -208,9 +425,20 @@ public:
   {
     scalar average_viscosity = make_vectorized_array<Number>(0.0);
 
-    scalar coefficient_face = viscosity_coefficients.get_coefficient_face(face, q);
-    scalar coefficient_face_neighbor =
-      viscosity_coefficients.get_coefficient_face_neighbor(face, q);
+    scalar coefficient_face, coefficient_face_neighbor;
+
+    if(data.turbulent_viscosity_on_the_fly)
+    {
+      coefficient_face = turbulence_model_kernel.calculate_viscosity(
+        filter_width_m, integrator_velocity_m->get_gradient(q));
+      coefficient_face_neighbor = turbulence_model_kernel.calculate_viscosity(
+        filter_width_p, integrator_velocity_p->get_gradient(q));
+    }
+    else
+    {
+      coefficient_face          = viscosity_coefficients.get_coefficient_face(face, q);
+      coefficient_face_neighbor = viscosity_coefficients.get_coefficient_face_neighbor(face, q);
+    }
 
     // harmonic mean (harmonic weighting according to Schott and Rasthofer et al. (2015))
     average_viscosity = 2.0 * coefficient_face * coefficient_face_neighbor /
@@ -253,7 +481,11 @@ public:
 
     if(data.viscosity_is_variable)
     {
-      viscosity = viscosity_coefficients.get_coefficient_face(face, q);
+      if(data.turbulent_viscosity_on_the_fly)
+        viscosity = turbulence_model_kernel.calculate_viscosity(
+          filter_width_m, integrator_velocity_m->get_gradient(q));
+      else
+        viscosity = viscosity_coefficients.get_coefficient_face(face, q);
     }
 
     return viscosity;
@@ -486,6 +718,19 @@ public:
   }
 
 private:
+  void
+  select_integrators_velocity(unsigned int const quad_index) const
+  {
+    auto const it = integrators_velocity.find(quad_index);
+
+    Assert(it != integrators_velocity.end(),
+           ExcMessage("Quadrature rule not initialized, see initialize_quadrature()."));
+
+    integrator_velocity   = it->second.cell.get();
+    integrator_velocity_m = it->second.face_m.get();
+    integrator_velocity_p = it->second.face_p.get();
+  }
+
   ViscousKernelData data;
 
   unsigned int degree;
@@ -495,6 +740,35 @@ private:
   mutable scalar tau;
 
   VariableCoefficients<dim, Number> viscosity_coefficients;
+
+  // velocity field for the turbulence model and the wall model
+  unsigned int dof_index_velocity;
+  VectorType   velocity;
+
+  struct IntegratorsVelocity
+  {
+    std::shared_ptr<IntegratorCell> cell;
+    std::shared_ptr<IntegratorFace> face_m;
+    std::shared_ptr<IntegratorFace> face_p;
+  };
+
+  // integrators for the quadrature rules of all operators using this kernel
+  std::map<unsigned int, IntegratorsVelocity> integrators_velocity;
+
+  // integrators for the quadrature rule of the current cell or face
+  mutable IntegratorCell * integrator_velocity;
+  mutable IntegratorFace * integrator_velocity_m;
+  mutable IntegratorFace * integrator_velocity_p;
+
+  // on-the-fly evaluation of the turbulence model
+  TurbulenceModelKernel<dim, Number> turbulence_model_kernel;
+
+  AlignedVector<scalar> const * filter_width;
+
+  mutable scalar filter_width_m;
+  mutable scalar filter_width_p;
+
+  WallModelKernel<dim, Number> wall_model_kernel;
 };
 
 } // namespace Operators
@@ -536,6 +810,9 @@ public:
   update();
 
 private:
+  void
+  reinit_cell(unsigned int const cell) const;
+
   void
   reinit_face(unsigned int const face) const;
 
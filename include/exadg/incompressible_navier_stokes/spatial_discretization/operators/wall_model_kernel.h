@@ -0,0 +1,150 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_OPERATORS_WALL_MODEL_KERNEL_H_
+#define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_OPERATORS_WALL_MODEL_KERNEL_H_
+
+// deal.II
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+using namespace dealii;
+
+/*
+ *  Wall model data.
+ */
+struct WallModelData
+{
+  WallModelData() : kappa(0.41), B(5.2), max_iterations(20), tolerance(1.e-8)
+  {
+  }
+
+  // von Karman constant
+  double kappa;
+
+  // additive constant of the logarithmic law of the wall
+  double B;
+
+  // Newton solver for the friction velocity
+  unsigned int max_iterations;
+  double       tolerance;
+};
+
+namespace Operators
+{
+/*
+ *  Algebraic equilibrium wall model for wall-modeled LES.
+ *
+ *  The friction velocity u_tau is obtained from the law of the wall by Spalding (1961)
+ *
+ *    y^+ = u^+ + exp(-kappa*B) * (exp(kappa*u^+) - 1 - kappa*u^+ - (kappa*u^+)^2/2
+ *                                  - (kappa*u^+)^3/6)
+ *
+ *  with u^+ = |u_t| / u_tau and y^+ = y * u_tau / nu, where u_t is the tangential velocity at
+ *  the exchange location and y its distance from the wall. Since y^+ * u^+ = y * |u_t| / nu is
+ *  known, the law of the wall is solved for u^+ by Newton's method. The function u^+ * y^+(u^+) is
+ *  convex and monotonically increasing so that Newton's method converges from any positive
+ *  initial guess.
+ */
+template<int dim, typename Number>
+class WallModelKernel
+{
+private:
+  typedef VectorizedArray<Number>                 scalar;
+  typedef Tensor<1, dim, VectorizedArray<Number>> vector;
+
+public:
+  void
+  reinit(WallModelData const & data)
+  {
+    this->data = data;
+
+    exp_kappa_B = std::exp(-data.kappa * data.B);
+  }
+
+  /*
+   *  Returns the (kinematic) wall shear stress -u_tau^2 * u_t / |u_t| acting on the fluid for a
+   *  given tangential velocity u_t, wall distance y, and (laminar) kinematic viscosity nu.
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    vector
+    calculate_wall_shear_stress(vector const & velocity_tangential,
+                                scalar const & wall_distance,
+                                scalar const & viscosity) const
+  {
+    scalar const velocity_magnitude = velocity_tangential.norm();
+
+    // y^+ * u^+, bounded from below to avoid a division by zero for vanishing velocities
+    scalar const reynolds_number = std::max(wall_distance * velocity_magnitude / viscosity,
+                                            make_vectorized_array<Number>(1.e-12));
+
+    // The initial guess u^+ = sqrt(y^+ * u^+) corresponds to the viscous sublayer. It is bounded
+    // from above to avoid an overflow of exp(kappa*u^+).
+    scalar u_plus = std::min(std::sqrt(reynolds_number), make_vectorized_array<Number>(25.0));
+
+    Number const kappa = data.kappa;
+
+    for(unsigned int i = 0; i < data.max_iterations; ++i)
+    {
+      scalar const k_u   = kappa * u_plus;
+      scalar const exp_u = std::exp(k_u);
+
+      scalar const y_plus =
+        u_plus + exp_kappa_B * (exp_u - 1.0 - k_u - 0.5 * k_u * k_u - k_u * k_u * k_u / 6.0);
+      scalar const dy_plus = 1.0 + exp_kappa_B * kappa * (exp_u - 1.0 - k_u - 0.5 * k_u * k_u);
+
+      scalar const increment = (u_plus * y_plus - reynolds_number) / (y_plus + u_plus * dy_plus);
+
+      u_plus -= increment;
+
+      bool converged = true;
+      for(unsigned int v = 0; v < VectorizedArray<Number>::size(); ++v)
+      {
+        if(std::abs(increment[v]) > data.tolerance * std::abs(u_plus[v]))
+          converged = false;
+      }
+
+      if(converged)
+        break;
+    }
+
+    // u_tau^2 / |u_t| = |u_t| / (u^+)^2
+    scalar const factor = velocity_magnitude / (u_plus * u_plus);
+
+    return -factor * velocity_tangential;
+  }
+
+private:
+  WallModelData data;
+
+  Number exp_kappa_B;
+};
+
+} // namespace Operators
+} // namespace IncNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_OPERATORS_WALL_MODEL_KERNEL_H_ \
+        */
@@ -37,6 +37,7 @@ using namespace dealii;
  *  | inhomogeneous operator  | u⁺ = -u⁻ + 2g , u⁻ = 0  | u⁺ = u⁻ , u⁻ = 0   | u⁺ = u⁻ - 2 (u⁻*n)n , u⁻ = 0 |
  *  +-------------------------+-------------------------+--------------------+------------------------------+
  *
+ *  Wall-modeled boundaries are treated as symmetry boundaries.
  */
 // clang-format on
 template<int dim, typename Number>
@@ -121,7 +122,7 @@ inline DEAL_II_ALWAYS_INLINE //
   {
     value_p = value_m;
   }
-  else if(boundary_type == BoundaryTypeU::Symmetry)
+  else if(boundary_type == BoundaryTypeU::Symmetry || boundary_type == BoundaryTypeU::WallModel)
   {
     Tensor<1, dim, VectorizedArray<Number>> normal_m = integrator.get_normal_vector(q);
 
@@ -202,7 +203,7 @@ inline DEAL_II_ALWAYS_INLINE //
   {
     u_p = u_m;
   }
-  else if(boundary_type == BoundaryTypeU::Symmetry)
+  else if(boundary_type == BoundaryTypeU::Symmetry || boundary_type == BoundaryTypeU::WallModel)
   {
     Tensor<1, dim, VectorizedArray<Number>> normal_m = integrator.get_normal_vector(q);
 
@@ -250,7 +251,7 @@ inline DEAL_II_ALWAYS_INLINE //
   {
     value_p = value_m;
   }
-  else if(boundary_type == BoundaryTypeU::Symmetry)
+  else if(boundary_type == BoundaryTypeU::Symmetry || boundary_type == BoundaryTypeU::WallModel)
   {
     Tensor<1, dim, VectorizedArray<Number>> normal_m = integrator_bc.get_normal_vector(q);
 
@@ -424,6 +425,9 @@ inline DEAL_II_ALWAYS_INLINE //
  *  +-------------------------+---------------------------------+---------------------------------------+----------------------------------------------------+
  *  | inhomogeneous operator  | {{F(u)}}*n = 0                  | {{F(u)}}*n = h                        | {{F(u)}}*n = 0                                     |
  *  +-------------------------+---------------------------------+---------------------------------------+----------------------------------------------------+
+ *
+ *  Wall-modeled boundaries are treated as symmetry boundaries here. The viscous operator adds the
+ *  modeled wall shear stress for the full and inhomogeneous operators.
  */
 // clang-format on
 
@@ -476,7 +480,7 @@ inline DEAL_II_ALWAYS_INLINE //
       AssertThrow(false, ExcMessage("Specified OperatorType is not implemented!"));
     }
   }
-  else if(boundary_type == BoundaryTypeU::Symmetry)
+  else if(boundary_type == BoundaryTypeU::Symmetry || boundary_type == BoundaryTypeU::WallModel)
   {
     auto normal_m     = integrator.get_normal_vector(q);
     normal_gradient_p = -normal_gradient_m + 2.0 * (normal_gradient_m * normal_m) * normal_m;
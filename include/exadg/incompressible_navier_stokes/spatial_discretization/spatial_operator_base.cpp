@@ -25,6 +25,7 @@
 // ExaDG
 #include <exadg/incompressible_navier_stokes/preconditioners/multigrid_preconditioner_projection.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/spatial_operator_base.h>
+#include <exadg/matrix_free/dof_renumbering.h>
 #include <exadg/solvers_and_preconditioners/preconditioner/inverse_mass_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioner/jacobi_preconditioner.h>
 #include <exadg/time_integration/time_step_calculation.h>
@@ -277,6 +278,26 @@ SpatialOperatorBase<dim, Number>::distribute_dofs()
   pcout << std::flush;
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::renumber_dofs(
+  MatrixFreeData<dim, Number> const & matrix_free_data)
+{
+  // there are no constraints for DG discretizations
+  renumber_dofs_for_data_locality(dof_handler_u, constraint_u, matrix_free_data.data);
+  renumber_dofs_for_data_locality(dof_handler_p, constraint_p, matrix_free_data.data);
+  renumber_dofs_for_data_locality(dof_handler_u_scalar,
+                                  constraint_u_scalar,
+                                  matrix_free_data.data);
+
+  // the DoF index used to fix the pressure level refers to the DoF numbering
+  if(is_pressure_level_undefined() &&
+     param.adjust_pressure_level == AdjustPressureLevel::ApplyAnalyticalSolutionInPoint)
+  {
+    initialization_pure_dirichlet_bc();
+  }
+}
+
 template<int dim, typename Number>
 types::global_dof_index
 SpatialOperatorBase<dim, Number>::get_number_of_dofs() const
@@ -308,8 +329,19 @@ SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_i
   viscous_kernel_data.IP_formulation               = param.IP_formulation_viscous;
   viscous_kernel_data.viscosity_is_variable        = param.use_turbulence_model;
   viscous_kernel_data.variable_normal_vector       = param.neumann_with_variable_normal_vector;
+  viscous_kernel_data.turbulent_viscosity_on_the_fly =
+    param.use_turbulence_model && param.turbulence_model_on_the_fly;
+  viscous_kernel_data.use_wall_model                 = use_wall_model();
+  viscous_kernel_data.wall_model_data.kappa          = param.wall_model_kappa;
+  viscous_kernel_data.wall_model_data.B              = param.wall_model_B;
+  viscous_kernel_data.wall_model_data.max_iterations = param.wall_model_newton_max_iterations;
+  viscous_kernel_data.wall_model_data.tolerance      = param.wall_model_newton_tolerance;
   viscous_kernel.reset(new Operators::ViscousKernel<dim, Number>());
   viscous_kernel->reinit(*matrix_free, viscous_kernel_data, get_dof_index_velocity());
+  if(viscous_kernel_data.use_wall_model)
+    viscous_kernel->initialize_wall_model(*matrix_free,
+                                          get_dof_index_velocity(),
+                                          get_quad_index_velocity_linear());
 
   AffineConstraints<Number> constraint_dummy;
   constraint_dummy.close();
@@ -537,6 +569,10 @@ SpatialOperatorBase<dim, Number>::initialize_calculators_for_derived_quantities(
                                     get_dof_index_velocity(),
                                     get_dof_index_velocity_scalar(),
                                     get_quad_index_velocity_linear());
+  derived_quantity_calculator.initialize(*matrix_free,
+                                         get_dof_index_velocity(),
+                                         get_dof_index_velocity_scalar(),
+                                         get_quad_index_velocity_linear());
 }
 
 template<int dim, typename Number>
@@ -741,7 +777,9 @@ SpatialOperatorBase<dim, Number>::get_viscosity_boundary_face(unsigned int const
 {
   VectorizedArray<Number> viscosity = make_vectorized_array<Number>(get_viscosity());
 
-  bool const viscosity_is_variable = param.use_turbulence_model;
+  // the eddy viscosity is not tabulated if it is evaluated on the fly by the viscous kernel
+  bool const viscosity_is_variable =
+    param.use_turbulence_model && not(param.turbulence_model_on_the_fly);
   if(viscosity_is_variable)
     viscous_kernel->get_coefficient_face(face, q);
 
@@ -898,6 +936,23 @@ SpatialOperatorBase<dim, Number>::calculate_time_step_cfl(VectorType const & vel
                                                     mpi_comm);
 }
 
+template<int dim, typename Number>
+double
+SpatialOperatorBase<dim, Number>::get_time_step_cfl_convective_term(
+  double const cfl,
+  double const exponent_degree) const
+{
+  AssertThrow(time_step_cfl_convective_term.is_active(),
+              ExcMessage("The time step size has not been calculated by the convective operator."));
+
+  double time_step = cfl / pow(degree_u, exponent_degree) * time_step_cfl_convective_term.get();
+
+  // see calculate_time_step_cfl_local() for the reason of cutting digits
+  time_step = Utilities::truncate_to_n_digits(time_step, 4);
+
+  return time_step;
+}
+
 template<int dim, typename Number>
 void
 SpatialOperatorBase<dim, Number>::calculate_cfl_from_time_step(VectorType &       cfl,
@@ -915,6 +970,69 @@ SpatialOperatorBase<dim, Number>::calculate_cfl_from_time_step(VectorType &
                              param.cfl_exponent_fe_degree_velocity);
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::update_local_time_steps(VectorType const & velocity,
+                                                          double const       time_step_size,
+                                                          double const       cfl,
+                                                          double const       exponent_degree)
+{
+  AssertThrow(param.use_local_time_stepping,
+              ExcMessage("Local time stepping has not been activated in the parameters."));
+
+  CellIntegrator<dim, dim, Number> integrator(*matrix_free,
+                                              get_dof_index_velocity(),
+                                              get_quad_index_velocity_linear());
+
+  local_time_step_factors.resize(matrix_free->n_cell_batches());
+  if(local_time_step_factors_dofs.size() == 0)
+    initialize_vector_velocity(local_time_step_factors_dofs);
+
+  scalar const cfl_degree = make_vectorized_array<Number>(cfl / pow(degree_u, exponent_degree));
+
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    integrator.reinit(cell);
+    integrator.gather_evaluate(velocity, true, false);
+
+    scalar time_step_local;
+    if(param.adaptive_time_stepping_cfl_type == CFLConditionType::VelocityNorm)
+      time_step_local = calculate_time_step_cfl_cells<CFLConditionType::VelocityNorm>(integrator);
+    else if(param.adaptive_time_stepping_cfl_type == CFLConditionType::VelocityComponents)
+      time_step_local =
+        calculate_time_step_cfl_cells<CFLConditionType::VelocityComponents>(integrator);
+    else
+      AssertThrow(false, ExcMessage("Not implemented."));
+
+    time_step_local = std::min(cfl_degree * time_step_local,
+                               make_vectorized_array<Number>(param.time_step_size_max));
+
+    local_time_step_factors[cell] = make_vectorized_array<Number>(time_step_size) / time_step_local;
+
+    // write the factors into all degrees of freedom of the cells
+    for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+      integrator.begin_dof_values()[i] = local_time_step_factors[cell];
+    integrator.set_dof_values(local_time_step_factors_dofs);
+  }
+
+  momentum_operator.set_cell_scaling_mass_operator(&local_time_step_factors);
+}
+
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::apply_local_time_step_scaling(VectorType & velocity) const
+{
+  if(param.use_local_time_stepping)
+  {
+    AssertThrow(local_time_step_factors_dofs.size() == velocity.size(),
+                ExcMessage("Local time steps have not been calculated."));
+
+    // the mass matrix is block-diagonal for discontinuous Galerkin discretizations, i.e., the
+    // cell-wise scaling commutes with the mass matrix
+    velocity.scale(local_time_step_factors_dofs);
+  }
+}
+
 
 template<int dim, typename Number>
 void
@@ -1100,6 +1218,9 @@ SpatialOperatorBase<dim, Number>::compute_streamfunction(VectorType &       dst,
   AssertThrow(boundary_descriptor_velocity->symmetry_bc.empty() == true,
               ExcMessage("Assumption is not fulfilled. Streamfunction calculator is "
                          "not implemented for this type of boundary conditions."));
+  AssertThrow(boundary_descriptor_velocity->wall_model_bc.empty() == true,
+              ExcMessage("Assumption is not fulfilled. Streamfunction calculator is "
+                         "not implemented for this type of boundary conditions."));
 
   laplace_operator_data.bc = boundary_descriptor_streamfunction;
 
@@ -1161,6 +1282,24 @@ SpatialOperatorBase<dim, Number>::compute_q_criterion(VectorType &       dst,
   inverse_mass_velocity_scalar.apply(dst, dst);
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::compute_derived_quantities(
+  std::vector<VectorType *> const &    dst,
+  std::vector<DerivedQuantity> const & quantities,
+  VectorType const &                   src) const
+{
+  derived_quantity_calculator.compute(dst, quantities, src);
+
+  for(unsigned int i = 0; i < quantities.size(); ++i)
+  {
+    if(quantities[i] == DerivedQuantity::Vorticity)
+      inverse_mass_velocity.apply(*dst[i], *dst[i]);
+    else
+      inverse_mass_velocity_scalar.apply(*dst[i], *dst[i]);
+  }
+}
+
 template<int dim, typename Number>
 void
 SpatialOperatorBase<dim, Number>::apply_inverse_mass_operator(VectorType &       dst,
@@ -1186,6 +1325,20 @@ SpatialOperatorBase<dim, Number>::evaluate_convective_term(VectorType &       ds
   convective_operator.evaluate_nonlinear_operator(dst, src, time);
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::evaluate_convective_term_and_calculate_time_step_cfl(
+  VectorType &       dst,
+  VectorType const & src,
+  Number const       time) const
+{
+  double const time_step_local =
+    convective_operator.evaluate_nonlinear_operator_and_calculate_time_step_cfl(
+      dst, src, time, param.adaptive_time_stepping_cfl_type);
+
+  time_step_cfl_convective_term.start(time_step_local, mpi_comm);
+}
+
 template<int dim, typename Number>
 void
 SpatialOperatorBase<dim, Number>::evaluate_pressure_gradient_term(VectorType &       dst,
@@ -1244,6 +1397,21 @@ SpatialOperatorBase<dim, Number>::update_turbulence_model(VectorType const & vel
   turbulence_model.calculate_turbulent_viscosity(velocity);
 }
 
+template<int dim, typename Number>
+bool
+SpatialOperatorBase<dim, Number>::use_wall_model() const
+{
+  return not(boundary_descriptor_velocity->wall_model_bc.empty());
+}
+
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::update_wall_model(VectorType const & velocity)
+{
+  // the wall shear stress is evaluated in the boundary integrals of the viscous operator
+  viscous_kernel->set_velocity_copy(velocity);
+}
+
 template<int dim, typename Number>
 double
 SpatialOperatorBase<dim, Number>::calculate_dissipation_convective_term(VectorType const & velocity,
@@ -1448,6 +1616,9 @@ SpatialOperatorBase<dim, Number>::setup_projection_solver()
 
       FiniteElement<dim> const & fe = dof_handler.get_fe();
 
+      if(this->param.use_dof_renumbering)
+        mg_preconditioner->set_dof_numbering_fine_level(dof_handler);
+
       mg_preconditioner->initialize(this->param.multigrid_data_projection,
                                     tria,
                                     fe,
@@ -1561,6 +1732,135 @@ SpatialOperatorBase<dim, Number>::solve_projection(VectorType &       dst,
   return n_iter;
 }
 
+template<int dim, typename Number>
+bool
+SpatialOperatorBase<dim, Number>::apply_projection_step_fused(
+  VectorType &       dst,
+  VectorType &       rhs,
+  VectorType const & velocity,
+  double const       scaling_factor,
+  VectorType const * velocity_penalty,
+  double const       time_step_size) const
+{
+  bool const penalty_terms = velocity_penalty != nullptr;
+
+  if(penalty_terms)
+  {
+    AssertThrow(projection_operator.get() != 0,
+                ExcMessage("Projection operator is not initialized."));
+
+    projection_operator->set_velocity_and_time_step_size(*velocity_penalty, time_step_size);
+
+    velocity_penalty->update_ghost_values();
+  }
+
+  // divergence penalty only -> local, elementwise problem that is solved directly in this loop
+  bool const solve_elementwise =
+    penalty_terms && elementwise_projection_operator.get() != nullptr;
+
+  CellIntegrator<dim, dim, Number> integrator(*matrix_free,
+                                              get_dof_index_velocity(),
+                                              get_quad_index_velocity_linear());
+  CellIntegrator<dim, dim, Number> integrator_penalty(*matrix_free,
+                                                      get_dof_index_velocity(),
+                                                      get_quad_index_velocity_linear());
+
+  MatrixFreeOperators::CellwiseInverseMassMatrix<dim, -1, dim, Number> inverse_mass(integrator);
+
+  unsigned int const dofs_per_cell = integrator.dofs_per_cell;
+
+  AlignedVector<scalar> rhs_cell(dofs_per_cell);
+  AlignedVector<scalar> solution_cell(dofs_per_cell);
+
+  typedef Elementwise::SolverCG<scalar, ELEMENTWISE_PROJ_OPERATOR, ELEMENTWISE_PRECONDITIONER>
+    ELEMENTWISE_SOLVER;
+
+  std::shared_ptr<ELEMENTWISE_SOLVER> elementwise_solver;
+  if(solve_elementwise)
+  {
+    SolverData solver_data;
+    solver_data.abs_tol = param.solver_data_projection.abs_tol;
+    solver_data.rel_tol = param.solver_data_projection.rel_tol;
+
+    elementwise_solver.reset(new ELEMENTWISE_SOLVER(dofs_per_cell, solver_data));
+  }
+
+  Number const factor = scaling_factor;
+
+  unsigned int const n_cells = matrix_free->n_cell_batches();
+  for(unsigned int cell = 0; cell < n_cells; ++cell)
+  {
+    // penalty parameters
+    if(penalty_terms)
+    {
+      integrator_penalty.reinit(cell);
+      integrator_penalty.read_dof_values(*velocity_penalty);
+      integrator_penalty.evaluate(true, false);
+
+      if(param.use_divergence_penalty)
+        div_penalty_kernel->calculate_penalty_parameter(integrator_penalty, cell);
+      if(param.use_continuity_penalty)
+        conti_penalty_kernel->calculate_penalty_parameter(integrator_penalty, cell);
+    }
+
+    // mass operator
+    integrator.reinit(cell);
+    integrator.read_dof_values(velocity);
+    integrator.evaluate(true, false);
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+      integrator.submit_value(integrator.get_value(q), q);
+    integrator.integrate(true, false);
+
+    for(unsigned int i = 0; i < dofs_per_cell; ++i)
+      rhs_cell[i] = integrator.begin_dof_values()[i];
+
+    // right-hand side
+    integrator.read_dof_values(rhs);
+    for(unsigned int i = 0; i < dofs_per_cell; ++i)
+    {
+      rhs_cell[i] += factor * integrator.begin_dof_values()[i];
+      integrator.begin_dof_values()[i] = rhs_cell[i];
+    }
+    integrator.set_dof_values(rhs);
+
+    // solution of the cell-local problem or inverse mass operator
+    if(solve_elementwise)
+    {
+      elementwise_projection_operator->setup(cell, dofs_per_cell);
+      elementwise_preconditioner_projection->setup(cell);
+
+      elementwise_solver->solve(elementwise_projection_operator.get(),
+                                solution_cell.begin(),
+                                rhs_cell.begin(),
+                                elementwise_preconditioner_projection.get());
+
+      for(unsigned int i = 0; i < dofs_per_cell; ++i)
+        integrator.begin_dof_values()[i] = solution_cell[i];
+    }
+    else
+    {
+      inverse_mass.apply(rhs_cell.begin(), integrator.begin_dof_values());
+    }
+
+    integrator.set_dof_values(dst);
+  }
+
+  // the face integrals of the continuity penalty term require the penalty parameter of ghost cells
+  if(penalty_terms && param.use_continuity_penalty)
+  {
+    for(unsigned int cell = n_cells; cell < n_cells + matrix_free->n_ghost_cell_batches(); ++cell)
+    {
+      integrator_penalty.reinit(cell);
+      integrator_penalty.read_dof_values(*velocity_penalty);
+      integrator_penalty.evaluate(true, false);
+
+      conti_penalty_kernel->calculate_penalty_parameter(integrator_penalty, cell);
+    }
+  }
+
+  return (not penalty_terms) || solve_elementwise;
+}
+
 template<int dim, typename Number>
 void
 SpatialOperatorBase<dim, Number>::local_interpolate_velocity_dirichlet_bc_boundary_face(
@@ -1622,7 +1922,8 @@ SpatialOperatorBase<dim, Number>::local_interpolate_velocity_dirichlet_bc_bounda
     else
     {
       AssertThrow(boundary_type == BoundaryTypeU::Neumann ||
-                    boundary_type == BoundaryTypeU::Symmetry,
+                    boundary_type == BoundaryTypeU::Symmetry ||
+                    boundary_type == BoundaryTypeU::WallModel,
                   ExcMessage("BoundaryTypeU not implemented."));
     }
   }
@@ -1736,7 +2037,8 @@ SpatialOperatorBase<dim, Number>::local_interpolate_stress_bc_boundary_face(
     {
       AssertThrow(boundary_type == BoundaryTypeU::Dirichlet ||
                     boundary_type == BoundaryTypeU::Neumann ||
-                    boundary_type == BoundaryTypeU::Symmetry,
+                    boundary_type == BoundaryTypeU::Symmetry ||
+                    boundary_type == BoundaryTypeU::WallModel,
                   ExcMessage("BoundaryTypeU not implemented."));
     }
   }
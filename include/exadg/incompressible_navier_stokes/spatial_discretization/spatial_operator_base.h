@@ -28,6 +28,7 @@
 #include <deal.II/fe/mapping_q.h>
 
 // ExaDG
+#include <exadg/incompressible_navier_stokes/spatial_discretization/calculators/derived_quantity_calculator.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/calculators/divergence_calculator.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/calculators/q_criterion_calculator.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/calculators/streamfunction_calculator_rhs_operator.h>
@@ -51,6 +52,7 @@
 #include <exadg/poisson/spatial_discretization/laplace_operator.h>
 #include <exadg/solvers_and_preconditioners/preconditioner/preconditioner_base.h>
 #include <exadg/time_integration/interpolate.h>
+#include <exadg/time_integration/time_step_calculation.h>
 
 namespace ExaDG
 {
@@ -164,6 +166,14 @@ public:
   void
   fill_matrix_free_data(MatrixFreeData<dim, Number> & matrix_free_data) const;
 
+  /*
+   * Renumbers the degrees of freedom for data locality in the matrix-free loops set up with
+   * matrix_free_data (parameter use_dof_renumbering). Has to be called after
+   * fill_matrix_free_data() and before MatrixFree is initialized.
+   */
+  void
+  renumber_dofs(MatrixFreeData<dim, Number> const & matrix_free_data);
+
   /*
    * Setup function. Initializes basic finite element components, matrix-free object, and basic
    * operators. This function does not perform the setup related to the solution of linear systems
@@ -313,12 +323,37 @@ public:
                           double const       cfl,
                           double const       exponent_degree) const;
 
+  // Time step size according to local CFL criterion for the velocity of the last call of
+  // evaluate_convective_term_and_calculate_time_step_cfl()
+  double
+  get_time_step_cfl_convective_term(double const cfl, double const exponent_degree) const;
+
   // Calculate CFL numbers of cells
   void
   calculate_cfl_from_time_step(VectorType &       cfl,
                                VectorType const & velocity,
                                double const       time_step_size) const;
 
+  /*
+   * Local time stepping for steady problems.
+   */
+
+  // Calculate the time step sizes of all cells according to the local CFL criterion with CFL
+  // number cfl for the given velocity field and scale the mass term of the momentum operator
+  // cell-wise by the ratio of the global time step size time_step_size and the local time step
+  // size
+  void
+  update_local_time_steps(VectorType const & velocity,
+                          double const       time_step_size,
+                          double const       cfl,
+                          double const       exponent_degree);
+
+  // Scales a velocity vector by the cell-wise factors computed by update_local_time_steps(),
+  // i.e., applies the local time step scaling to a mass matrix term. No-op if local time stepping
+  // is not used.
+  void
+  apply_local_time_step_scaling(VectorType & velocity) const;
+
   /*
    * For certain setups and types of boundary conditions, the pressure field is only defined up to
    * an additive constant which originates from the fact that only the derivative of the pressure
@@ -370,6 +405,13 @@ public:
   void
   compute_q_criterion(VectorType & dst, VectorType const & src) const;
 
+  // several derived quantities in one loop over all cells (instead of calling the above functions
+  // one after another), see DerivedQuantityCalculator
+  void
+  compute_derived_quantities(std::vector<VectorType *> const &    dst,
+                             std::vector<DerivedQuantity> const & quantities,
+                             VectorType const &                   src) const;
+
   /*
    * Operators.
    */
@@ -389,6 +431,14 @@ public:
   void
   evaluate_convective_term(VectorType & dst, VectorType const & src, Number const time) const;
 
+  // convective term and, as a by-product, the time step size according to the local CFL
+  // criterion for the velocity src, which is reduced over all processes in a non-blocking way
+  // and can be obtained via get_time_step_cfl_convective_term()
+  void
+  evaluate_convective_term_and_calculate_time_step_cfl(VectorType &       dst,
+                                                       VectorType const & src,
+                                                       Number const       time) const;
+
   // pressure gradient term
   void
   evaluate_pressure_gradient_term(VectorType &       dst,
@@ -425,6 +475,18 @@ public:
   void
   update_turbulence_model(VectorType const & velocity);
 
+  /*
+   *  Wall model: returns true if wall-modeled boundaries exist.
+   */
+  bool
+  use_wall_model() const;
+
+  /*
+   *  Update wall model, i.e., set the velocity from which the wall shear stress is computed.
+   */
+  void
+  update_wall_model(VectorType const & velocity);
+
   /*
    * Projection step.
    */
@@ -439,6 +501,26 @@ public:
                    VectorType const & src,
                    bool const &       update_preconditioner) const;
 
+  /*
+   * Fused projection step. In a single loop over all cells, this function
+   *  - calculates the right-hand side rhs = M * velocity + scaling_factor * rhs, where rhs
+   *    contains the pressure gradient term on input,
+   *  - calculates the penalty parameters of the projection operator for the velocity field
+   *    velocity_penalty and sets the time step size (only if velocity_penalty != nullptr),
+   *  - calculates dst = M^{-1} * rhs, which is the solution of the projection step without
+   *    penalty terms and the initial guess of the linear solver otherwise. If only the divergence
+   *    penalty term is used, the cell-local projection problems are solved directly instead.
+   * Returns true if dst is the solution of the projection step, i.e., if no global linear system
+   * of equations has to be solved. The vectors dst and velocity may be the same vector.
+   */
+  bool
+  apply_projection_step_fused(VectorType &       dst,
+                              VectorType &       rhs,
+                              VectorType const & velocity,
+                              double const       scaling_factor,
+                              VectorType const * velocity_penalty,
+                              double const       time_step_size) const;
+
   /*
    * Postprocessing.
    */
@@ -630,6 +712,7 @@ protected:
   DivergenceCalculator<dim, Number>        divergence_calculator;
   VelocityMagnitudeCalculator<dim, Number> velocity_magnitude_calculator;
   QCriterionCalculator<dim, Number>        q_criterion_calculator;
+  DerivedQuantityCalculator<dim, Number>   derived_quantity_calculator;
 
   MPI_Comm const & mpi_comm;
 
@@ -697,6 +780,14 @@ private:
   mutable VectorType const * velocity_ptr;
   mutable VectorType const * pressure_ptr;
 
+  // non-blocking reduction of the local CFL time step size computed by the convective operator
+  mutable NonBlockingMinimum time_step_cfl_convective_term;
+
+  // local time stepping: ratio of global and local time step sizes for all cell batches and the
+  // same factors as a dof vector of the velocity
+  AlignedVector<VectorizedArray<Number>> local_time_step_factors;
+  VectorType                             local_time_step_factors_dofs;
+
   /*
    * LES turbulence modeling.
    */
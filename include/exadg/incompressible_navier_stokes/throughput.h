@@ -93,15 +93,29 @@ run(ThroughputParameters const & throughput,
 
   application->set_subdivisions_hypercube(n_cells_1d);
 
+  IncNS::OperatorType operator_type;
+  IncNS::string_to_enum(operator_type, throughput.operator_type);
+
+  // complete time steps require the time integrator and the solvers to be set up
+  bool const full_time_step = (operator_type == IncNS::OperatorType::FullTimeStep);
+
   unsigned int const refine_time = 0; // not used
-  driver->setup(application, degree, refine_space, refine_time, is_test, true);
-
-  std::tuple<unsigned int, types::global_dof_index, double> wall_time =
-    driver->apply_operator(degree,
-                           throughput.operator_type,
-                           throughput.n_repetitions_inner,
-                           throughput.n_repetitions_outer,
-                           is_test);
+  driver->setup(application, degree, refine_space, refine_time, is_test, not(full_time_step));
+
+  std::tuple<unsigned int, types::global_dof_index, double> wall_time;
+  if(full_time_step)
+  {
+    wall_time =
+      driver->measure_time_steps(throughput.n_time_steps, throughput.summary_file, is_test);
+  }
+  else
+  {
+    wall_time = driver->apply_operator(degree,
+                                       throughput.operator_type,
+                                       throughput.n_repetitions_inner,
+                                       throughput.n_repetitions_outer,
+                                       is_test);
+  }
 
   throughput.wall_times.push_back(wall_time);
 }
@@ -26,6 +26,7 @@
 #include <exadg/incompressible_navier_stokes/user_interface/input_parameters.h>
 #include <exadg/time_integration/push_back_vectors.h>
 #include <exadg/time_integration/time_step_calculation.h>
+#include <exadg/utilities/print_solver_results.h>
 
 namespace ExaDG
 {
@@ -292,18 +293,18 @@ TimeIntBDF<dim, Number>::initialize_oif()
 
 template<int dim, typename Number>
 void
-TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive & ia)
+TimeIntBDF<dim, Number>::read_restart_vectors(RestartArchiveIn & archive)
 {
   for(unsigned int i = 0; i < this->order; i++)
   {
     VectorType tmp = get_velocity(i);
-    ia >> tmp;
+    read_restart_vector(archive, tmp, operator_base->get_dof_handler_u());
     set_velocity(tmp, i);
   }
   for(unsigned int i = 0; i < this->order; i++)
   {
     VectorType tmp = get_pressure(i);
-    ia >> tmp;
+    read_restart_vector(archive, tmp, operator_base->get_dof_handler_p());
     set_pressure(tmp, i);
   }
 
@@ -314,7 +315,7 @@ TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive &
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        ia >> vec_convective_term[i];
+        read_restart_vector(archive, vec_convective_term[i], operator_base->get_dof_handler_u());
       }
     }
   }
@@ -323,22 +324,22 @@ TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive &
   {
     for(unsigned int i = 0; i < vec_grid_coordinates.size(); i++)
     {
-      ia >> vec_grid_coordinates[i];
+      read_restart_vector(archive, vec_grid_coordinates[i], operator_base->get_dof_handler_u());
     }
   }
 }
 
 template<int dim, typename Number>
 void
-TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive & oa) const
+TimeIntBDF<dim, Number>::write_restart_vectors(RestartArchiveOut & archive) const
 {
   for(unsigned int i = 0; i < this->order; i++)
   {
-    oa << get_velocity(i);
+    write_restart_vector(archive, get_velocity(i), operator_base->get_dof_handler_u());
   }
   for(unsigned int i = 0; i < this->order; i++)
   {
-    oa << get_pressure(i);
+    write_restart_vector(archive, get_pressure(i), operator_base->get_dof_handler_p());
   }
 
   if(this->param.convective_problem() &&
@@ -348,7 +349,7 @@ TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive &
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        oa << vec_convective_term[i];
+        write_restart_vector(archive, vec_convective_term[i], operator_base->get_dof_handler_u());
       }
     }
   }
@@ -357,7 +358,7 @@ TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive &
   {
     for(unsigned int i = 0; i < vec_grid_coordinates.size(); i++)
     {
-      oa << vec_grid_coordinates[i];
+      write_restart_vector(archive, vec_grid_coordinates[i], operator_base->get_dof_handler_u());
     }
   }
 }
@@ -465,12 +466,25 @@ TimeIntBDF<dim, Number>::recalculate_time_step_size() const
               ExcMessage(
                 "Adaptive time step is not implemented for this type of time step calculation."));
 
-  VectorType u_relative = get_velocity();
-  if(param.ale_formulation == true)
-    u_relative -= grid_velocity;
+  double new_time_step_size = std::numeric_limits<double>::max();
 
-  double new_time_step_size =
-    operator_base->calculate_time_step_cfl(u_relative, cfl, param.cfl_exponent_fe_degree_velocity);
+  if(calculate_time_step_size_with_convective_term())
+  {
+    // the velocity at the end of the last time step has been used to evaluate the convective term
+    new_time_step_size =
+      operator_base->get_time_step_cfl_convective_term(cfl, param.cfl_exponent_fe_degree_velocity);
+  }
+  else
+  {
+    VectorType u_relative = get_velocity();
+    if(param.ale_formulation == true)
+      u_relative -= grid_velocity;
+
+    new_time_step_size =
+      operator_base->calculate_time_step_cfl(u_relative,
+                                             cfl,
+                                             param.cfl_exponent_fe_degree_velocity);
+  }
 
   // make sure that time step size does not exceed maximum allowable time step size
   new_time_step_size = std::min(new_time_step_size, param.time_step_size_max);
@@ -486,6 +500,66 @@ TimeIntBDF<dim, Number>::recalculate_time_step_size() const
   return new_time_step_size;
 }
 
+template<int dim, typename Number>
+bool
+TimeIntBDF<dim, Number>::calculate_time_step_size_with_convective_term() const
+{
+  return this->adaptive_time_stepping && param.convective_problem() &&
+         param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit &&
+         param.ale_formulation == false;
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::evaluate_convective_term_np(VectorType const & velocity_np)
+{
+  if(calculate_time_step_size_with_convective_term())
+  {
+    operator_base->evaluate_convective_term_and_calculate_time_step_cfl(convective_term_np,
+                                                                       velocity_np,
+                                                                       this->get_next_time());
+  }
+  else
+  {
+    operator_base->evaluate_convective_term(convective_term_np, velocity_np, this->get_next_time());
+  }
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::update_local_time_steps(double const residual,
+                                                 double const initial_residual)
+{
+  double cfl_local = param.max_cfl_local_time_stepping;
+  if(residual > 0.0)
+    cfl_local = std::min(cfl_local, cfl * initial_residual / residual);
+
+  operator_base->update_local_time_steps(get_velocity(),
+                                         this->get_time_step_size(),
+                                         cfl_local,
+                                         param.cfl_exponent_fe_degree_velocity);
+
+  if(print_solver_info())
+  {
+    this->pcout << std::endl
+                << "Local time stepping:" << std::endl
+                << "  CFL number = " << std::scientific << std::setprecision(4) << cfl_local
+                << std::endl;
+  }
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::print_iterations() const
+{
+  std::vector<std::string> names;
+  std::vector<double>      iterations_avg;
+
+  get_iterations(names, iterations_avg);
+
+  print_list_of_iterations(this->pcout, names, iterations_avg);
+}
+
 template<int dim, typename Number>
 bool
 TimeIntBDF<dim, Number>::print_solver_info() const
@@ -592,7 +666,10 @@ TimeIntBDF<dim, Number>::calculate_sum_alphai_ui_oif_substepping(VectorType & su
   this->convective_operator_OIF->set_solutions_and_times(velocities, times);
 
   // call function implemented in base class for the actual OIF sub-stepping
-  TimeIntBDFBase<Number>::calculate_sum_alphai_ui_oif_substepping(sum_alphai_ui, cfl, cfl_oif);
+  if(this->param.oif_single_sweep)
+    this->calculate_sum_alphai_ui_oif_substepping_single_sweep(sum_alphai_ui, cfl, cfl_oif);
+  else
+    TimeIntBDFBase<Number>::calculate_sum_alphai_ui_oif_substepping(sum_alphai_ui, cfl, cfl_oif);
 }
 
 template<int dim, typename Number>
@@ -97,8 +97,15 @@ public:
   void
   advance_one_timestep_partitioned_solve(bool const use_extrapolation, bool const store_solution);
 
+  /*
+   * Returns the names of the (sub-)steps of a time step and the average number of iterations of
+   * the solvers of these steps.
+   */
   virtual void
-  print_iterations() const = 0;
+  get_iterations(std::vector<std::string> & names, std::vector<double> & iterations) const = 0;
+
+  void
+  print_iterations() const;
 
   bool
   print_solver_info() const;
@@ -111,10 +118,10 @@ protected:
   setup_derived() override;
 
   virtual void
-  read_restart_vectors(boost::archive::binary_iarchive & ia) override;
+  read_restart_vectors(RestartArchiveIn & archive) override;
 
   virtual void
-  write_restart_vectors(boost::archive::binary_oarchive & oa) const override;
+  write_restart_vectors(RestartArchiveOut & archive) const override;
 
   virtual void
   prepare_vectors_for_next_timestep() override;
@@ -128,6 +135,22 @@ protected:
                                           double const cfl,
                                           double const cfl_oif);
 
+  /*
+   * Evaluates the convective term for the velocity at time t_{n+1} (Eulerian case). In case of
+   * adaptive time stepping, the time step size of the next time step is calculated as a
+   * by-product of this evaluation.
+   */
+  void
+  evaluate_convective_term_np(VectorType const & velocity_np);
+
+  /*
+   * Local time stepping for steady problems: calculates the local time step sizes for the current
+   * velocity with the CFL number obtained from the switched evolution relaxation (SER) strategy
+   * for the given residual of the steady problem.
+   */
+  void
+  update_local_time_steps(double const residual, double const initial_residual);
+
   void
   move_mesh(double const time) const;
 
@@ -184,6 +207,13 @@ private:
   double
   recalculate_time_step_size() const;
 
+  /*
+   * Returns true if the time step size of adaptive time stepping is calculated by the evaluation
+   * of the explicit convective term, which avoids an additional pass over the velocity field.
+   */
+  bool
+  calculate_time_step_size_with_convective_term() const;
+
   virtual void
   solve_steady_problem() = 0;
 
@@ -201,6 +201,10 @@ TimeIntBDFCoupled<dim, Number>::solve_timestep()
     }
   }
 
+  // update of wall model
+  if(pde_operator->use_wall_model())
+    pde_operator->update_wall_model(solution_np.block(0));
+
   // Update divergence and continuity penalty operator in case
   // that these terms are added to the monolithic system of equations.
   if(this->param.apply_penalty_terms_in_postprocessing_step == false)
@@ -286,7 +290,9 @@ TimeIntBDFCoupled<dim, Number>::solve_timestep()
       }
     }
 
-    // apply mass operator to sum_alphai_ui and add to rhs vector
+    // apply mass operator to sum_alphai_ui (scaled cell-wise in case of local time stepping) and
+    // add to rhs vector
+    pde_operator->apply_local_time_step_scaling(sum_alphai_ui);
     pde_operator->apply_mass_operator_add(rhs_vector.block(0), sum_alphai_ui);
 
     unsigned int const n_iter =
@@ -317,6 +323,8 @@ TimeIntBDFCoupled<dim, Number>::solve_timestep()
       sum_alphai_ui.add(this->bdf.get_alpha(i) / this->get_time_step_size(), solution[i].block(0));
     }
 
+    pde_operator->apply_local_time_step_scaling(sum_alphai_ui);
+
     VectorType rhs(sum_alphai_ui);
     pde_operator->apply_mass_operator(rhs, sum_alphai_ui);
     if(this->param.right_hand_side)
@@ -382,9 +390,7 @@ TimeIntBDFCoupled<dim, Number>::solve_timestep()
   {
     if(this->param.ale_formulation == false) // Eulerian case
     {
-      pde_operator->evaluate_convective_term(this->convective_term_np,
-                                             solution_np.block(0),
-                                             this->get_next_time());
+      this->evaluate_convective_term_np(solution_np.block(0));
     }
   }
 
@@ -552,6 +558,9 @@ TimeIntBDFCoupled<dim, Number>::solve_steady_problem()
       double const norm_p = pressure_tmp.l2_norm();
       double const norm   = std::sqrt(norm_u * norm_u + norm_p * norm_p);
 
+      if(this->param.use_local_time_stepping)
+        this->update_local_time_steps(evaluate_residual(), initial_residual);
+
       // solve time step
       this->do_timestep();
 
@@ -591,14 +600,19 @@ TimeIntBDFCoupled<dim, Number>::solve_steady_problem()
   else if(this->param.convergence_criterion_steady_problem ==
           ConvergenceCriterionSteadyProblem::ResidualSteadyNavierStokes)
   {
+    double residual = initial_residual;
+
     while(!converged && this->time < (this->end_time - this->eps) &&
           this->get_time_step_number() <= this->param.max_number_of_time_steps)
     {
+      if(this->param.use_local_time_stepping)
+        this->update_local_time_steps(residual, initial_residual);
+
       this->do_timestep();
 
       // check convergence by evaluating the residual of
       // the steady-state incompressible Navier-Stokes equations
-      double const residual = evaluate_residual();
+      residual = evaluate_residual();
 
       if(residual < this->param.abs_tol_steady ||
          residual / initial_residual < this->param.rel_tol_steady)
@@ -647,11 +661,9 @@ TimeIntBDFCoupled<dim, Number>::evaluate_residual()
 
 template<int dim, typename Number>
 void
-TimeIntBDFCoupled<dim, Number>::print_iterations() const
+TimeIntBDFCoupled<dim, Number>::get_iterations(std::vector<std::string> & names,
+                                               std::vector<double> &      iterations_avg) const
 {
-  std::vector<std::string> names;
-  std::vector<double>      iterations_avg;
-
   if(this->param.linear_problem_has_to_be_solved())
   {
     names = {"Coupled system"};
@@ -682,8 +694,6 @@ TimeIntBDFCoupled<dim, Number>::print_iterations() const
     iterations_avg.push_back(iterations_penalty.second /
                              std::max(1., (double)iterations_penalty.first));
   }
-
-  print_list_of_iterations(this->pcout, names, iterations_avg);
 }
 
 // instantiations
@@ -64,7 +64,7 @@ public:
   postprocessing_stability_analysis();
 
   void
-  print_iterations() const;
+  get_iterations(std::vector<std::string> & names, std::vector<double> & iterations) const;
 
   VectorType const &
   get_velocity_np() const;
@@ -101,31 +101,30 @@ TimeIntBDFDualSplitting<dim, Number>::setup_derived()
 
 template<int dim, typename Number>
 void
-TimeIntBDFDualSplitting<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive & ia)
+TimeIntBDFDualSplitting<dim, Number>::read_restart_vectors(RestartArchiveIn & archive)
 {
-  Base::read_restart_vectors(ia);
+  Base::read_restart_vectors(archive);
 
   if(this->param.store_previous_boundary_values)
   {
     for(unsigned int i = 0; i < velocity_dbc.size(); i++)
     {
-      ia >> velocity_dbc[i];
+      read_restart_vector(archive, velocity_dbc[i], pde_operator->get_dof_handler_u());
     }
   }
 }
 
 template<int dim, typename Number>
 void
-TimeIntBDFDualSplitting<dim, Number>::write_restart_vectors(
-  boost::archive::binary_oarchive & oa) const
+TimeIntBDFDualSplitting<dim, Number>::write_restart_vectors(RestartArchiveOut & archive) const
 {
-  Base::write_restart_vectors(oa);
+  Base::write_restart_vectors(archive);
 
   if(this->param.store_previous_boundary_values)
   {
     for(unsigned int i = 0; i < velocity_dbc.size(); i++)
     {
-      oa << velocity_dbc[i];
+      write_restart_vector(archive, velocity_dbc[i], pde_operator->get_dof_handler_u());
     }
   }
 }
@@ -433,9 +432,7 @@ TimeIntBDFDualSplitting<dim, Number>::evaluate_convective_term()
   {
     if(this->param.ale_formulation == false) // Eulerian case
     {
-      pde_operator->evaluate_convective_term(this->convective_term_np,
-                                             velocity_np,
-                                             this->get_next_time());
+      this->evaluate_convective_term_np(velocity_np);
     }
   }
 
@@ -500,47 +497,39 @@ template<int dim, typename Number>
 void
 TimeIntBDFDualSplitting<dim, Number>::rhs_pressure(VectorType & rhs) const
 {
+  /*
+   *  All terms of the right-hand side are evaluated in a single loop over cells, interior faces,
+   *  and boundary faces.
+   */
+  RhsPPEData<VectorType> data;
+  data.time = this->get_next_time();
+
   /*
    *  I. calculate divergence term
    */
   // homogeneous part of velocity divergence operator
-  pde_operator->apply_velocity_divergence_term(rhs, velocity_np);
+  data.velocity_np     = &velocity_np;
+  data.factor_div_term = -this->bdf.get_gamma0() / this->get_time_step_size();
 
-  rhs *= -this->bdf.get_gamma0() / this->get_time_step_size();
+  bool const div_term_boundary_data =
+    this->param.divu_integrated_by_parts == true && this->param.divu_use_boundary_data == true;
 
   // inhomogeneous parts of boundary face integrals of velocity divergence operator
-  if(this->param.divu_integrated_by_parts == true && this->param.divu_use_boundary_data == true)
+  if(div_term_boundary_data)
   {
-    VectorType temp(rhs);
-
     // sum alpha_i * u_i term
     for(unsigned int i = 0; i < velocity.size(); ++i)
     {
       if(this->param.store_previous_boundary_values)
-        pde_operator->rhs_velocity_divergence_term_dirichlet_bc_from_dof_vector(temp,
-                                                                                velocity_dbc[i]);
+        data.velocities_div_term_dirichlet.push_back(&velocity_dbc[i]);
       else
-        pde_operator->rhs_velocity_divergence_term(temp, this->get_previous_time(i));
+        data.times_div_term_dirichlet.push_back(this->get_previous_time(i));
 
-      // note that the minus sign related to this term is already taken into account
-      // in the function rhs() of the divergence operator
-      rhs.add(this->bdf.get_alpha(i) / this->get_time_step_size(), temp);
-    }
-
-    // convective term
-    if(this->param.convective_problem())
-    {
-      for(unsigned int i = 0; i < velocity.size(); ++i)
-      {
-        temp = 0.0;
-        pde_operator->rhs_ppe_div_term_convective_term_add(temp, velocity[i]);
-        rhs.add(this->extra.get_beta(i), temp);
-      }
+      // note that the minus sign related to this term is taken into account when evaluating
+      // the boundary face integrals
+      data.factors_div_term_dirichlet.push_back(this->bdf.get_alpha(i) /
+                                                this->get_time_step_size());
     }
-
-    // body force term
-    if(this->param.right_hand_side)
-      pde_operator->rhs_ppe_div_term_body_forces_add(rhs, this->get_next_time());
   }
 
   /*
@@ -549,30 +538,60 @@ TimeIntBDFDualSplitting<dim, Number>::rhs_pressure(VectorType & rhs) const
    */
 
   // II.1. pressure Dirichlet boundary conditions
-  pde_operator->rhs_ppe_laplace_add(rhs, this->get_next_time());
+  data.laplace_dirichlet = true;
+
+  /*
+   *  III. all other boundary face integrals of the velocity divergence term (I.) and the pressure
+   *  Neumann boundary condition (II.)
+   */
 
-  // II.2. pressure Neumann boundary condition: body force vector
-  if(this->param.right_hand_side)
+  // I. convective term and body force term of velocity divergence term
+  // II.5. convective term of pressure Neumann boundary condition on Gamma_D:
+  //       evaluate convective term and subsequently extrapolate rhs vectors
+  //       (the convective term is nonlinear!)
+  if(this->param.convective_problem())
   {
-    pde_operator->rhs_ppe_nbc_body_force_term_add(rhs, this->get_next_time());
+    for(unsigned int i = 0; i < velocity.size(); ++i)
+    {
+      double factor_div_term = 0.0;
+      if(div_term_boundary_data)
+        factor_div_term = this->extra.get_beta(i);
+
+      double factor_nbc = 0.0;
+      if(this->param.order_extrapolation_pressure_nbc > 0 && i < extra_pressure_nbc.get_order())
+        factor_nbc = this->extra_pressure_nbc.get_beta(i);
+
+      if(factor_div_term != 0.0 || factor_nbc != 0.0)
+      {
+        data.velocities.push_back(&velocity[i]);
+        data.factors_div_term_convective.push_back(factor_div_term);
+        data.factors_nbc_convective.push_back(factor_nbc);
+      }
+    }
   }
 
+  // I. body force term and II.2. pressure Neumann boundary condition: body force vector
+  data.div_term_body_forces = div_term_boundary_data && this->param.right_hand_side;
+  data.nbc_body_forces      = this->param.right_hand_side;
+
   // II.3. pressure Neumann boundary condition: temporal derivative of velocity
+  VectorType acceleration;
   if(this->param.store_previous_boundary_values)
   {
-    VectorType acceleration(velocity_dbc_np);
+    acceleration.reinit(velocity_dbc_np);
     compute_bdf_time_derivative(
       acceleration, velocity_dbc_np, velocity_dbc, this->bdf, this->get_time_step_size());
-    pde_operator->rhs_ppe_nbc_numerical_time_derivative_add(rhs, acceleration);
+    data.acceleration = &acceleration;
   }
   else
   {
-    pde_operator->rhs_ppe_nbc_analytical_time_derivative_add(rhs, this->get_next_time());
+    data.nbc_analytical_time_derivative = true;
   }
 
   // II.4. viscous term of pressure Neumann boundary condition on Gamma_D:
   //       extrapolate velocity, evaluate vorticity, and subsequently evaluate boundary
   //       face integral (this is possible since pressure Neumann BC is linear in vorticity)
+  VectorType vorticity;
   if(this->param.viscous_problem())
   {
     if(this->param.order_extrapolation_pressure_nbc > 0)
@@ -584,29 +603,14 @@ TimeIntBDFDualSplitting<dim, Number>::rhs_pressure(VectorType & rhs) const
         velocity_extra.add(this->extra_pressure_nbc.get_beta(i), velocity[i]);
       }
 
-      VectorType vorticity(velocity_extra);
+      vorticity.reinit(velocity_extra);
       pde_operator->compute_vorticity(vorticity, velocity_extra);
 
-      pde_operator->rhs_ppe_viscous_add(rhs, vorticity);
+      data.vorticity = &vorticity;
     }
   }
 
-  // II.5. convective term of pressure Neumann boundary condition on Gamma_D:
-  //       evaluate convective term and subsequently extrapolate rhs vectors
-  //       (the convective term is nonlinear!)
-  if(this->param.convective_problem())
-  {
-    if(this->param.order_extrapolation_pressure_nbc > 0)
-    {
-      VectorType temp(rhs);
-      for(unsigned int i = 0; i < extra_pressure_nbc.get_order(); ++i)
-      {
-        temp = 0.0;
-        pde_operator->rhs_ppe_convective_add(temp, velocity[i]);
-        rhs.add(this->extra_pressure_nbc.get_beta(i), temp);
-      }
-    }
-  }
+  pde_operator->rhs_ppe(rhs, data);
 
   // special case: pressure level is undefined
   // Set mean value of rhs to zero in order to obtain a consistent linear system of equations.
@@ -624,21 +628,19 @@ TimeIntBDFDualSplitting<dim, Number>::projection_step()
   Timer timer;
   timer.restart();
 
-  // compute right-hand-side vector
+  // compute pressure gradient term of right-hand-side vector
   VectorType rhs(velocity_np);
   rhs_projection(rhs);
 
-  // apply inverse mass operator: this is the solution if no penalty terms are applied
-  // and serves as a good initial guess for the case with penalty terms
-  pde_operator->apply_inverse_mass_operator(velocity_np, rhs);
+  bool const penalty_terms =
+    this->param.apply_penalty_terms_in_postprocessing_step == false &&
+    (this->param.use_divergence_penalty == true || this->param.use_continuity_penalty == true);
 
-  // penalty terms
-  if(this->param.apply_penalty_terms_in_postprocessing_step == false &&
-     (this->param.use_divergence_penalty == true || this->param.use_continuity_penalty == true))
+  // extrapolate velocity to time t_n+1 and use this velocity field to
+  // calculate the penalty parameter for the divergence and continuity penalty term
+  VectorType velocity_extrapolated;
+  if(penalty_terms)
   {
-    // extrapolate velocity to time t_n+1 and use this velocity field to
-    // calculate the penalty parameter for the divergence and continuity penalty term
-    VectorType velocity_extrapolated;
     if(this->use_extrapolation)
     {
       velocity_extrapolated.reinit(velocity[0]);
@@ -649,20 +651,41 @@ TimeIntBDFDualSplitting<dim, Number>::projection_step()
     {
       velocity_extrapolated = velocity_projection_last_iter;
     }
+  }
 
-    pde_operator->update_projection_operator(velocity_extrapolated, this->get_time_step_size());
+  // Add mass operator term to rhs vector, calculate penalty parameters and apply inverse mass
+  // operator in one loop: this is the solution if no penalty terms are applied (or if the
+  // elementwise problems with divergence penalty term are solved directly) and serves as a good
+  // initial guess for the case with penalty terms otherwise.
+  bool const solved =
+    pde_operator->apply_projection_step_fused(velocity_np,
+                                              rhs,
+                                              velocity_np,
+                                              -this->get_time_step_size() /
+                                                this->bdf.get_gamma0(),
+                                              penalty_terms ? &velocity_extrapolated : nullptr,
+                                              this->get_time_step_size());
 
-    // solve linear system of equations
-    bool const update_preconditioner =
-      this->param.update_preconditioner_projection &&
-      ((this->time_step_number - 1) %
-         this->param.update_preconditioner_projection_every_time_steps ==
-       0);
+  // penalty terms
+  if(penalty_terms)
+  {
+    unsigned int n_iter = 0;
 
-    if(this->use_extrapolation == false)
-      velocity_np = velocity_projection_last_iter;
+    if(not solved)
+    {
+      // solve linear system of equations
+      bool const update_preconditioner =
+        this->param.update_preconditioner_projection &&
+        ((this->time_step_number - 1) %
+           this->param.update_preconditioner_projection_every_time_steps ==
+         0);
+
+      if(this->use_extrapolation == false)
+        velocity_np = velocity_projection_last_iter;
+
+      n_iter = pde_operator->solve_projection(velocity_np, rhs, update_preconditioner);
+    }
 
-    unsigned int n_iter = pde_operator->solve_projection(velocity_np, rhs, update_preconditioner);
     iterations_projection.first += 1;
     iterations_projection.second += n_iter;
 
@@ -694,15 +717,11 @@ TimeIntBDFDualSplitting<dim, Number>::rhs_projection(VectorType & rhs) const
 {
   /*
    *  I. calculate pressure gradient term
+   *
+   *  The scaling by the factor -dt/gamma0 and the mass operator term are applied in
+   *  apply_projection_step_fused().
    */
   pde_operator->evaluate_pressure_gradient_term(rhs, pressure_np, this->get_next_time());
-
-  rhs *= -this->get_time_step_size() / this->bdf.get_gamma0();
-
-  /*
-   *  II. add mass operator term
-   */
-  pde_operator->apply_mass_operator_add(rhs, velocity_np);
 }
 
 template<int dim, typename Number>
@@ -714,25 +733,30 @@ TimeIntBDFDualSplitting<dim, Number>::viscous_step()
 
   if(this->param.viscous_problem())
   {
-    // if a turbulence model is used:
-    // update turbulence model before calculating rhs_viscous
-    if(this->param.use_turbulence_model == true)
+    // if a turbulence model or a wall model is used:
+    // update turbulence model and wall model before calculating rhs_viscous
+    if(this->param.use_turbulence_model == true || pde_operator->use_wall_model())
     {
       Timer timer_turbulence;
       timer_turbulence.restart();
 
       // extrapolate velocity to time t_n+1 and use this velocity field to
       // update the turbulence model (to recalculate the turbulent viscosity)
+      // and the wall model (to recalculate the wall shear stress)
       VectorType velocity_extrapolated(velocity[0]);
       velocity_extrapolated = 0;
       for(unsigned int i = 0; i < velocity.size(); ++i)
         velocity_extrapolated.add(this->extra.get_beta(i), velocity[i]);
 
-      pde_operator->update_turbulence_model(velocity_extrapolated);
+      if(this->param.use_turbulence_model == true)
+        pde_operator->update_turbulence_model(velocity_extrapolated);
+
+      if(pde_operator->use_wall_model())
+        pde_operator->update_wall_model(velocity_extrapolated);
 
       if(this->print_solver_info())
       {
-        this->pcout << std::endl << "Update of turbulent viscosity:";
+        this->pcout << std::endl << "Update of turbulence/wall model:";
         if(this->print_wall_times)
           print_wall_time(this->pcout, timer_turbulence.wall_time());
       }
@@ -969,14 +993,11 @@ TimeIntBDFDualSplitting<dim, Number>::solve_steady_problem()
 
 template<int dim, typename Number>
 void
-TimeIntBDFDualSplitting<dim, Number>::print_iterations() const
+TimeIntBDFDualSplitting<dim, Number>::get_iterations(std::vector<std::string> & names,
+                                                     std::vector<double> &      iterations_avg) const
 {
-  std::vector<std::string> names = {"Convective step",
-                                    "Pressure step",
-                                    "Projection step",
-                                    "Viscous step"};
+  names = {"Convective step", "Pressure step", "Projection step", "Viscous step"};
 
-  std::vector<double> iterations_avg;
   iterations_avg.resize(4);
   iterations_avg[0] = 0.0;
   iterations_avg[1] =
@@ -992,8 +1013,6 @@ TimeIntBDFDualSplitting<dim, Number>::print_iterations() const
     iterations_avg.push_back((double)iterations_penalty.second /
                              std::max(1., (double)iterations_penalty.first));
   }
-
-  print_list_of_iterations(this->pcout, names, iterations_avg);
 }
 
 // instantiations
@@ -112,32 +112,30 @@ TimeIntBDFPressureCorrection<dim, Number>::setup_derived()
 
 template<int dim, typename Number>
 void
-TimeIntBDFPressureCorrection<dim, Number>::read_restart_vectors(
-  boost::archive::binary_iarchive & ia)
+TimeIntBDFPressureCorrection<dim, Number>::read_restart_vectors(RestartArchiveIn & archive)
 {
-  Base::read_restart_vectors(ia);
+  Base::read_restart_vectors(archive);
 
   if(this->param.store_previous_boundary_values)
   {
     for(unsigned int i = 0; i < pressure_dbc.size(); i++)
     {
-      ia >> pressure_dbc[i];
+      read_restart_vector(archive, pressure_dbc[i], pde_operator->get_dof_handler_p());
     }
   }
 }
 
 template<int dim, typename Number>
 void
-TimeIntBDFPressureCorrection<dim, Number>::write_restart_vectors(
-  boost::archive::binary_oarchive & oa) const
+TimeIntBDFPressureCorrection<dim, Number>::write_restart_vectors(RestartArchiveOut & archive) const
 {
-  Base::write_restart_vectors(oa);
+  Base::write_restart_vectors(archive);
 
   if(this->param.store_previous_boundary_values)
   {
     for(unsigned int i = 0; i < pressure_dbc.size(); i++)
     {
-      oa << pressure_dbc[i];
+      write_restart_vector(archive, pressure_dbc[i], pde_operator->get_dof_handler_p());
     }
   }
 }
@@ -386,6 +384,10 @@ TimeIntBDFPressureCorrection<dim, Number>::momentum_step()
     }
   }
 
+  // update wall model before calculating rhs_momentum
+  if(pde_operator->use_wall_model())
+    pde_operator->update_wall_model(velocity_np);
+
 
   /*
    *  Calculate the right-hand side of the linear system of equations
@@ -554,6 +556,9 @@ TimeIntBDFPressureCorrection<dim, Number>::rhs_momentum(VectorType & rhs)
     }
   }
 
+  // scale cell-wise in case of local time stepping
+  pde_operator->apply_local_time_step_scaling(sum_alphai_ui);
+
   pde_operator->apply_mass_operator_add(rhs, sum_alphai_ui);
 
   /*
@@ -763,24 +768,21 @@ TimeIntBDFPressureCorrection<dim, Number>::rhs_projection(
   VectorType const & pressure_increment) const
 {
   /*
-   *  I. apply mass operator
+   *  I. calculate pressure gradient term including boundary condition g_p(t_{n+1})
+   *
+   *  The scaling by the factor -dt/gamma0 and the mass operator term are applied in
+   *  apply_projection_step_fused().
    */
-  pde_operator->apply_mass_operator(rhs, velocity_np);
+  pde_operator->evaluate_pressure_gradient_term(rhs, pressure_increment, this->get_next_time());
 
   /*
-   *  II. calculate pressure gradient term including boundary condition g_p(t_{n+1})
-   */
-  VectorType temp(rhs);
-  pde_operator->evaluate_pressure_gradient_term(temp, pressure_increment, this->get_next_time());
-
-  rhs.add(-this->get_time_step_size() / this->bdf.get_gamma0(), temp);
-
-  /*
-   *  III. pressure gradient term: boundary conditions g_p(t_{n-i})
-   *       in case of incremental formulation of pressure-correction scheme
+   *  II. pressure gradient term: boundary conditions g_p(t_{n-i})
+   *      in case of incremental formulation of pressure-correction scheme
    */
   if(this->param.gradp_integrated_by_parts == true && this->param.gradp_use_boundary_data == true)
   {
+    VectorType temp(rhs);
+
     for(unsigned int i = 0; i < extra_pressure_gradient.get_order(); ++i)
     {
       // evaluate inhomogeneous parts of boundary face integrals
@@ -795,9 +797,7 @@ TimeIntBDFPressureCorrection<dim, Number>::rhs_projection(
         pde_operator->rhs_pressure_gradient_term(temp, this->get_previous_time(i));
       }
 
-      rhs.add(-extra_pressure_gradient.get_beta(i) * this->get_time_step_size() /
-                this->bdf.get_gamma0(),
-              temp);
+      rhs.add(extra_pressure_gradient.get_beta(i), temp);
     }
   }
 }
@@ -809,19 +809,18 @@ TimeIntBDFPressureCorrection<dim, Number>::projection_step(VectorType const & pr
   Timer timer;
   timer.restart();
 
-  // compute right-hand-side vector
+  // compute pressure gradient term of right-hand-side vector
   VectorType rhs(velocity_np);
   rhs_projection(rhs, pressure_increment);
 
-  // apply inverse mass operator: this is the solution if no penalty terms are applied
-  // and serves as a good initial guess for the case with penalty terms
-  pde_operator->apply_inverse_mass_operator(velocity_np, rhs);
+  bool const penalty_terms =
+    this->param.use_divergence_penalty == true || this->param.use_continuity_penalty == true;
 
-  if(this->param.use_divergence_penalty == true || this->param.use_continuity_penalty == true)
+  // extrapolate velocity to time t_{n+1} and use this velocity field to
+  // calculate the penalty parameter for the divergence and continuity penalty terms
+  VectorType velocity_extrapolated;
+  if(penalty_terms)
   {
-    // extrapolate velocity to time t_{n+1} and use this velocity field to
-    // calculate the penalty parameter for the divergence and continuity penalty terms
-    VectorType velocity_extrapolated;
     if(this->use_extrapolation)
     {
       velocity_extrapolated.reinit(velocity[0]);
@@ -832,27 +831,45 @@ TimeIntBDFPressureCorrection<dim, Number>::projection_step(VectorType const & pr
     {
       velocity_extrapolated = velocity_projection_last_iter;
     }
+  }
 
-    pde_operator->update_projection_operator(velocity_extrapolated, this->get_time_step_size());
+  // Add mass operator term to rhs vector, calculate penalty parameters and apply inverse mass
+  // operator in one loop: this is the solution if no penalty terms are applied (or if the
+  // elementwise problems with divergence penalty term are solved directly) and serves as a good
+  // initial guess for the case with penalty terms otherwise.
+  bool const solved =
+    pde_operator->apply_projection_step_fused(velocity_np,
+                                              rhs,
+                                              velocity_np,
+                                              -this->get_time_step_size() /
+                                                this->bdf.get_gamma0(),
+                                              penalty_terms ? &velocity_extrapolated : nullptr,
+                                              this->get_time_step_size());
+
+  if(penalty_terms)
+  {
+    unsigned int n_iter = 0;
 
-    // add inhomogeneous contributions of continuity penalty term after computing
-    // the initial guess for the linear system of equations to make sure that the initial
-    // guess is as accurate as possible
-    if(this->param.use_continuity_penalty && this->param.continuity_penalty_use_boundary_data)
-      pde_operator->rhs_add_projection_operator(rhs, this->get_next_time());
+    if(not solved)
+    {
+      // add inhomogeneous contributions of continuity penalty term after computing
+      // the initial guess for the linear system of equations to make sure that the initial
+      // guess is as accurate as possible
+      if(this->param.use_continuity_penalty && this->param.continuity_penalty_use_boundary_data)
+        pde_operator->rhs_add_projection_operator(rhs, this->get_next_time());
 
-    // solve linear system of equations
-    bool const update_preconditioner =
-      this->param.update_preconditioner_projection &&
-      ((this->time_step_number - 1) %
-         this->param.update_preconditioner_projection_every_time_steps ==
-       0);
+      // solve linear system of equations
+      bool const update_preconditioner =
+        this->param.update_preconditioner_projection &&
+        ((this->time_step_number - 1) %
+           this->param.update_preconditioner_projection_every_time_steps ==
+         0);
 
-    if(this->use_extrapolation == false)
-      velocity_np = velocity_projection_last_iter;
+      if(this->use_extrapolation == false)
+        velocity_np = velocity_projection_last_iter;
 
-    unsigned int const n_iter =
-      pde_operator->solve_projection(velocity_np, rhs, update_preconditioner);
+      n_iter = pde_operator->solve_projection(velocity_np, rhs, update_preconditioner);
+    }
 
     iterations_projection.first += 1;
     iterations_projection.second += n_iter;
@@ -892,9 +909,7 @@ TimeIntBDFPressureCorrection<dim, Number>::evaluate_convective_term()
   {
     if(this->param.ale_formulation == false) // Eulerian case
     {
-      pde_operator->evaluate_convective_term(this->convective_term_np,
-                                             velocity_np,
-                                             this->get_next_time());
+      this->evaluate_convective_term_np(velocity_np);
     }
   }
 
@@ -940,6 +955,11 @@ TimeIntBDFPressureCorrection<dim, Number>::solve_steady_problem()
     VectorType velocity_tmp;
     VectorType pressure_tmp;
 
+    // the residual is only needed for the SER strategy of local time stepping
+    double initial_residual = 1.0;
+    if(this->param.use_local_time_stepping)
+      initial_residual = evaluate_residual();
+
     while(!converged && this->time < (this->end_time - this->eps) &&
           this->get_time_step_number() <= this->param.max_number_of_time_steps)
     {
@@ -952,6 +972,9 @@ TimeIntBDFPressureCorrection<dim, Number>::solve_steady_problem()
       double const norm_p = pressure_tmp.l2_norm();
       double const norm   = std::sqrt(norm_u * norm_u + norm_p * norm_p);
 
+      if(this->param.use_local_time_stepping)
+        this->update_local_time_steps(evaluate_residual(), initial_residual);
+
       // solve time step
       this->do_timestep();
 
@@ -992,15 +1015,19 @@ TimeIntBDFPressureCorrection<dim, Number>::solve_steady_problem()
           ConvergenceCriterionSteadyProblem::ResidualSteadyNavierStokes)
   {
     double const initial_residual = evaluate_residual();
+    double       residual         = initial_residual;
 
     while(!converged && this->time < (this->end_time - this->eps) &&
           this->get_time_step_number() <= this->param.max_number_of_time_steps)
     {
+      if(this->param.use_local_time_stepping)
+        this->update_local_time_steps(residual, initial_residual);
+
       this->do_timestep();
 
       // check convergence by evaluating the residual of
       // the steady-state incompressible Navier-Stokes equations
-      double const residual = evaluate_residual();
+      residual = evaluate_residual();
 
       if(residual < this->param.abs_tol_steady ||
          residual / initial_residual < this->param.rel_tol_steady)
@@ -1052,11 +1079,9 @@ TimeIntBDFPressureCorrection<dim, Number>::evaluate_residual()
 
 template<int dim, typename Number>
 void
-TimeIntBDFPressureCorrection<dim, Number>::print_iterations() const
+TimeIntBDFPressureCorrection<dim, Number>::get_iterations(std::vector<std::string> & names,
+                                                          std::vector<double> &      iterations_avg) const
 {
-  std::vector<std::string> names;
-  std::vector<double>      iterations_avg;
-
   if(this->param.linear_problem_has_to_be_solved())
   {
     names = {"Momentum step", "Pressure step", "Projection step"};
@@ -1091,8 +1116,6 @@ TimeIntBDFPressureCorrection<dim, Number>::print_iterations() const
     iterations_avg[4] =
       (double)iterations_projection.second / std::max(1., (double)iterations_projection.first);
   }
-
-  print_list_of_iterations(this->pcout, names, iterations_avg);
 }
 
 // instantiations
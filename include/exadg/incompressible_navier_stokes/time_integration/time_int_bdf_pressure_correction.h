@@ -63,7 +63,7 @@ public:
   postprocessing_stability_analysis();
 
   void
-  print_iterations() const;
+  get_iterations(std::vector<std::string> & names, std::vector<double> & iterations) const;
 
   VectorType const &
   get_velocity_np() const;
@@ -88,10 +88,10 @@ private:
   setup_derived() override;
 
   virtual void
-  read_restart_vectors(boost::archive::binary_iarchive & ia) override;
+  read_restart_vectors(RestartArchiveIn & archive) override;
 
   virtual void
-  write_restart_vectors(boost::archive::binary_oarchive & oa) const override;
+  write_restart_vectors(RestartArchiveOut & archive) const override;
 
   void
   initialize_pressure_on_boundary();
@@ -31,6 +31,7 @@
 
 // ExaDG
 #include <exadg/convection_diffusion/user_interface/boundary_descriptor.h>
+#include <exadg/incompressible_navier_stokes/postprocessor/inflow_data_calculator.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/postprocessor.h>
 #include <exadg/incompressible_navier_stokes/user_interface/boundary_descriptor.h>
 #include <exadg/incompressible_navier_stokes/user_interface/field_functions.h>
@@ -166,6 +167,22 @@ public:
   {
   }
 
+  void
+  add_parameters(ParameterHandler & prm) override
+  {
+    ApplicationBase<dim, Number>::add_parameters(prm);
+
+    // clang-format off
+    prm.enter_subsection("Precursor");
+      prm.add_parameter("WriteInflowDatabase", write_inflow_database, "Records the inflow data of the precursor domain to an inflow database.");
+      prm.add_parameter("ReadInflowDatabase",  read_inflow_database,  "Replays the inflow data from an inflow database instead of solving the precursor domain.");
+      prm.add_parameter("InflowDatabase",      inflow_database,       "Filename of the inflow database.");
+      prm.add_parameter("ConcurrentExecution", concurrent_execution,  "Solves the precursor domain and the actual domain concurrently on different processes.");
+      prm.add_parameter("FractionOfProcessesPrecursor", fraction_of_processes_precursor, "Fraction of processes solving the precursor domain in case of concurrent execution (determined from the number of cells of both domains if zero).", Patterns::Double(0.0, 1.0));
+    prm.leave_subsection();
+    // clang-format on
+  }
+
   virtual ~ApplicationBasePrecursor()
   {
   }
@@ -190,6 +207,51 @@ public:
 
   virtual std::shared_ptr<PostProcessorBase<dim, Number>>
   construct_postprocessor_precursor(unsigned int const degree, MPI_Comm const & mpi_comm) = 0;
+
+  /*
+   * If the inflow data is replayed from an inflow database, only the actual domain is solved.
+   */
+  bool
+  precursor_is_active() const
+  {
+    return not(read_inflow_database);
+  }
+
+  bool
+  use_concurrent_execution() const
+  {
+    return concurrent_execution;
+  }
+
+  double
+  get_fraction_of_processes_precursor() const
+  {
+    return fraction_of_processes_precursor;
+  }
+
+  /*
+   * Inflow data written by the postprocessor of the precursor domain and used as boundary
+   * condition of the actual domain. Only needed if both domains are solved concurrently on
+   * different processes, in which case the inflow data has to be transferred between processes.
+   */
+  virtual InflowData<dim>
+  get_inflow_data() const
+  {
+    AssertThrow(false,
+                ExcMessage("Has to be overwritten by derived classes in order "
+                           "to solve the precursor domain and the actual domain concurrently."));
+
+    return InflowData<dim>();
+  }
+
+protected:
+  bool write_inflow_database = false, read_inflow_database = false;
+
+  std::string inflow_database = "inflow_database";
+
+  bool concurrent_execution = false;
+
+  double fraction_of_processes_precursor = 0.0;
 };
 
 
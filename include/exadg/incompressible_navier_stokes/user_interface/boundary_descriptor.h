@@ -67,7 +67,8 @@ enum class BoundaryTypeU
   Dirichlet,
   DirichletMortar,
   Neumann,
-  Symmetry
+  Symmetry,
+  WallModel
 };
 
 enum class BoundaryTypeP
@@ -99,6 +100,14 @@ struct BoundaryDescriptorU
   // it is not relevant because this function will not be evaluated by the code.
   std::map<types::boundary_id, std::shared_ptr<Function<dim>>> symmetry_bc;
 
+  // Wall model: As for symmetry boundaries, the velocity normal to the boundary is set to zero
+  // (u*n=0). The tangential viscous traction is the wall shear stress of an algebraic equilibrium
+  // wall model (law of the wall by Spalding), which is computed from the interior velocity in the
+  // boundary quadrature points. The function prescribes the wall distance assigned to this
+  // exchange velocity (a scalar function, typically a fraction of the wall-normal size of the
+  // first cell).
+  std::map<types::boundary_id, std::shared_ptr<Function<dim>>> wall_model_bc;
+
   // add more types of boundary conditions
 
 
@@ -115,6 +124,8 @@ struct BoundaryDescriptorU
       return BoundaryTypeU::Neumann;
     else if(this->symmetry_bc.find(boundary_id) != this->symmetry_bc.end())
       return BoundaryTypeU::Symmetry;
+    else if(this->wall_model_bc.find(boundary_id) != this->wall_model_bc.end())
+      return BoundaryTypeU::WallModel;
 
     AssertThrow(false, ExcMessage("Boundary type of face is invalid or not implemented."));
 
@@ -139,6 +150,9 @@ struct BoundaryDescriptorU
     if(this->symmetry_bc.find(boundary_id) != this->symmetry_bc.end())
       counter++;
 
+    if(this->wall_model_bc.find(boundary_id) != this->wall_model_bc.end())
+      counter++;
+
     if(periodic_boundary_ids.find(boundary_id) != periodic_boundary_ids.end())
       counter++;
 
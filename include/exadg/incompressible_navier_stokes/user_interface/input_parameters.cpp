@@ -70,6 +70,7 @@ InputParameters::InputParameters()
     max_velocity(-1.),
     cfl(-1.),
     cfl_oif(-1.),
+    oif_single_sweep(false),
     cfl_exponent_fe_degree_velocity(2.0),
     c_eff(-1.),
     time_step_size(-1.),
@@ -81,6 +82,8 @@ InputParameters::InputParameters()
     convergence_criterion_steady_problem(ConvergenceCriterionSteadyProblem::Undefined),
     abs_tol_steady(1.e-20),
     rel_tol_steady(1.e-12),
+    use_local_time_stepping(false),
+    max_cfl_local_time_stepping(1.e6),
 
     // output of solver information
     solver_info_data(SolverInfoData()),
@@ -136,10 +139,16 @@ InputParameters::InputParameters()
     use_turbulence_model(false),
     turbulence_model_constant(1.0),
     turbulence_model(TurbulenceEddyViscosityModel::Undefined),
+    turbulence_model_on_the_fly(false),
+    wall_model_kappa(0.41),
+    wall_model_B(5.2),
+    wall_model_newton_max_iterations(20),
+    wall_model_newton_tolerance(1.e-8),
 
     // NUMERICAL PARAMETERS
     implement_block_diagonal_preconditioner_matrix_free(false),
     use_cell_based_face_loops(false),
+    use_dof_renumbering(false),
     solver_data_block_diagonal(SolverData(1000, 1.e-12, 1.e-2, 1000)),
     quad_rule_linearization(QuadratureRuleLinearization::Overintegration32k),
 
@@ -330,6 +339,25 @@ InputParameters::check_input_parameters(ConditionalOStream & pcout)
     }
   }
 
+  if(use_local_time_stepping)
+  {
+    AssertThrow(problem_type == ProblemType::Steady && solver_type == SolverType::Unsteady,
+                ExcMessage("Local time stepping is only available for pseudo-time stepping."));
+    AssertThrow(temporal_discretization == TemporalDiscretization::BDFCoupledSolution ||
+                  temporal_discretization == TemporalDiscretization::BDFPressureCorrection,
+                ExcMessage("Local time stepping is not implemented for this solver."));
+    AssertThrow(order_time_integrator == 1,
+                ExcMessage("Local time stepping requires a first-order BDF scheme."));
+    AssertThrow(adaptive_time_stepping == false,
+                ExcMessage("Local time stepping can not be combined with adaptive time stepping."));
+    AssertThrow(cfl > 0., ExcMessage("parameter must be defined"));
+    AssertThrow(max_cfl_local_time_stepping >= cfl,
+                ExcMessage("The maximum CFL number has to be larger than the CFL number."));
+    // the local time steps of cells with vanishing velocity are given by time_step_size_max
+    AssertThrow(time_step_size_max < std::numeric_limits<double>::max(),
+                ExcMessage("Local time stepping requires a finite time_step_size_max."));
+  }
+
   if(problem_type == ProblemType::Steady && solver_type == SolverType::Unsteady)
   {
     if(temporal_discretization == TemporalDiscretization::BDFCoupledSolution)
@@ -490,6 +518,50 @@ InputParameters::check_input_parameters(ConditionalOStream & pcout)
         "Cell based face loops have to be used for matrix-free implementation of block diagonal preconditioner."));
   }
 
+  if(use_dof_renumbering)
+  {
+    // the level DoFs of local smoothing can not be renumbered consistently with the active DoFs
+    std::string const message =
+      "DoF renumbering requires multigrid preconditioners with use_global_coarsening = true.";
+
+    if(temporal_discretization == TemporalDiscretization::BDFDualSplittingScheme ||
+       temporal_discretization == TemporalDiscretization::BDFPressureCorrection)
+    {
+      if(preconditioner_pressure_poisson == PreconditionerPressurePoisson::Multigrid)
+        AssertThrow(multigrid_data_pressure_poisson.use_global_coarsening, ExcMessage(message));
+    }
+
+    if(temporal_discretization == TemporalDiscretization::BDFDualSplittingScheme)
+    {
+      if(preconditioner_viscous == PreconditionerViscous::Multigrid)
+        AssertThrow(multigrid_data_viscous.use_global_coarsening, ExcMessage(message));
+    }
+
+    if(temporal_discretization == TemporalDiscretization::BDFPressureCorrection)
+    {
+      if(preconditioner_momentum == MomentumPreconditioner::Multigrid)
+        AssertThrow(multigrid_data_momentum.use_global_coarsening, ExcMessage(message));
+    }
+
+    if(temporal_discretization == TemporalDiscretization::BDFCoupledSolution)
+    {
+      if(preconditioner_velocity_block == MomentumPreconditioner::Multigrid)
+        AssertThrow(multigrid_data_velocity_block.use_global_coarsening, ExcMessage(message));
+
+      SchurComplementPreconditioner const schur = preconditioner_pressure_block;
+      if(schur == SchurComplementPreconditioner::LaplaceOperator ||
+         schur == SchurComplementPreconditioner::CahouetChabard ||
+         schur == SchurComplementPreconditioner::PressureConvectionDiffusion)
+        AssertThrow(multigrid_data_pressure_block.use_global_coarsening, ExcMessage(message));
+    }
+
+    if(use_divergence_penalty == true || use_continuity_penalty == true)
+    {
+      if(preconditioner_projection == PreconditionerProjection::Multigrid)
+        AssertThrow(multigrid_data_projection.use_global_coarsening, ExcMessage(message));
+    }
+  }
+
 
   // TURBULENCE
   if(use_turbulence_model)
@@ -498,6 +570,11 @@ InputParameters::check_input_parameters(ConditionalOStream & pcout)
                 ExcMessage("parameter must be defined"));
     AssertThrow(turbulence_model_constant > 0, ExcMessage("parameter must be greater than zero"));
   }
+
+  AssertThrow(wall_model_kappa > 0, ExcMessage("parameter must be greater than zero"));
+  AssertThrow(wall_model_newton_max_iterations > 0,
+              ExcMessage("parameter must be greater than zero"));
+  AssertThrow(wall_model_newton_tolerance > 0, ExcMessage("parameter must be greater than zero"));
 }
 
 bool
@@ -658,6 +735,7 @@ InputParameters::print_parameters_temporal_discretization(ConditionalOStream & p
     print_parameter(pcout,
                     "Time integrator for OIF splitting",
                     enum_to_string(time_integrator_oif));
+    print_parameter(pcout, "Single-sweep OIF substepping", oif_single_sweep);
   }
 
   print_parameter(pcout,
@@ -696,6 +774,10 @@ InputParameters::print_parameters_temporal_discretization(ConditionalOStream & p
 
     print_parameter(pcout, "Absolute tolerance", abs_tol_steady);
     print_parameter(pcout, "Relative tolerance", rel_tol_steady);
+
+    print_parameter(pcout, "Local time stepping", use_local_time_stepping);
+    if(use_local_time_stepping)
+      print_parameter(pcout, "Maximum CFL number (SER)", max_cfl_local_time_stepping);
   }
 
   // output of solver information
@@ -805,7 +887,13 @@ InputParameters::print_parameters_turbulence(ConditionalOStream & pcout)
   {
     print_parameter(pcout, "Turbulence model", enum_to_string(turbulence_model));
     print_parameter(pcout, "Turbulence model constant", turbulence_model_constant);
+    print_parameter(pcout, "Evaluate turbulence model on the fly", turbulence_model_on_the_fly);
   }
+
+  print_parameter(pcout, "Wall model: von Karman constant", wall_model_kappa);
+  print_parameter(pcout, "Wall model: constant B", wall_model_B);
+  print_parameter(pcout, "Wall model: max. Newton iterations", wall_model_newton_max_iterations);
+  print_parameter(pcout, "Wall model: Newton tolerance", wall_model_newton_tolerance);
 }
 
 void
@@ -818,6 +906,7 @@ InputParameters::print_parameters_numerical_parameters(ConditionalOStream & pcou
                   implement_block_diagonal_preconditioner_matrix_free);
 
   print_parameter(pcout, "Use cell-based face loops", use_cell_based_face_loops);
+  print_parameter(pcout, "Use DoF renumbering", use_dof_renumbering);
 
   if(implement_block_diagonal_preconditioner_matrix_free)
   {
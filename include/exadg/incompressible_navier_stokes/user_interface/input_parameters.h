@@ -228,6 +228,9 @@ public:
   // critical time step size arising from the CFL restriction, cfl_oif <= cfl)
   double cfl_oif;
 
+  // OIF substepping of all history terms in one sweep, see TimeIntBDFBase for details
+  bool oif_single_sweep;
+
   // dt = CFL/k_u^{exp} * h / || u ||
   double cfl_exponent_fe_degree_velocity;
 
@@ -266,6 +269,20 @@ public:
   double abs_tol_steady;
   double rel_tol_steady;
 
+  // Pseudo-timestepping for steady-state problems with local time steps: the mass term of the
+  // momentum equation is scaled cell-wise such that each cell is advanced with its own time step
+  // size according to the local CFL condition (with CFL number cfl and the type of CFL condition
+  // adaptive_time_stepping_cfl_type, limited by time_step_size_max, which has to be finite since it
+  // defines the time step of cells with vanishing velocity). The CFL number is increased according
+  // to the switched evolution relaxation (SER) strategy, CFL_k = CFL * R_0 / R_k, where R_k is the
+  // residual of the steady Navier-Stokes equations, so that the pseudo-time stepping approaches
+  // Newton's method for the steady problem. Only implemented for the coupled solver and the
+  // pressure-correction scheme with a first-order BDF scheme.
+  bool use_local_time_stepping;
+
+  // maximum CFL number of the SER strategy
+  double max_cfl_local_time_stepping;
+
   // show solver performance (wall time, number of iterations) every ... timesteps
   SolverInfoData solver_info_data;
 
@@ -386,6 +403,19 @@ public:
   // turbulence model
   TurbulenceEddyViscosityModel turbulence_model;
 
+  // evaluate the eddy viscosity in every quadrature point of the viscous operator from the
+  // velocity gradient instead of storing it for all cell and face quadrature points
+  bool turbulence_model_on_the_fly;
+
+  // wall model (only relevant if wall-modeled boundaries are prescribed): constants of the law of
+  // the wall by Spalding, i.e., von Karman constant and additive constant of the logarithmic law
+  double wall_model_kappa;
+  double wall_model_B;
+
+  // wall model: Newton solver for the friction velocity
+  unsigned int wall_model_newton_max_iterations;
+  double       wall_model_newton_tolerance;
+
 
   /**************************************************************************************/
   /*                                                                                    */
@@ -410,6 +440,10 @@ public:
   // can be changed to such an algorithm (cell_based_face_loops).
   bool use_cell_based_face_loops;
 
+  // Renumber the degrees of freedom for data locality in the matrix-free loops, see
+  // renumber_dofs_for_data_locality() for details and restrictions.
+  bool use_dof_renumbering;
+
   // Solver data for block Jacobi preconditioner. Accordingly, this parameter is only
   // relevant if the block diagonal preconditioner is implemented in a matrix-free way
   // using an elementwise iterative solution procedure for which solver tolerances have to
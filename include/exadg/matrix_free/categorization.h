@@ -98,6 +98,19 @@ do_cell_based_loops(const parallel::TriangulationBase<dim> & tria,
     data.mapping_update_flags_inner_faces | data.mapping_update_flags_boundary_faces;
 }
 
+/*
+ * Adjust MatrixFree::AdditionalData such that cells of different time step classes of a local
+ * time stepping scheme (given for all active cells) are not mixed within one cell batch, which
+ * allows to switch cell batches on and off as a whole, see TimeStepClasses.
+ */
+template<typename AdditionalData>
+void
+do_time_step_classes(std::vector<unsigned int> const & time_step_class, AdditionalData & data)
+{
+  data.cell_vectorization_category          = time_step_class;
+  data.cell_vectorization_categories_strict = true;
+}
+
 } // namespace Categorization
 } // namespace ExaDG
 
@@ -0,0 +1,110 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_MATRIX_FREE_DOF_RENUMBERING_H_
+#define INCLUDE_EXADG_MATRIX_FREE_DOF_RENUMBERING_H_
+
+// deal.II
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+namespace ExaDG
+{
+using namespace dealii;
+
+/*
+ * Renumbers the (active) degrees of freedom of a DoFHandler in the order in which they are
+ * accessed by the cell batches of a MatrixFree loop, with ghost degrees of freedom grouped
+ * according to the face loops in case of discontinuous elements. This improves the spatial
+ * locality of vector accesses in read_dof_values()/distribute_local_to_global().
+ *
+ * The traversal is the one of a MatrixFree object set up with additional_data, which should be
+ * the AdditionalData of the MatrixFreeData of the PDE operator (mapping flags, task scheme, cell
+ * categories), i.e., this function has to be called after fill_matrix_free_data() and before
+ * MatrixFree is initialized. Note that the constraints refer to the old DoF numbering and have to
+ * be set up again after calling this function.
+ *
+ * Restrictions: Multigrid preconditioners use the vectors of the PDE operator directly on the fine
+ * level, which requires use_global_coarsening = true (see set_dof_numbering_fine_level() of
+ * MultigridPreconditionerBase), since the level DoFs of local smoothing can not be renumbered
+ * consistently with the active DoFs. Restart data is not affected, since DoF vectors are stored
+ * cell by cell, see write_restart_vector().
+ */
+template<int dim, typename Number>
+void
+renumber_dofs_for_data_locality(
+  DoFHandler<dim> &                                        dof_handler,
+  AffineConstraints<Number> const &                        constraints,
+  typename MatrixFree<dim, Number>::AdditionalData const & additional_data)
+{
+  DoFRenumbering::matrix_free_data_locality(dof_handler, constraints, additional_data);
+}
+
+/*
+ * Applies the DoF numbering of dof_handler_reference to dof_handler. Both DoFHandlers have to be
+ * set up for the same triangulation and for finite elements with the same local numbering of the
+ * degrees of freedom (e.g. FE_DGQ<dim>(k) and FESystem<dim>(FE_DGQ<dim>(k), 1)), so that
+ * both DoFHandlers own the same degrees of freedom on each process. This is used for the fine
+ * level of multigrid preconditioners, where vectors of the PDE operator are used directly.
+ */
+template<int dim>
+void
+copy_dof_numbering(DoFHandler<dim> & dof_handler, DoFHandler<dim> const & dof_handler_reference)
+{
+  AssertThrow(&dof_handler.get_triangulation() == &dof_handler_reference.get_triangulation(),
+              ExcMessage("The DoFHandlers have to be set up for the same triangulation."));
+  AssertThrow(dof_handler.get_fe().dofs_per_cell == dof_handler_reference.get_fe().dofs_per_cell,
+              ExcMessage("The DoFHandlers have to be set up for the same finite element."));
+
+  IndexSet const & locally_owned_dofs = dof_handler.locally_owned_dofs();
+
+  std::vector<types::global_dof_index> new_numbers(locally_owned_dofs.n_elements());
+
+  unsigned int const                   dofs_per_cell = dof_handler.get_fe().dofs_per_cell;
+  std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
+  std::vector<types::global_dof_index> dof_indices_reference(dofs_per_cell);
+  for(auto const & cell : dof_handler.active_cell_iterators())
+  {
+    if(not cell->is_locally_owned())
+      continue;
+
+    typename DoFHandler<dim>::active_cell_iterator const cell_reference(
+      &dof_handler_reference.get_triangulation(),
+      cell->level(),
+      cell->index(),
+      &dof_handler_reference);
+
+    cell->get_dof_indices(dof_indices);
+    cell_reference->get_dof_indices(dof_indices_reference);
+
+    for(unsigned int i = 0; i < dofs_per_cell; ++i)
+      if(locally_owned_dofs.is_element(dof_indices[i]))
+        new_numbers[locally_owned_dofs.index_within_set(dof_indices[i])] = dof_indices_reference[i];
+  }
+
+  dof_handler.renumber_dofs(new_numbers);
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_MATRIX_FREE_DOF_RENUMBERING_H_ */
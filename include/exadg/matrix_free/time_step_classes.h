@@ -0,0 +1,367 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_MATRIX_FREE_TIME_STEP_CLASSES_H_
+#define INCLUDE_EXADG_MATRIX_FREE_TIME_STEP_CLASSES_H_
+
+// C/C++
+#include <algorithm>
+#include <map>
+#include <set>
+
+// deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/vectorization.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+namespace ExaDG
+{
+using namespace dealii;
+
+/*
+ * Restricts a matrix-free loop to a subset of the cells and faces. Cell batches are switched on
+ * and off as a whole (which requires that the cells are sorted into categories accordingly),
+ * while faces are selected lane by lane since face batches may contain faces of different
+ * categories.
+ */
+template<typename Number>
+struct LoopMask
+{
+  bool
+  is_cell_batch_active(unsigned int const cell) const
+  {
+    return cell_batches[cell];
+  }
+
+  bool
+  is_face_batch_active(unsigned int const face) const
+  {
+    return face_batches[face];
+  }
+
+  VectorizedArray<Number> const &
+  get_face_lanes(unsigned int const face) const
+  {
+    return face_lanes[face];
+  }
+
+  std::vector<bool> cell_batches;
+
+  // indexed by the face batch number (inner faces and boundary faces)
+  std::vector<bool>                      face_batches;
+  AlignedVector<VectorizedArray<Number>> face_lanes;
+};
+
+/*
+ * Same as integrator.integrate_scatter() for a face integrator, but discards the contributions of
+ * those lanes of the face batch that are switched off by the (optional) loop mask.
+ */
+template<typename Integrator, typename VectorType, typename Number>
+inline void
+integrate_scatter_masked(Integrator &                     integrator,
+                         bool const                       integrate_values,
+                         bool const                       integrate_gradients,
+                         VectorType &                     dst,
+                         LoopMask<Number> const * const & loop_mask,
+                         unsigned int const               face)
+{
+  if(loop_mask == nullptr)
+  {
+    integrator.integrate_scatter(integrate_values, integrate_gradients, dst);
+  }
+  else
+  {
+    integrator.integrate(integrate_values, integrate_gradients);
+
+    VectorizedArray<Number> const & lanes = loop_mask->get_face_lanes(face);
+    for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+      integrator.begin_dof_values()[i] *= lanes;
+
+    integrator.distribute_local_to_global(dst);
+  }
+}
+
+/*
+ * Calls function(i) for all local indices i contained in the given ranges [first, second).
+ */
+template<typename Function>
+inline void
+for_each_local_index(std::vector<std::pair<unsigned int, unsigned int>> const & ranges,
+                     Function const &                                            function)
+{
+  for(auto const & range : ranges)
+    for(unsigned int i = range.first; i < range.second; ++i)
+      function(i);
+}
+
+/*
+ * Partition of the cells of a discontinuous Galerkin discretization into time step classes for
+ * local time stepping, where class c = 0, 1, ... is advanced with 2^c times the smallest time step
+ * size. A face belongs to the finer (smaller) of the classes of its two neighboring cells.
+ *
+ * For each class, this object provides the loop mask selecting its cells and faces as well as the
+ * locally owned degrees of freedom of its cells and of its coarser neighbors, i.e., those cells of
+ * a coarser class that share a face with a cell of this class. The face integrals of a class also
+ * contribute to these neighbors and they need the values of these neighbors.
+ */
+template<typename Number>
+class TimeStepClasses
+{
+public:
+  typedef std::pair<unsigned int, unsigned int> Range;
+
+  TimeStepClasses() : n_classes(1)
+  {
+  }
+
+  /*
+   * The vector class_of_cell contains the time step class of all locally owned and ghost cells,
+   * indexed by the active cell index. The cell batches of matrix_free must not mix classes, see
+   * Categorization::do_time_step_classes(). n_classes_in is the global number of classes.
+   */
+  template<int dim>
+  void
+  reinit(MatrixFree<dim, Number> const &   matrix_free,
+         unsigned int const                dof_index,
+         std::vector<unsigned int> const & class_of_cell,
+         unsigned int const                n_classes_in)
+  {
+    typedef typename DoFHandler<dim>::cell_iterator CellIterator;
+
+    n_classes = n_classes_in;
+
+    unsigned int const n_cell_batches = matrix_free.n_cell_batches();
+    unsigned int const n_face_batches =
+      matrix_free.n_inner_face_batches() + matrix_free.n_boundary_face_batches();
+
+    auto const get_class = [&](CellIterator const & cell) {
+      return class_of_cell[cell->active_cell_index()];
+    };
+
+    // loop masks
+    loop_masks.resize(n_classes);
+    for(auto & mask : loop_masks)
+    {
+      mask.cell_batches.assign(n_cell_batches, false);
+      mask.face_batches.assign(n_face_batches, false);
+      mask.face_lanes.resize(n_face_batches, make_vectorized_array<Number>(0.0));
+    }
+
+    // locally owned cells of each class and the cell batch they belong to
+    std::vector<std::vector<CellIterator>> cells(n_classes);
+    std::map<unsigned int, unsigned int>   batch_of_cell;
+    for(unsigned int cell = 0; cell < n_cell_batches; ++cell)
+    {
+      for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+      {
+        CellIterator const cell_it = matrix_free.get_cell_iterator(cell, v, dof_index);
+        unsigned int const c       = get_class(cell_it);
+
+        AssertThrow(v == 0 || loop_masks[c].cell_batches[cell],
+                    ExcMessage("Cell batch contains cells of different time step classes."));
+
+        loop_masks[c].cell_batches[cell] = true;
+        cells[c].push_back(cell_it);
+        batch_of_cell[cell_it->active_cell_index()] = cell;
+      }
+    }
+
+    for(unsigned int face = 0; face < n_face_batches; ++face)
+    {
+      bool const is_inner_face = face < matrix_free.n_inner_face_batches();
+
+      for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
+      {
+        unsigned int c = get_class(matrix_free.get_face_iterator(face, v, true, dof_index).first);
+        if(is_inner_face)
+          c = std::min(c,
+                       get_class(matrix_free.get_face_iterator(face, v, false, dof_index).first));
+
+        loop_masks[c].face_batches[face] = true;
+        loop_masks[c].face_lanes[face][v] = 1.0;
+      }
+    }
+
+    // coarser neighbors of each class, determined from the triangulation in order to include
+    // faces that are evaluated on other processors
+    std::vector<std::vector<std::set<CellIterator>>> neighbors(
+      n_classes, std::vector<std::set<CellIterator>>(n_classes));
+
+    DoFHandler<dim> const & dof_handler = matrix_free.get_dof_handler(dof_index);
+    for(auto const & cell : dof_handler.active_cell_iterators())
+    {
+      if(not cell->is_locally_owned())
+        continue;
+
+      unsigned int const c = get_class(cell);
+
+      for(unsigned int const f : cell->face_indices())
+      {
+        std::vector<CellIterator> face_neighbors;
+
+        if(cell->has_periodic_neighbor(f))
+        {
+          if(cell->periodic_neighbor_is_coarser(f) or
+             not cell->periodic_neighbor(f)->has_children())
+            face_neighbors.push_back(cell->periodic_neighbor(f));
+          else
+            for(unsigned int sf = 0; sf < cell->face(f)->n_children(); ++sf)
+              face_neighbors.push_back(cell->periodic_neighbor_child_on_subface(f, sf));
+        }
+        else if(not cell->at_boundary(f))
+        {
+          if(cell->neighbor_is_coarser(f) or not cell->neighbor(f)->has_children())
+            face_neighbors.push_back(cell->neighbor(f));
+          else
+            for(unsigned int sf = 0; sf < cell->face(f)->n_children(); ++sf)
+              face_neighbors.push_back(cell->neighbor_child_on_subface(f, sf));
+        }
+
+        for(auto const & neighbor : face_neighbors)
+        {
+          unsigned int const c_neighbor = get_class(neighbor);
+          if(c_neighbor < c)
+            neighbors[c_neighbor][c].insert(cell);
+        }
+      }
+    }
+
+    // cell batches and degrees of freedom touched by the evaluation of each class
+    std::shared_ptr<Utilities::MPI::Partitioner const> const partitioner =
+      matrix_free.get_vector_partitioner(dof_index);
+
+    std::vector<types::global_dof_index> dof_indices(dof_handler.get_fe().dofs_per_cell);
+
+    auto const compute_ranges = [&](std::vector<CellIterator> const & cells_in) {
+      std::vector<unsigned int> local_indices;
+      for(auto const & cell : cells_in)
+      {
+        cell->get_dof_indices(dof_indices);
+        for(auto const index : dof_indices)
+          local_indices.push_back(partitioner->global_to_local(index));
+      }
+      std::sort(local_indices.begin(), local_indices.end());
+
+      std::vector<Range> ranges;
+      for(auto const i : local_indices)
+      {
+        if(not ranges.empty() and ranges.back().second == i)
+          ++ranges.back().second;
+        else
+          ranges.push_back(Range(i, i + 1));
+      }
+      return ranges;
+    };
+
+    cell_batches_touched.resize(n_classes);
+    dof_ranges.resize(n_classes);
+    dof_ranges_neighbors.resize(n_classes);
+    dof_ranges_touched.resize(n_classes);
+    for(unsigned int c = 0; c < n_classes; ++c)
+    {
+      cell_batches_touched[c] = loop_masks[c].cell_batches;
+      dof_ranges[c]           = compute_ranges(cells[c]);
+
+      dof_ranges_neighbors[c].resize(n_classes);
+      for(unsigned int c_neighbor = c + 1; c_neighbor < n_classes; ++c_neighbor)
+      {
+        std::vector<CellIterator> const cells_neighbor(neighbors[c][c_neighbor].begin(),
+                                                       neighbors[c][c_neighbor].end());
+        dof_ranges_neighbors[c][c_neighbor] = compute_ranges(cells_neighbor);
+
+        for(auto const & cell : cells_neighbor)
+          cell_batches_touched[c][batch_of_cell[cell->active_cell_index()]] = true;
+      }
+
+      std::vector<CellIterator> cells_touched;
+      for(unsigned int cell = 0; cell < n_cell_batches; ++cell)
+        if(cell_batches_touched[c][cell])
+          for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+            cells_touched.push_back(matrix_free.get_cell_iterator(cell, v, dof_index));
+      dof_ranges_touched[c] = compute_ranges(cells_touched);
+    }
+  }
+
+  unsigned int
+  get_number_of_classes() const
+  {
+    return n_classes;
+  }
+
+  LoopMask<Number> const &
+  get_loop_mask(unsigned int const c) const
+  {
+    return loop_masks[c];
+  }
+
+  /*
+   * Cell batches containing cells of class c or coarser neighbors of class c.
+   */
+  std::vector<bool> const &
+  get_cell_batches_touched(unsigned int const c) const
+  {
+    return cell_batches_touched[c];
+  }
+
+  /*
+   * Locally owned degrees of freedom of the cells of class c.
+   */
+  std::vector<Range> const &
+  get_dof_ranges(unsigned int const c) const
+  {
+    return dof_ranges[c];
+  }
+
+  /*
+   * Locally owned degrees of freedom of the cells of class c_neighbor > c that are neighbors of
+   * cells of class c.
+   */
+  std::vector<Range> const &
+  get_dof_ranges_neighbors(unsigned int const c, unsigned int const c_neighbor) const
+  {
+    return dof_ranges_neighbors[c][c_neighbor];
+  }
+
+  /*
+   * Locally owned degrees of freedom of all cells in the cell batches touched by class c.
+   */
+  std::vector<Range> const &
+  get_dof_ranges_touched(unsigned int const c) const
+  {
+    return dof_ranges_touched[c];
+  }
+
+private:
+  unsigned int n_classes;
+
+  std::vector<LoopMask<Number>> loop_masks;
+
+  std::vector<std::vector<bool>> cell_batches_touched;
+
+  std::vector<std::vector<Range>>              dof_ranges;
+  std::vector<std::vector<std::vector<Range>>> dof_ranges_neighbors;
+  std::vector<std::vector<Range>>              dof_ranges_touched;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_MATRIX_FREE_TIME_STEP_CLASSES_H_ */
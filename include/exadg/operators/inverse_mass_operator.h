@@ -72,6 +72,32 @@ public:
     matrix_free->cell_loop(&This::cell_loop, this, dst, src);
   }
 
+  /*
+   * Applies the inverse mass operator only on the cell batches selected by cell_batch_mask (e.g.
+   * for local time stepping). The remaining entries of dst are not modified.
+   */
+  void
+  apply(VectorType & dst, VectorType const & src, std::vector<bool> const & cell_batch_mask) const
+  {
+    dst.zero_out_ghosts();
+
+    Integrator          integrator(*matrix_free, dof_index, quad_index);
+    CellwiseInverseMass inverse(integrator);
+
+    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+    {
+      if(not cell_batch_mask[cell])
+        continue;
+
+      integrator.reinit(cell);
+      integrator.read_dof_values(src, 0);
+
+      inverse.apply(integrator.begin_dof_values(), integrator.begin_dof_values());
+
+      integrator.set_dof_values(dst, 0);
+    }
+  }
+
 private:
   void
   cell_loop(MatrixFree<dim, Number> const &,
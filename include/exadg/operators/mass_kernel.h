@@ -71,6 +71,17 @@ public:
   {
     return scaling_factor * value;
   }
+
+  /*
+   * Volume flux with a scaling factor that varies between the cells of a cell batch
+   */
+  template<typename T>
+  inline DEAL_II_ALWAYS_INLINE //
+    T
+    get_volume_flux(VectorizedArray<Number> const & scaling_factor, T const & value) const
+  {
+    return scaling_factor * value;
+  }
 };
 
 } // namespace ExaDG
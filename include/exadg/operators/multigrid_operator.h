@@ -106,6 +106,16 @@ public:
     pde_operator->vmult_add(dst, src);
   }
 
+  virtual void
+  vmult(VectorType &                                                        dst,
+        VectorType const &                                                  src,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_before_loop,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_after_loop)
+    const
+  {
+    pde_operator->vmult(dst, src, operation_before_loop, operation_after_loop);
+  }
+
   virtual void
   vmult_interface_down(VectorType & dst, VectorType const & src) const
   {
@@ -24,6 +24,8 @@
 
 #include <deal.II/matrix_free/matrix_free.h>
 
+#include <functional>
+
 namespace ExaDG
 {
 using namespace dealii;
@@ -70,6 +72,13 @@ public:
   virtual void
   vmult_add(VectorType & dst, VectorType const & src) const = 0;
 
+  virtual void
+  vmult(VectorType &                                                        dst,
+        VectorType const &                                                  src,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_before_loop,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_after_loop)
+    const = 0;
+
   virtual void
   vmult_interface_down(VectorType & dst, VectorType const & src) const = 0;
 
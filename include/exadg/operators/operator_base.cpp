@@ -182,6 +182,45 @@ OperatorBase<dim, Number, n_components>::vmult_add(VectorType & dst, VectorType
   this->apply_add(dst, src);
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::vmult(
+  VectorType &                                                        dst,
+  VectorType const &                                                  src,
+  std::function<void(unsigned int const, unsigned int const)> const & operation_before_loop,
+  std::function<void(unsigned int const, unsigned int const)> const & operation_after_loop) const
+{
+  if(is_dg)
+  {
+    if(evaluate_face_integrals())
+      matrix_free->loop(&This::cell_loop,
+                        &This::face_loop,
+                        &This::boundary_face_loop_hom_operator,
+                        this,
+                        dst,
+                        src,
+                        operation_before_loop,
+                        operation_after_loop,
+                        data.dof_index);
+    else
+      matrix_free->cell_loop(&This::cell_loop,
+                             this,
+                             dst,
+                             src,
+                             operation_before_loop,
+                             operation_after_loop,
+                             data.dof_index);
+  }
+  else
+  {
+    // The treatment of constrained degrees of freedom in apply_add() modifies entire vectors, so
+    // the additional operations are performed on the whole range of locally owned DoFs.
+    operation_before_loop(0, dst.local_size());
+    apply_add(dst, src);
+    operation_after_loop(0, dst.local_size());
+  }
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::vmult_interface_down(VectorType &       dst,
@@ -1691,16 +1730,19 @@ OperatorBase<dim, Number, n_components>::cell_loop_calculate_system_matrix(
 
   unsigned int const dofs_per_cell = integrator->dofs_per_cell;
 
+  // create a temporal full matrix for the local element matrix of each ...
+  // cell of each macro cell and ...
+  FullMatrix_ matrices[vectorization_length];
+  // set their size
+  std::fill_n(matrices, vectorization_length, FullMatrix_(dofs_per_cell, dofs_per_cell));
+
+  std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
+  std::vector<types::global_dof_index> dof_indices_temp(dofs_per_cell);
+
   for(auto cell = range.first; cell < range.second; ++cell)
   {
     unsigned int const n_filled_lanes = matrix_free.n_active_entries_per_cell_batch(cell);
 
-    // create a temporal full matrix for the local element matrix of each ...
-    // cell of each macro cell and ...
-    FullMatrix_ matrices[vectorization_length];
-    // set their size
-    std::fill_n(matrices, vectorization_length, FullMatrix_(dofs_per_cell, dofs_per_cell));
-
     this->reinit_cell(cell);
 
     for(unsigned int j = 0; j < dofs_per_cell; ++j)
@@ -1726,7 +1768,6 @@ OperatorBase<dim, Number, n_components>::cell_loop_calculate_system_matrix(
     {
       auto cell_v = matrix_free.get_cell_iterator(cell, v);
 
-      std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
       if(is_mg)
         cell_v->get_mg_dof_indices(dof_indices);
       else
@@ -1737,12 +1778,13 @@ OperatorBase<dim, Number, n_components>::cell_loop_calculate_system_matrix(
         // in the case of CG: shape functions are not ordered lexicographically
         // see (https://www.dealii.org/8.5.1/doxygen/deal.II/classFE__Q.html)
         // so we have to fix the order
-        auto temp = dof_indices;
+        dof_indices_temp = dof_indices;
         for(unsigned int j = 0; j < dof_indices.size(); j++)
-          dof_indices[j] = temp[matrix_free.get_shape_info().lexicographic_numbering[j]];
+          dof_indices[j] =
+            dof_indices_temp[matrix_free.get_shape_info().lexicographic_numbering[j]];
       }
 
-      constraint_double.distribute_local_to_global(matrices[v], dof_indices, dof_indices, dst);
+      this->add_local_to_global_matrix(matrices[v], dof_indices, dof_indices, dst);
     }
   }
 }
@@ -1775,6 +1817,10 @@ OperatorBase<dim, Number, n_components>::face_loop_calculate_system_matrix(
   FullMatrix_ matrices_p[vectorization_length];
   std::fill_n(matrices_p, vectorization_length, FullMatrix_(dofs_per_cell, dofs_per_cell));
 
+  // positions in global matrix
+  std::vector<types::global_dof_index> dof_indices_m(dofs_per_cell);
+  std::vector<types::global_dof_index> dof_indices_p(dofs_per_cell);
+
   for(auto face = range.first; face < range.second; ++face)
   {
     // determine number of filled vector lanes
@@ -1824,8 +1870,6 @@ OperatorBase<dim, Number, n_components>::face_loop_calculate_system_matrix(
                                                   cell_number_p % vectorization_length);
 
       // get position in global matrix
-      std::vector<types::global_dof_index> dof_indices_m(dofs_per_cell);
-      std::vector<types::global_dof_index> dof_indices_p(dofs_per_cell);
       if(is_mg)
       {
         cell_m->get_mg_dof_indices(dof_indices_m);
@@ -1838,15 +1882,9 @@ OperatorBase<dim, Number, n_components>::face_loop_calculate_system_matrix(
       }
 
       // save M_mm
-      constraint_double.distribute_local_to_global(matrices_m[v],
-                                                   dof_indices_m,
-                                                   dof_indices_m,
-                                                   dst);
+      this->add_local_to_global_matrix(matrices_m[v], dof_indices_m, dof_indices_m, dst);
       // save M_pm
-      constraint_double.distribute_local_to_global(matrices_p[v],
-                                                   dof_indices_p,
-                                                   dof_indices_m,
-                                                   dst);
+      this->add_local_to_global_matrix(matrices_p[v], dof_indices_p, dof_indices_m, dst);
     }
 
     // process positive trial function
@@ -1891,8 +1929,6 @@ OperatorBase<dim, Number, n_components>::face_loop_calculate_system_matrix(
                                                   cell_number_p % vectorization_length);
 
       // get position in global matrix
-      std::vector<types::global_dof_index> dof_indices_m(dofs_per_cell);
-      std::vector<types::global_dof_index> dof_indices_p(dofs_per_cell);
       if(is_mg)
       {
         cell_m->get_mg_dof_indices(dof_indices_m);
@@ -1905,15 +1941,9 @@ OperatorBase<dim, Number, n_components>::face_loop_calculate_system_matrix(
       }
 
       // save M_mp
-      constraint_double.distribute_local_to_global(matrices_m[v],
-                                                   dof_indices_m,
-                                                   dof_indices_p,
-                                                   dst);
+      this->add_local_to_global_matrix(matrices_m[v], dof_indices_m, dof_indices_p, dst);
       // save M_pp
-      constraint_double.distribute_local_to_global(matrices_p[v],
-                                                   dof_indices_p,
-                                                   dof_indices_p,
-                                                   dst);
+      this->add_local_to_global_matrix(matrices_p[v], dof_indices_p, dof_indices_p, dst);
     }
   }
 }
@@ -1930,14 +1960,16 @@ OperatorBase<dim, Number, n_components>::boundary_face_loop_calculate_system_mat
 
   unsigned int const dofs_per_cell = integrator_m->dofs_per_cell;
 
+  // create temporary matrices for local blocks
+  FullMatrix_ matrices[vectorization_length];
+  std::fill_n(matrices, vectorization_length, FullMatrix_(dofs_per_cell, dofs_per_cell));
+
+  std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
+
   for(auto face = range.first; face < range.second; ++face)
   {
     unsigned int const n_filled_lanes = matrix_free.n_active_entries_per_face_batch(face);
 
-    // create temporary matrices for local blocks
-    FullMatrix_ matrices[vectorization_length];
-    std::fill_n(matrices, vectorization_length, FullMatrix_(dofs_per_cell, dofs_per_cell));
-
     this->reinit_boundary_face(face);
 
     auto bid = matrix_free.get_boundary_id(face);
@@ -1967,16 +1999,35 @@ OperatorBase<dim, Number, n_components>::boundary_face_loop_calculate_system_mat
       auto cell_v = matrix_free.get_cell_iterator(cell_number / vectorization_length,
                                                   cell_number % vectorization_length);
 
-      std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
       if(is_mg)
         cell_v->get_mg_dof_indices(dof_indices);
       else
         cell_v->get_dof_indices(dof_indices);
 
-      constraint_double.distribute_local_to_global(matrices[v], dof_indices, dof_indices, dst);
+      this->add_local_to_global_matrix(matrices[v], dof_indices, dof_indices, dst);
     }
   }
 }
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::add_local_to_global_matrix(
+  FullMatrix_ const &                          local_matrix,
+  std::vector<types::global_dof_index> const & row_indices,
+  std::vector<types::global_dof_index> const & column_indices,
+  SparseMatrix &                               dst) const
+{
+  if(constraint_double.n_constraints() == 0)
+  {
+    // Without constraints, the local matrix can be added block-wise, avoiding the overhead of
+    // resolving constraints for every single entry. The resulting values are identical.
+    dst.add(row_indices, column_indices, local_matrix);
+  }
+  else
+  {
+    constraint_double.distribute_local_to_global(local_matrix, row_indices, column_indices, dst);
+  }
+}
 #endif
 
 template<int dim, typename Number, int n_components>
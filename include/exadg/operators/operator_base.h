@@ -22,6 +22,9 @@
 #ifndef OPERATION_BASE_H
 #define OPERATION_BASE_H
 
+// C/C++
+#include <functional>
+
 // deal.II
 #include <deal.II/base/subscriptor.h>
 #include <deal.II/dofs/dof_handler.h>
@@ -147,6 +150,19 @@ public:
   void
   vmult_add(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * Matrix-vector product with additional operations on ranges of locally owned DoFs that are
+   * executed before the first and after the last cell touching these DoFs has been processed. This
+   * allows to fuse vector updates (e.g. of a Chebyshev iteration) into the matrix-free loop. Note
+   * that dst is not set to zero by this function, which has to be done by operation_before_loop.
+   */
+  void
+  vmult(VectorType &                                                        dst,
+        VectorType const &                                                  src,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_before_loop,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_after_loop)
+    const;
+
   void
   vmult_interface_down(VectorType & dst, VectorType const & src) const;
 
@@ -575,6 +591,15 @@ private:
                                              SparseMatrix &                  dst,
                                              SparseMatrix const &            src,
                                              Range const &                   range) const;
+
+  /*
+   * Adds a local (element or face coupling) matrix to the global sparse matrix.
+   */
+  void
+  add_local_to_global_matrix(FullMatrix_ const &                          local_matrix,
+                             std::vector<types::global_dof_index> const & row_indices,
+                             std::vector<types::global_dof_index> const & column_indices,
+                             SparseMatrix &                               dst) const;
 #endif
 
   /*
@@ -85,6 +85,22 @@ LaplaceOperator<dim, Number, n_components>::rhs_add_dirichlet_bc_from_dof_vector
   dst.add(-1.0, tmp);
 }
 
+template<int dim, typename Number, int n_components>
+void
+LaplaceOperator<dim, Number, n_components>::integrate_boundary_face_inhom_operator(
+  IntegratorFace &         integrator_m,
+  types::boundary_id const boundary_id) const
+{
+  AssertThrow(this->is_dg, ExcMessage("This function is only implemented for DG."));
+
+  kernel.reinit_boundary_face(integrator_m);
+
+  do_boundary_integral(integrator_m, OperatorType::inhomogeneous, boundary_id);
+
+  integrator_m.integrate(this->integrator_flags.face_integrate.value,
+                         this->integrator_flags.face_integrate.gradient);
+}
+
 template<int dim, typename Number, int n_components>
 void
 LaplaceOperator<dim, Number, n_components>::reinit_face(unsigned int const face) const
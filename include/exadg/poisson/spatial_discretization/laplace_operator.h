@@ -251,6 +251,14 @@ public:
   void
   rhs_add_dirichlet_bc_from_dof_vector(VectorType & dst, VectorType const & src) const;
 
+  // This function evaluates and integrates the inhomogeneous boundary face integrals in DG for the
+  // boundary face integrator_m has been reinitialized to, so that they can be combined with other
+  // boundary face integrals in one loop. As opposed to rhs_add(), the result is not multiplied
+  // by -1.
+  void
+  integrate_boundary_face_inhom_operator(IntegratorFace &         integrator_m,
+                                         types::boundary_id const boundary_id) const;
+
   // continuous FE: This function sets the constrained Dirichlet boundary values.
   void
   set_constrained_values(VectorType & solution, double const time) const override;
@@ -26,6 +26,7 @@
 #include <deal.II/numerics/vector_tools.h>
 
 // ExaDG
+#include <exadg/matrix_free/dof_renumbering.h>
 #include <exadg/poisson/preconditioner/multigrid_preconditioner.h>
 #include <exadg/poisson/spatial_discretization/operator.h>
 #include <exadg/solvers_and_preconditioners/preconditioner/inverse_mass_preconditioner.h>
@@ -97,9 +98,34 @@ Operator<dim, Number, n_components>::distribute_dofs()
   }
 
   dof_handler.distribute_dofs(*fe);
-
   dof_handler.distribute_mg_dofs();
 
+  initialize_affine_constraints();
+
+  unsigned int const ndofs_per_cell = Utilities::pow(degree + 1, dim);
+
+  pcout << std::endl;
+
+  if(param.spatial_discretization == SpatialDiscretization::DG)
+    pcout << std::endl
+          << "Discontinuous Galerkin finite element discretization:" << std::endl
+          << std::endl;
+  else if(param.spatial_discretization == SpatialDiscretization::CG)
+    pcout << std::endl
+          << "Continuous Galerkin finite element discretization:" << std::endl
+          << std::endl;
+  else
+    AssertThrow(false, ExcMessage("Not implemented."));
+
+  print_parameter(pcout, "degree of 1D polynomials", degree);
+  print_parameter(pcout, "number of dofs per cell", ndofs_per_cell);
+  print_parameter(pcout, "number of dofs (total)", dof_handler.n_dofs());
+}
+
+template<int dim, typename Number, int n_components>
+void
+Operator<dim, Number, n_components>::initialize_affine_constraints()
+{
   // affine constraints only relevant for continuous FE discretization
   if(param.spatial_discretization == SpatialDiscretization::CG)
   {
@@ -125,25 +151,17 @@ Operator<dim, Number, n_components>::distribute_dofs()
 
     affine_constraints.close();
   }
+}
 
-  unsigned int const ndofs_per_cell = Utilities::pow(degree + 1, dim);
-
-  pcout << std::endl;
-
-  if(param.spatial_discretization == SpatialDiscretization::DG)
-    pcout << std::endl
-          << "Discontinuous Galerkin finite element discretization:" << std::endl
-          << std::endl;
-  else if(param.spatial_discretization == SpatialDiscretization::CG)
-    pcout << std::endl
-          << "Continuous Galerkin finite element discretization:" << std::endl
-          << std::endl;
-  else
-    AssertThrow(false, ExcMessage("Not implemented."));
+template<int dim, typename Number, int n_components>
+void
+Operator<dim, Number, n_components>::renumber_dofs(
+  MatrixFreeData<dim, Number> const & matrix_free_data)
+{
+  renumber_dofs_for_data_locality(dof_handler, affine_constraints, matrix_free_data.data);
 
-  print_parameter(pcout, "degree of 1D polynomials", degree);
-  print_parameter(pcout, "number of dofs per cell", ndofs_per_cell);
-  print_parameter(pcout, "number of dofs (total)", dof_handler.n_dofs());
+  // the constraints refer to the DoF numbering
+  initialize_affine_constraints();
 }
 
 template<int dim, typename Number, int n_components>
@@ -257,6 +275,9 @@ Operator<dim, Number, n_components>::setup_solver()
         &this->dof_handler.get_triangulation());
     const FiniteElement<dim> & fe = this->dof_handler.get_fe();
 
+    if(param.use_dof_renumbering)
+      mg_preconditioner->set_dof_numbering_fine_level(dof_handler);
+
     mg_preconditioner->initialize(mg_data,
                                   tria,
                                   fe,
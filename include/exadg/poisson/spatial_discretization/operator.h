@@ -78,6 +78,14 @@ public:
   void
   fill_matrix_free_data(MatrixFreeData<dim, Number> & matrix_free_data) const;
 
+  /*
+   * Renumbers the degrees of freedom for data locality in the matrix-free loops set up with
+   * matrix_free_data (parameter use_dof_renumbering). Has to be called after
+   * fill_matrix_free_data() and before MatrixFree is initialized.
+   */
+  void
+  renumber_dofs(MatrixFreeData<dim, Number> const & matrix_free_data);
+
   void
   setup(std::shared_ptr<MatrixFree<dim, Number>>     matrix_free,
         std::shared_ptr<MatrixFreeData<dim, Number>> matrix_free_data);
@@ -153,6 +161,9 @@ private:
   void
   distribute_dofs();
 
+  void
+  initialize_affine_constraints();
+
   void
   setup_operators();
 
@@ -47,7 +47,8 @@ InputParameters::InputParameters()
     compute_performance_metrics(false),
     preconditioner(Preconditioner::Undefined),
     multigrid_data(MultigridData()),
-    enable_cell_based_face_loops(false)
+    enable_cell_based_face_loops(false),
+    use_dof_renumbering(false)
 {
 }
 
@@ -67,6 +68,15 @@ InputParameters::check_input_parameters()
   AssertThrow(solver != Solver::Undefined, ExcMessage("parameter must be defined."));
   AssertThrow(preconditioner != Preconditioner::Undefined,
               ExcMessage("parameter must be defined."));
+
+  // NUMERICAL PARAMETERS
+  if(use_dof_renumbering && preconditioner == Preconditioner::Multigrid)
+  {
+    // the level DoFs of local smoothing can not be renumbered consistently with the active DoFs
+    AssertThrow(multigrid_data.use_global_coarsening,
+                ExcMessage(
+                  "DoF renumbering requires multigrid with use_global_coarsening = true."));
+  }
 }
 
 void
@@ -132,6 +142,7 @@ InputParameters::print_parameters_numerical_parameters(ConditionalOStream & pcou
   pcout << std::endl << "Numerical parameters:" << std::endl;
 
   print_parameter(pcout, "Enable cell-based face loops", enable_cell_based_face_loops);
+  print_parameter(pcout, "Use DoF renumbering", use_dof_renumbering);
 }
 
 
@@ -121,6 +121,10 @@ public:
   // individual cells (for example block Jacobi). With this parameter, the loop structure
   // can be changed to such an algorithm (cell_based_face_loops).
   bool enable_cell_based_face_loops;
+
+  // Renumber the degrees of freedom for data locality in the matrix-free loops, see
+  // renumber_dofs_for_data_locality() for details and restrictions.
+  bool use_dof_renumbering;
 };
 
 } // namespace Poisson
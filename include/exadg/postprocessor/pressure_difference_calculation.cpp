@@ -24,7 +24,6 @@
 
 // ExaDG
 #include <exadg/postprocessor/pressure_difference_calculation.h>
-#include <exadg/vector_tools/point_value.h>
 
 namespace ExaDG
 {
@@ -46,6 +45,14 @@ PressureDifferenceCalculator<dim, Number>::setup(
   dof_handler_pressure     = &dof_handler_pressure_in;
   mapping                  = &mapping_in;
   pressure_difference_data = pressure_difference_data_in;
+
+  if(pressure_difference_data.calculate_pressure_difference == true)
+  {
+    std::vector<Point<dim>> points = {pressure_difference_data.point_1,
+                                      pressure_difference_data.point_2};
+
+    pressure_evaluator.setup(*dof_handler_pressure, *mapping, points, mpi_comm);
+  }
 }
 
 template<int dim, typename Number>
@@ -55,18 +62,10 @@ PressureDifferenceCalculator<dim, Number>::evaluate(VectorType const & pressure,
 {
   if(pressure_difference_data.calculate_pressure_difference == true)
   {
-    Number pressure_1 = 0.0, pressure_2 = 0.0;
-
-    Point<dim> point_1, point_2;
-    point_1 = pressure_difference_data.point_1;
-    point_2 = pressure_difference_data.point_2;
-
-    evaluate_scalar_quantity_in_point(
-      pressure_1, *dof_handler_pressure, *mapping, pressure, point_1, mpi_comm);
-    evaluate_scalar_quantity_in_point(
-      pressure_2, *dof_handler_pressure, *mapping, pressure, point_2, mpi_comm);
+    std::vector<Number> pressure_values;
+    pressure_evaluator.evaluate_scalar(pressure_values, pressure);
 
-    Number const pressure_difference = pressure_1 - pressure_2;
+    Number const pressure_difference = pressure_values[0] - pressure_values[1];
 
     if(Utilities::MPI::this_mpi_process(mpi_comm) == 0)
     {
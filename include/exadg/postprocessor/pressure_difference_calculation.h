@@ -28,6 +28,9 @@
 #include <deal.II/fe/mapping_q.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
+// ExaDG
+#include <exadg/vector_tools/point_value.h>
+
 namespace ExaDG
 {
 using namespace dealii;
@@ -82,6 +85,9 @@ private:
   SmartPointer<Mapping<dim> const>    mapping;
 
   PressureDifferenceData<dim> pressure_difference_data;
+
+  // cached evaluation of the pressure in point_1 and point_2
+  PointValueCache<dim, Number> pressure_evaluator;
 };
 
 } // namespace ExaDG
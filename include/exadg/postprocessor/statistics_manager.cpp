@@ -48,12 +48,25 @@ StatisticsManager<dim, Number>::StatisticsManager(DoFHandler<dim> const & dof_ha
                       &dof_handler_velocity.get_triangulation())
                       ->get_communicator()) :
                    MPI_COMM_SELF),
+    velocity_is_vector_valued(false),
+    n_dofs_per_cell_scalar(0),
+    n_points_per_plane(0),
+    n_cells(0),
+    request(MPI_REQUEST_NULL),
+    sample_in_flight(false),
     number_of_samples(0),
     write_final_output(true),
     turb_channel_data(TurbulentChannelData())
 {
 }
 
+template<int dim, typename Number>
+StatisticsManager<dim, Number>::~StatisticsManager()
+{
+  if(sample_in_flight)
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+}
+
 
 template<int dim, typename Number>
 void
@@ -288,7 +301,178 @@ StatisticsManager<dim, Number>::setup(const std::function<double(double const &)
     }
 
     AssertThrow(y_glob.size() == n_points_y_glob, ExcInternalError());
+
+    setup_sampling();
+  }
+}
+
+template<int dim, typename Number>
+void
+StatisticsManager<dim, Number>::setup_sampling()
+{
+  FiniteElement<dim> const & fe = dof_handler.get_fe();
+
+  // vector-valued FE where all components are explicitly listed in the DoFHandler, or scalar FE
+  // where we have several vectors referring to the same DoFHandler
+  velocity_is_vector_valued = fe.element_multiplicity(0) >= dim;
+  if(not(velocity_is_vector_valued))
+    AssertDimension(fe.element_multiplicity(0), 1);
+
+  n_dofs_per_cell_scalar = fe.base_element(0).dofs_per_cell;
+
+  // use 2d quadrature to integrate over x-z-planes
+  QGauss<dim - 1> gauss_2d(fe.degree + 1);
+  n_points_per_plane = gauss_2d.size();
+
+  // a single quadrature rule comprising the points of all x-z-planes of a cell
+  unsigned int const n_points = n_points_y_per_cell * n_points_per_plane;
+
+  std::vector<Point<dim>> points(n_points);
+  std::vector<double>     quad_weights(n_points);
+  for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+  {
+    for(unsigned int j = 0; j < n_points_per_plane; ++j)
+    {
+      unsigned int const point = i * n_points_per_plane + j;
+
+      points[point][0] = gauss_2d.point(j)[0];
+      if(dim == 3)
+        points[point][2] = gauss_2d.point(j)[1];
+      points[point][1]    = (double)i / (n_points_y_per_cell - 1);
+      quad_weights[point] = gauss_2d.weight(j);
+    }
+  }
+
+  FEValues<dim> fe_values(mapping,
+                          fe.base_element(0),
+                          Quadrature<dim>(points, quad_weights),
+                          update_values | update_jacobians | update_quadrature_points);
+
+  // the shape values do not depend on the cell
+  shape_values.resize(n_points * n_dofs_per_cell_scalar);
+  for(unsigned int p = 0; p < n_points; ++p)
+    for(unsigned int j = 0; j < n_dofs_per_cell_scalar; ++j)
+      shape_values[p * n_dofs_per_cell_scalar + j] = fe_values.get_fe().shape_value(j, points[p]);
+
+  std::vector<double> area_loc(y_glob.size(), 0.0);
+  std::vector<double> cell_weights;
+
+  std::vector<types::global_dof_index> cell_dof_indices(fe.dofs_per_cell);
+
+  n_cells = 0;
+  dof_indices.clear();
+  y_index.clear();
+
+  for(typename DoFHandler<dim>::active_cell_iterator cell = dof_handler.begin_active();
+      cell != dof_handler.end();
+      ++cell)
+  {
+    if(cell->is_locally_owned())
+    {
+      fe_values.reinit(typename Triangulation<dim>::active_cell_iterator(cell));
+
+      // store dof indices ordered by components
+      cell->get_dof_indices(cell_dof_indices);
+
+      std::vector<types::global_dof_index> indices(dim * n_dofs_per_cell_scalar);
+      if(velocity_is_vector_valued)
+      {
+        for(unsigned int j = 0; j < cell_dof_indices.size(); ++j)
+        {
+          std::pair<unsigned int, unsigned int> const comp = fe.system_to_component_index(j);
+          if(comp.first < dim)
+            indices[comp.first * n_dofs_per_cell_scalar + comp.second] = cell_dof_indices[j];
+        }
+      }
+      else
+      {
+        for(unsigned int d = 0; d < dim; ++d)
+          for(unsigned int j = 0; j < n_dofs_per_cell_scalar; ++j)
+            indices[d * n_dofs_per_cell_scalar + j] = cell_dof_indices[j];
+      }
+      dof_indices.insert(dof_indices.end(), indices.begin(), indices.end());
+
+      // loop over all x-z-planes of current cell
+      for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+      {
+        // Tranform cell index 'i' to global index 'idx' of y_glob-vector
+
+        // find index within the y-values: first do a binary search to find
+        // the next larger value of y in the list...
+        double const y = fe_values.quadrature_point(i * n_points_per_plane)[1];
+        // std::lower_bound: returns iterator to first element that is >= y.
+        // Note that the vector y_glob has to be sorted. As a result, the
+        // index might be too large.
+        unsigned int idx =
+          std::distance(y_glob.begin(), std::lower_bound(y_glob.begin(), y_glob.end(), y));
+
+        // make sure that the index does not exceed the array bounds in case of round-off errors
+        if(idx == y_glob.size())
+          idx--;
+
+        // reduce index by 1 in case that the previous point is closer to y than
+        // the next point
+        if(idx > 0 && std::abs(y_glob[idx - 1] - y) < std::abs(y_glob[idx] - y))
+          idx--;
+
+        AssertThrow(std::abs(y_glob[idx] - y) < 1e-13,
+                    ExcMessage("Could not locate " + std::to_string(y) +
+                               " among pre-evaluated points. Closest point is " +
+                               std::to_string(y_glob[idx]) + " at distance " +
+                               std::to_string(std::abs(y_glob[idx] - y)) +
+                               ". Check transform() function given to constructor."));
+
+        y_index.push_back(idx);
+
+        // surface element of the x-z-plane
+        for(unsigned int q = 0; q < n_points_per_plane; ++q)
+        {
+          unsigned int const point = i * n_points_per_plane + q;
+
+          double det = 0.;
+          if(dim == 3)
+          {
+            Tensor<2, 2> reduced_jacobian;
+            reduced_jacobian[0][0] = fe_values.jacobian(point)[0][0];
+            reduced_jacobian[0][1] = fe_values.jacobian(point)[0][2];
+            reduced_jacobian[1][0] = fe_values.jacobian(point)[2][0];
+            reduced_jacobian[1][1] = fe_values.jacobian(point)[2][2];
+            det                    = determinant(reduced_jacobian);
+          }
+          else
+          {
+            det = std::abs(fe_values.jacobian(point)[0][0]);
+          }
+
+          double const area_ele = det * fe_values.get_quadrature().weight(point);
+
+          cell_weights.push_back(area_ele);
+          area_loc[idx] += area_ele;
+        }
+      }
+
+      ++n_cells;
+    }
   }
+
+  // the area of the x-z-planes does not change from sample to sample
+  area_glob.resize(y_glob.size());
+  Utilities::MPI::sum(area_loc, communicator, area_glob);
+
+  // arrange integration weights in batches of cells, with zero weights for unused lanes
+  unsigned int const n_lanes   = VectorizedArray<double>::size();
+  unsigned int const n_batches = (n_cells + n_lanes - 1) / n_lanes;
+
+  weights.resize(n_batches * n_points);
+  for(unsigned int i = 0; i < weights.size(); ++i)
+    weights[i] = 0.0;
+
+  for(unsigned int cell = 0; cell < n_cells; ++cell)
+    for(unsigned int p = 0; p < n_points; ++p)
+      weights[(cell / n_lanes) * n_points + p][cell % n_lanes] = cell_weights[cell * n_points + p];
+
+  buffer_local.resize((2 * dim + 1) * y_glob.size());
+  buffer_global.resize((2 * dim + 1) * y_glob.size());
 }
 
 template<int dim, typename Number>
@@ -356,6 +540,9 @@ StatisticsManager<dim, Number>::write_output(const std::string output_prefix,
                                              double const      dynamic_viscosity,
                                              double const      density)
 {
+  // make sure that the last sample is included
+  finish_sampling();
+
   if(Utilities::MPI::this_mpi_process(communicator) == 0)
   {
     // tau_w = mu * d<u>/dy = mu * (<u>(y2)-<u>(y1))/(y2-y1), where mu = rho * nu
@@ -411,6 +598,8 @@ template<int dim, typename Number>
 void
 StatisticsManager<dim, Number>::reset()
 {
+  finish_sampling();
+
   for(unsigned int i = 0; i < dim; i++)
     std::fill(vel_glob[i].begin(), vel_glob[i].end(), 0.);
 
@@ -445,192 +634,127 @@ template<int dim, typename Number>
 void
 StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *> & velocity)
 {
-  // Use local vectors xxx_loc in order to average/integrate over all
-  // locally owned cells of current processor.
-  std::vector<double> area_loc(vel_glob[0].size());
+  // complete the previous sample before overwriting the buffer
+  finish_sampling();
 
-  std::vector<std::vector<double>> vel_loc(dim);
-  for(unsigned int i = 0; i < dim; i++)
-    vel_loc[i].resize(vel_glob[0].size());
+  std::fill(buffer_local.begin(), buffer_local.end(), 0.0);
 
-  std::vector<std::vector<double>> velsq_loc(dim);
-  for(unsigned int i = 0; i < dim; i++)
-    velsq_loc[i].resize(vel_glob[0].size());
-
-  std::vector<double> veluv_loc(vel_glob[0].size());
-
-  // use 2d quadrature to integrate over x-z-planes
-  unsigned int const fe_degree = dof_handler.get_fe().degree;
-  QGauss<dim - 1>    gauss_2d(fe_degree + 1);
+  unsigned int const n_points_y_glob = y_glob.size();
+  unsigned int const n_points        = n_points_y_per_cell * n_points_per_plane;
+  unsigned int const n_lanes         = VectorizedArray<double>::size();
+  unsigned int const n_batches       = (n_cells + n_lanes - 1) / n_lanes;
 
-  // vector of FEValues for all x-z-planes of a cell
-  std::vector<std::shared_ptr<FEValues<dim, dim>>> fe_values(n_points_y_per_cell);
+  AlignedVector<VectorizedArray<double>> dof_values(dim * n_dofs_per_cell_scalar);
 
-  // TODO
-  //  MappingQGeneric<dim> mapping(fe_degree);
-  for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+  // loop over all locally owned cells in batches of n_lanes cells and perform integration over
+  // all x-z-planes of these cells
+  for(unsigned int batch = 0; batch < n_batches; ++batch)
   {
-    std::vector<Point<dim>> points(gauss_2d.size());
-    std::vector<double>     weights(gauss_2d.size());
-    for(unsigned int j = 0; j < gauss_2d.size(); ++j)
-    {
-      points[j][0] = gauss_2d.point(j)[0];
-      if(dim == 3)
-        points[j][2] = gauss_2d.point(j)[1];
-      points[j][1] = (double)i / (n_points_y_per_cell - 1);
-      weights[j]   = gauss_2d.weight(j);
-    }
+    unsigned int const n_filled_lanes = std::min(n_lanes, n_cells - batch * n_lanes);
 
-    fe_values[i].reset(
-      new FEValues<dim>(mapping,
-                        dof_handler.get_fe().base_element(0),
-                        Quadrature<dim>(points, weights),
-                        update_values | update_jacobians | update_quadrature_points));
-  }
+    // read dof values of all cells of the current batch
+    for(unsigned int i = 0; i < dim * n_dofs_per_cell_scalar; ++i)
+      dof_values[i] = 0.0;
 
-  unsigned int const scalar_dofs_per_cell = dof_handler.get_fe().base_element(0).dofs_per_cell;
-  // TODO this variable is not used
-  //  std::vector<double> vel_values(fe_values[0]->n_quadrature_points);
-  std::vector<Tensor<1, dim>>          velocity_vector(scalar_dofs_per_cell);
-  std::vector<types::global_dof_index> dof_indices(dof_handler.get_fe().dofs_per_cell);
-
-  // loop over all cells and perform averaging/integration for all locally owned cells
-  for(typename DoFHandler<dim>::active_cell_iterator cell = dof_handler.begin_active();
-      cell != dof_handler.end();
-      ++cell)
-  {
-    if(cell->is_locally_owned())
+    for(unsigned int v = 0; v < n_filled_lanes; ++v)
     {
-      cell->get_dof_indices(dof_indices);
-
-      // vector-valued FE where all components are explicitly listed in the DoFHandler
-      if(dof_handler.get_fe().element_multiplicity(0) >= dim)
+      unsigned int const cell = batch * n_lanes + v;
+      for(unsigned int d = 0; d < dim; ++d)
       {
-        for(unsigned int j = 0; j < dof_indices.size(); ++j)
+        VectorType const & vector = velocity_is_vector_valued ? *velocity[0] : *velocity[d];
+        for(unsigned int j = 0; j < n_dofs_per_cell_scalar; ++j)
         {
-          const std::pair<unsigned int, unsigned int> comp =
-            dof_handler.get_fe().system_to_component_index(j);
-          if(comp.first < dim)
-            velocity_vector[comp.second][comp.first] = (*velocity[0])(dof_indices[j]);
+          unsigned int const index = d * n_dofs_per_cell_scalar + j;
+          dof_values[index][v] = vector(dof_indices[cell * dim * n_dofs_per_cell_scalar + index]);
         }
       }
-      else // scalar FE where we have several vectors referring to the same DoFHandler
-      {
-        AssertDimension(dof_handler.get_fe().element_multiplicity(0), 1);
-        for(unsigned int j = 0; j < scalar_dofs_per_cell; ++j)
-          for(unsigned int d = 0; d < dim; ++d)
-            velocity_vector[j][d] = (*velocity[d])(dof_indices[j]);
-      }
+    }
 
-      // loop over all x-z-planes of current cell
-      for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
-      {
-        fe_values[i]->reinit(typename Triangulation<dim>::active_cell_iterator(cell));
+    // loop over all x-z-planes of the current cells
+    for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+    {
+      Tensor<1, dim, VectorizedArray<double>> vel, velsq;
+      VectorizedArray<double>                 veluv = make_vectorized_array<double>(0.0);
 
-        std::vector<double> vel(dim, 0.);
-        std::vector<double> velsq(dim, 0.);
-        double              area = 0, veluv = 0;
+      // perform integral over current x-z-plane of current cells
+      for(unsigned int q = 0; q < n_points_per_plane; ++q)
+      {
+        unsigned int const point = i * n_points_per_plane + q;
 
-        // perform integral over current x-z-plane of current cell
-        for(unsigned int q = 0; q < fe_values[i]->n_quadrature_points; ++q)
+        // interpolate velocity to the sampling point
+        Tensor<1, dim, VectorizedArray<double>> u;
+        for(unsigned int j = 0; j < n_dofs_per_cell_scalar; ++j)
         {
-          // interpolate velocity to the quadrature point
-          Tensor<1, dim> velocity;
-          for(unsigned int j = 0; j < velocity_vector.size(); ++j)
-            velocity += fe_values[i]->shape_value(j, q) * velocity_vector[j];
-
-          double det = 0.;
-          if(dim == 3)
-          {
-            Tensor<2, 2> reduced_jacobian;
-            reduced_jacobian[0][0] = fe_values[i]->jacobian(q)[0][0];
-            reduced_jacobian[0][1] = fe_values[i]->jacobian(q)[0][2];
-            reduced_jacobian[1][0] = fe_values[i]->jacobian(q)[2][0];
-            reduced_jacobian[1][1] = fe_values[i]->jacobian(q)[2][2];
-            det                    = determinant(reduced_jacobian);
-          }
-          else
-          {
-            det = std::abs(fe_values[i]->jacobian(q)[0][0]);
-          }
-
-          double area_ele = det * fe_values[i]->get_quadrature().weight(q);
-          area += area_ele;
-
-          for(unsigned int i = 0; i < dim; i++)
-            vel[i] += velocity[i] * area_ele;
-
-          for(unsigned int i = 0; i < dim; i++)
-            velsq[i] += velocity[i] * velocity[i] * area_ele;
-
-          veluv += velocity[0] * velocity[1] * area_ele;
+          double const shape_value = shape_values[point * n_dofs_per_cell_scalar + j];
+          for(unsigned int d = 0; d < dim; ++d)
+            u[d] += shape_value * dof_values[d * n_dofs_per_cell_scalar + j];
         }
 
-        // Tranform cell index 'i' to global index 'idx' of y_glob-vector
-
-        // find index within the y-values: first do a binary search to find
-        // the next larger value of y in the list...
-        double const y = fe_values[i]->quadrature_point(0)[1];
-        // std::lower_bound: returns iterator to first element that is >= y.
-        // Note that the vector y_glob has to be sorted. As a result, the
-        // index might be too large.
-        unsigned int idx =
-          std::distance(y_glob.begin(), std::lower_bound(y_glob.begin(), y_glob.end(), y));
-
-        // make sure that the index does not exceed the array bounds in case of round-off errors
-        if(idx == y_glob.size())
-          idx--;
+        VectorizedArray<double> const area_ele = weights[batch * n_points + point];
 
-        // reduce index by 1 in case that the previous point is closer to y than
-        // the next point
-        if(idx > 0 && std::abs(y_glob[idx - 1] - y) < std::abs(y_glob[idx] - y))
-          idx--;
+        for(unsigned int d = 0; d < dim; ++d)
+        {
+          vel[d] += u[d] * area_ele;
+          velsq[d] += u[d] * u[d] * area_ele;
+        }
 
-        AssertThrow(std::abs(y_glob[idx] - y) < 1e-13,
-                    ExcMessage("Could not locate " + std::to_string(y) +
-                               " among pre-evaluated points. Closest point is " +
-                               std::to_string(y_glob[idx]) + " at distance " +
-                               std::to_string(std::abs(y_glob[idx] - y)) +
-                               ". Check transform() function given to constructor."));
+        veluv += u[0] * u[1] * area_ele;
+      }
 
-        // Add results of cellwise integral to xxx_loc vectors since we want
-        // to average/integrate over all locally owned cells.
-        for(unsigned int i = 0; i < dim; i++)
-          vel_loc[i].at(idx) += vel[i];
+      // Add results of cellwise integral to the buffer since we want to average/integrate over
+      // all locally owned cells.
+      for(unsigned int v = 0; v < n_filled_lanes; ++v)
+      {
+        unsigned int const idx = y_index[(batch * n_lanes + v) * n_points_y_per_cell + i];
 
-        for(unsigned int i = 0; i < dim; i++)
-          velsq_loc[i].at(idx) += velsq[i];
+        for(unsigned int d = 0; d < dim; ++d)
+        {
+          buffer_local[d * n_points_y_glob + idx] += vel[d][v];
+          buffer_local[(dim + d) * n_points_y_glob + idx] += velsq[d][v];
+        }
 
-        veluv_loc.at(idx) += veluv;
-        area_loc.at(idx) += area;
+        buffer_local[2 * dim * n_points_y_glob + idx] += veluv[v];
       }
     }
   }
 
-  // accumulate data over all processors overwriting
-  // the processor-local data in xxx_loc since we want
-  // to average/integrate over the global x-z-plane.
-  for(unsigned int i = 0; i < dim; i++)
-    Utilities::MPI::sum(vel_loc[i], communicator, vel_loc[i]);
+  // Accumulate data over all processors since we want to average/integrate over the global
+  // x-z-plane. The reduction is completed in finish_sampling() so that it overlaps with the
+  // next time step.
+  MPI_Iallreduce(buffer_local.data(),
+                 buffer_global.data(),
+                 buffer_local.size(),
+                 MPI_DOUBLE,
+                 MPI_SUM,
+                 communicator,
+                 &request);
+
+  sample_in_flight = true;
+}
 
-  for(unsigned int i = 0; i < dim; i++)
-    Utilities::MPI::sum(velsq_loc[i], communicator, velsq_loc[i]);
+template<int dim, typename Number>
+void
+StatisticsManager<dim, Number>::finish_sampling()
+{
+  if(not(sample_in_flight))
+    return;
+
+  MPI_Wait(&request, MPI_STATUS_IGNORE);
 
-  Utilities::MPI::sum(veluv_loc, communicator, veluv_loc);
-  Utilities::MPI::sum(area_loc, communicator, area_loc);
+  sample_in_flight = false;
 
-  // Add values averaged over global x-z-planes
-  // (=MPI::sum(xxx_loc)/MPI::sum(area_loc)) to xxx_glob vectors.
-  // Averaging over time-samples is performed when writing the output.
-  for(unsigned int idx = 0; idx < y_glob.size(); idx++)
+  // Add values averaged over global x-z-planes (=MPI::sum(xxx_loc)/area_glob) to xxx_glob
+  // vectors. Averaging over time-samples is performed when writing the output.
+  unsigned int const n_points_y_glob = y_glob.size();
+  for(unsigned int idx = 0; idx < n_points_y_glob; idx++)
   {
     for(unsigned int i = 0; i < dim; i++)
-      vel_glob[i].at(idx) += vel_loc[i][idx] / area_loc[idx];
+      vel_glob[i].at(idx) += buffer_global[i * n_points_y_glob + idx] / area_glob[idx];
 
     for(unsigned int i = 0; i < dim; i++)
-      velsq_glob[i].at(idx) += velsq_loc[i][idx] / area_loc[idx];
+      velsq_glob[i].at(idx) += buffer_global[(dim + i) * n_points_y_glob + idx] / area_glob[idx];
 
-    veluv_glob.at(idx) += veluv_loc[idx] / area_loc[idx];
+    veluv_glob.at(idx) += buffer_global[2 * dim * n_points_y_glob + idx] / area_glob[idx];
   }
 
   // increment number of samples
@@ -23,6 +23,8 @@
 #define INCLUDE_EXADG_POSTPROCESSOR_STATISTICS_MANAGER_H_
 
 // deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/vectorization.h>
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
@@ -98,6 +100,8 @@ public:
 
   StatisticsManager(DoFHandler<dim> const & dof_handler_velocity, Mapping<dim> const & mapping);
 
+  ~StatisticsManager();
+
   // The argument grid_transform indicates how the y-direction that is initially distributed from
   // [0,1] is mapped to the actual grid. This must match the transformation applied to the
   // triangulation, otherwise the identification of data will fail
@@ -126,9 +130,15 @@ private:
   static unsigned int const n_points_y_per_cell_linear = 11;
   unsigned int              n_points_y_per_cell;
 
+  void
+  setup_sampling();
+
   void
   do_evaluate(const std::vector<VectorType const *> & velocity);
 
+  void
+  finish_sampling();
+
   DoFHandler<dim> const & dof_handler;
   Mapping<dim> const &    mapping;
   MPI_Comm                communicator;
@@ -145,6 +155,42 @@ private:
   // <u_1*u_2> = <u*v> (for all y-coordinates)
   std::vector<double> veluv_glob;
 
+  // area of the x-z-planes (for all y-coordinates)
+  std::vector<double> area_glob;
+
+  /*
+   * Data precomputed in setup() for the sampling, so that the mapping does not have to be
+   * evaluated at every sample. The locally owned cells are processed in batches of
+   * VectorizedArray<double>::size() cells.
+   */
+
+  // is the velocity described by a single vector of a vector-valued finite element?
+  bool velocity_is_vector_valued;
+
+  unsigned int n_dofs_per_cell_scalar;
+  unsigned int n_points_per_plane;
+  unsigned int n_cells;
+
+  // global dof indices of all locally owned cells, ordered by cells, components, and dofs
+  std::vector<types::global_dof_index> dof_indices;
+
+  // index of the lowest x-z-plane of all locally owned cells in y_glob
+  std::vector<unsigned int> y_index;
+
+  // values of the shape functions in all sampling points, which are the same for all cells
+  std::vector<double> shape_values;
+
+  // integration weights (surface element times quadrature weight) in all sampling points
+  AlignedVector<VectorizedArray<double>> weights;
+
+  // buffers with the processor-local and the global integrals of <u_i>, <u_i²>, <u*v>, which
+  // are reduced by a non-blocking MPI call that completes during the next time step
+  std::vector<double> buffer_local, buffer_global;
+
+  MPI_Request request;
+
+  bool sample_in_flight;
+
   // number of samples
   int number_of_samples;
 
@@ -302,9 +302,26 @@ private:
       timer_local.restart();
 #endif
 
-      // restriction
-      (*matrix)[level]->vmult_interface_down(t[level], solution[level]);
-      t[level].sadd(-1.0, 1.0, defect[level]);
+      // restriction: the residual t = defect - A * solution is computed within the matrix-free
+      // loop of the operator to avoid a separate vector pass
+      {
+        typedef typename VectorType::value_type Number;
+
+        Number * const       t_ptr      = t[level].begin();
+        Number const * const defect_ptr = defect[level].begin();
+
+        (*matrix)[level]->vmult(
+          t[level],
+          solution[level],
+          [&](unsigned int const begin, unsigned int const end) {
+            for(unsigned int i = begin; i < end; ++i)
+              t_ptr[i] = Number(0.0);
+          },
+          [&](unsigned int const begin, unsigned int const end) {
+            for(unsigned int i = begin; i < end; ++i)
+              t_ptr[i] = defect_ptr[i] - t_ptr[i];
+          });
+      }
       transfer.restrict_and_add(level, defect[level - 1], t[level]);
 
 #if ENABLE_TIMING
@@ -318,9 +335,9 @@ private:
       timer_local.restart();
 #endif
 
-      // prolongation
-      transfer.prolongate(level, t[level], solution[level - 1]);
-      solution[level] += t[level];
+      // prolongation (t is only used as auxiliary vector by transfer operators that can not
+      // add the prolongated correction directly to the solution)
+      transfer.prolongate_and_add(level, solution[level], solution[level - 1], t[level]);
 
 #if ENABLE_TIMING
       timings.add(level, "prolong", timer_local.wall_time());
@@ -27,6 +27,7 @@
 
 // ExaDG
 #include <exadg/matrix_free/categorization.h>
+#include <exadg/matrix_free/dof_renumbering.h>
 #include <exadg/operators/operator_base.h>
 #include <exadg/solvers_and_preconditioners/multigrid/constraints.h>
 #include <exadg/solvers_and_preconditioners/multigrid/multigrid_preconditioner_base.h>
@@ -43,10 +44,23 @@ using namespace dealii;
 
 template<int dim, typename Number>
 MultigridPreconditionerBase<dim, Number>::MultigridPreconditionerBase(MPI_Comm const & comm)
-  : mapping(nullptr), n_levels(1), coarse_level(0), fine_level(0), mpi_comm(comm)
+  : mapping(nullptr),
+    n_levels(1),
+    coarse_level(0),
+    fine_level(0),
+    mpi_comm(comm),
+    dof_handler_fine_numbering(nullptr)
 {
 }
 
+template<int dim, typename Number>
+void
+MultigridPreconditionerBase<dim, Number>::set_dof_numbering_fine_level(
+  DoFHandler<dim> const & dof_handler)
+{
+  dof_handler_fine_numbering = &dof_handler;
+}
+
 template<int dim, typename Number>
 void
 MultigridPreconditionerBase<dim, Number>::initialize(MultigridData const &                    data,
@@ -368,6 +382,11 @@ MultigridPreconditionerBase<dim, Number>::do_initialize_dof_handler_and_constrai
 {
   if(!data.use_global_coarsening)
   {
+    AssertThrow(dof_handler_fine_numbering == nullptr,
+                ExcMessage("DoF renumbering is only available for multigrid with "
+                           "use_global_coarsening = true, since the level DoFs "
+                           "can not be renumbered consistently with the active DoFs."));
+
     constrained_dofs.resize(0, this->n_levels - 1);
     dof_handlers.resize(0, this->n_levels - 1);
     constraints.resize(0, this->n_levels - 1);
@@ -449,6 +468,10 @@ MultigridPreconditionerBase<dim, Number>::do_initialize_dof_handler_and_constrai
       else
         dof_handler->distribute_dofs(FESystem<dim>(FE_Q<dim>(level.degree()), n_components));
 
+      // the numbering on the fine level has to match the one of the PDE operator
+      if(dof_handler_fine_numbering != nullptr && i + 1 == level_info.size())
+        copy_dof_numbering(*dof_handler, *dof_handler_fine_numbering);
+
       dof_handlers[i].reset(dof_handler);
 
       auto affine_constraints_own = new AffineConstraints<MultigridNumber>;
@@ -80,6 +80,15 @@ public:
              Map const *                              dirichlet_bc         = nullptr,
              PeriodicFacePairs *                      periodic_face_pairs  = nullptr);
 
+  /*
+   * The vectors of the PDE operator are used directly on the fine level. Hence, if the PDE
+   * operator renumbers its degrees of freedom (see renumber_dofs_for_data_locality()), this
+   * function has to be called with the DoFHandler of the PDE operator before initialize(), so
+   * that the fine level takes over its numbering. Requires use_global_coarsening = true.
+   */
+  void
+  set_dof_numbering_fine_level(DoFHandler<dim> const & dof_handler);
+
   /*
    * This function applies the multigrid preconditioner dst = P^{-1} src.
    */
@@ -265,6 +274,9 @@ private:
 
   MultigridData data;
 
+  // DoFHandler of the PDE operator whose DoF numbering is used on the fine level (optional)
+  DoFHandler<dim> const * dof_handler_fine_numbering;
+
   typedef SmootherBase<VectorTypeMG>       SMOOTHER;
   MGLevelObject<std::shared_ptr<SMOOTHER>> smoothers;
 
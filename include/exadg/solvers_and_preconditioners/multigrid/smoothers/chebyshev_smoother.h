@@ -23,7 +23,8 @@
 #define INCLUDE_SOLVERS_AND_PRECONDITIONERS_CHEBYSHEVSMOOTHER_H_
 
 // deal.II
-#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/solver_cg.h>
 
 // ExaDG
 #include <exadg/solvers_and_preconditioners/multigrid/smoothers/smoother_base.h>
@@ -32,36 +33,246 @@ namespace ExaDG
 {
 using namespace dealii;
 
+/*
+ * Chebyshev smoother with point-Jacobi preconditioner. In contrast to deal.II's
+ * PreconditionChebyshev, the vector updates of the three-term recurrence and the application of the
+ * inverse diagonal are not done in separate vector passes after the matrix-vector product, but are
+ * fused into the matrix-free loop of the operator via operations performed on ranges of DoFs after
+ * all cells touching these DoFs have been processed. Hence, each Chebyshev step reads and writes
+ * the vectors only once.
+ */
 template<typename Operator, typename VectorType>
 class ChebyshevSmoother : public SmootherBase<VectorType>
 {
 public:
-  typedef typename PreconditionChebyshev<Operator, VectorType>::AdditionalData AdditionalData;
+  typedef typename VectorType::value_type Number;
+
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData()
+      : degree(1), smoothing_range(0.), eig_cg_n_iterations(8), max_eigenvalue(1.)
+    {
+    }
+
+    // degree of the Chebyshev polynomial, i.e., number of matrix-vector products per step()
+    unsigned int degree;
+
+    // ratio between the largest eigenvalue and the lower bound of the eigenvalue range that is
+    // smoothed; for values smaller than one, the estimated minimal eigenvalue is used instead
+    double smoothing_range;
+
+    // number of CG iterations used to estimate the eigenvalues; if zero, max_eigenvalue is used
+    unsigned int eig_cg_n_iterations;
 
-  ChebyshevSmoother()
+    // maximum eigenvalue (only used if eig_cg_n_iterations == 0)
+    double max_eigenvalue;
+
+    // point-Jacobi preconditioner, i.e., the inverse diagonal of the operator
+    std::shared_ptr<DiagonalMatrix<VectorType>> preconditioner;
+  };
+
+  ChebyshevSmoother() : underlying_operator(nullptr), theta(1.0), delta(0.0)
+  {
+  }
+
+  void
+  initialize(Operator const & operator_in, AdditionalData const & additional_data_in)
   {
+    underlying_operator = &operator_in;
+    data                = additional_data_in;
+
+    AssertThrow(data.preconditioner.get() != nullptr,
+                ExcMessage("ChebyshevSmoother: preconditioner is not initialized."));
+
+    AssertThrow(data.degree > 0, ExcMessage("Degree of Chebyshev smoother has to be positive."));
+
+    underlying_operator->initialize_dof_vector(solution_old);
+    underlying_operator->initialize_dof_vector(matrix_times_solution);
+
+    double max_eigenvalue = data.max_eigenvalue;
+    double min_eigenvalue = data.max_eigenvalue;
+
+    if(data.eig_cg_n_iterations > 0)
+    {
+      std::pair<double, double> const eigenvalues = estimate_eigenvalues();
+
+      // safety factor since the CG iteration underestimates the largest eigenvalue
+      max_eigenvalue = 1.2 * eigenvalues.second;
+      min_eigenvalue = eigenvalues.first;
+    }
+
+    double const alpha = data.smoothing_range > 1. ?
+                           max_eigenvalue / data.smoothing_range :
+                           std::min(0.9 * max_eigenvalue, min_eigenvalue);
+
+    theta = 0.5 * (max_eigenvalue + alpha);
+    delta = 0.5 * (max_eigenvalue - alpha);
   }
 
+  /*
+   *  Approximately solve linear system of equations (b=src, x=dst) with zero initial guess.
+   */
   void
   vmult(VectorType & dst, VectorType const & src) const
   {
-    smoother_object.vmult(dst, src);
+    // first iteration with x^{0} = 0 does not require a matrix-vector product
+    {
+      Number * const       x        = dst.begin();
+      Number * const       x_old    = solution_old.begin();
+      Number const * const b        = src.begin();
+      Number const * const inv_diag = data.preconditioner->get_vector().begin();
+      Number const         factor   = 1. / theta;
+
+      unsigned int const local_size = dst.local_size();
+      for(unsigned int i = 0; i < local_size; ++i)
+      {
+        x[i]     = factor * inv_diag[i] * b[i];
+        x_old[i] = Number(0.0);
+      }
+    }
+
+    iterate(dst, src, data.degree - 1);
   }
 
+  /*
+   *  Approximately solve linear system of equations (b=src, x=dst) with dst as initial guess.
+   */
   void
   step(VectorType & dst, VectorType const & src) const
   {
-    smoother_object.step(dst, src);
+    do_iteration(dst, src, 0.0, 1. / theta);
+
+    iterate(dst, src, data.degree - 1);
+  }
+
+private:
+  /*
+   *  Chebyshev iterations k = 1, ..., n_iterations. The first iteration has already been performed
+   *  so that dst contains x^{1} and solution_old contains x^{0}.
+   */
+  void
+  iterate(VectorType & dst, VectorType const & src, unsigned int const n_iterations) const
+  {
+    // if delta is zero, the updates are zero and we do not have to iterate
+    if(std::abs(delta) < 1e-40)
+      return;
+
+    double const sigma = theta / delta;
+    double       rhok  = delta / theta;
+
+    for(unsigned int k = 0; k < n_iterations; ++k)
+    {
+      double const rhokp   = 1. / (2. * sigma - rhok);
+      double const factor1 = rhokp * rhok;
+      double const factor2 = 2. * rhokp / delta;
+      rhok                 = rhokp;
+
+      do_iteration(dst, src, factor1, factor2);
+    }
   }
 
+  /*
+   *  Performs the iteration
+   *
+   *    x^{k+1} = x^{k} + factor1 * (x^{k} - x^{k-1}) + factor2 * D^{-1} * (b - A * x^{k})
+   *
+   *  where the vector update is done within the matrix-free loop computing A * x^{k}, once the
+   *  loop does not access the respective DoFs any more. On entry, solution contains x^{k} and
+   *  solution_old contains x^{k-1}. On exit, solution contains x^{k+1} and solution_old contains
+   *  x^{k}. For factor1 = 0, x^{k-1} is not accessed.
+   */
   void
-  initialize(Operator const & matrix, AdditionalData const & additional_data)
+  do_iteration(VectorType &       solution,
+               VectorType const & rhs,
+               double const       factor1,
+               double const       factor2) const
   {
-    smoother_object.initialize(matrix, additional_data);
+    Number const * const x        = solution.begin();
+    Number * const       x_old    = solution_old.begin();
+    Number const * const b        = rhs.begin();
+    Number * const       ax       = matrix_times_solution.begin();
+    Number const * const inv_diag = data.preconditioner->get_vector().begin();
+
+    Number const f1 = factor1;
+    Number const f2 = factor2;
+
+    underlying_operator->vmult(
+      matrix_times_solution,
+      solution,
+      [&](unsigned int const begin, unsigned int const end) {
+        for(unsigned int i = begin; i < end; ++i)
+          ax[i] = Number(0.0);
+      },
+      [&](unsigned int const begin, unsigned int const end) {
+        if(factor1 == 0.0)
+        {
+          for(unsigned int i = begin; i < end; ++i)
+            x_old[i] = x[i] + f2 * inv_diag[i] * (b[i] - ax[i]);
+        }
+        else
+        {
+          for(unsigned int i = begin; i < end; ++i)
+            x_old[i] = x[i] + f1 * (x[i] - x_old[i]) + f2 * inv_diag[i] * (b[i] - ax[i]);
+        }
+      });
+
+    solution.swap(solution_old);
   }
 
-private:
-  PreconditionChebyshev<Operator, VectorType> smoother_object;
+  /*
+   *  Estimate the extremal eigenvalues of the Jacobi-preconditioned operator by a few CG
+   *  iterations.
+   */
+  std::pair<double, double>
+  estimate_eigenvalues() const
+  {
+    VectorType solution, rhs;
+    underlying_operator->initialize_dof_vector(solution);
+    underlying_operator->initialize_dof_vector(rhs);
+
+    // deterministic right-hand side with zero mean value to also handle singular operators
+    for(unsigned int i = 0; i < rhs.local_size(); ++i)
+      rhs.local_element(i) = (i + rhs.get_partitioner()->local_range().first) % 11;
+    rhs.add(-rhs.mean_value());
+
+    SolverControl control(data.eig_cg_n_iterations, rhs.l2_norm() * 1e-5, false, false);
+
+    std::vector<double> eigenvalues_cg;
+
+    SolverCG<VectorType> solver(control);
+    solver.connect_eigenvalues_slot(
+      [&eigenvalues_cg](std::vector<double> const & values) { eigenvalues_cg = values; });
+
+    try
+    {
+      solver.solve(*underlying_operator, solution, rhs, *data.preconditioner);
+    }
+    catch(SolverControl::NoConvergence &)
+    {
+    }
+
+    std::pair<double, double> eigenvalues(1., 1.);
+    if(!eigenvalues_cg.empty())
+    {
+      eigenvalues.first  = eigenvalues_cg.front();
+      eigenvalues.second = eigenvalues_cg.back();
+    }
+
+    return eigenvalues;
+  }
+
+  Operator const * underlying_operator;
+
+  AdditionalData data;
+
+  // center and half-width of the eigenvalue interval
+  double theta, delta;
+
+  mutable VectorType solution_old;
+  mutable VectorType matrix_times_solution;
 };
 
 } // namespace ExaDG
@@ -40,6 +40,22 @@ public:
 
   virtual void
   prolongate(unsigned int const level, VectorType & dst, VectorType const & src) const = 0;
+
+  /*
+   * Prolongates src and adds the result to dst. The default implementation writes the prolongated
+   * vector into the auxiliary vector tmp and adds it to dst in a separate vector pass. Transfer
+   * operators that allow a cell-local implementation override this function and add the
+   * prolongated values directly to dst within the same loop.
+   */
+  virtual void
+  prolongate_and_add(unsigned int const level,
+                     VectorType &       dst,
+                     VectorType const & src,
+                     VectorType &       tmp) const
+  {
+    prolongate(level, tmp, src);
+    dst += tmp;
+  }
 };
 } // namespace ExaDG
 
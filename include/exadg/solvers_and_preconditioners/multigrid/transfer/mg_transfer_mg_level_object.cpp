@@ -205,6 +205,16 @@ MGTransfer_MGLevelObject<dim, Number, VectorType>::prolongate(unsigned int const
   this->mg_level_object[level]->prolongate(level, dst, src);
 }
 
+template<int dim, typename Number, typename VectorType>
+void
+MGTransfer_MGLevelObject<dim, Number, VectorType>::prolongate_and_add(unsigned int const level,
+                                                                      VectorType &       dst,
+                                                                      VectorType const & src,
+                                                                      VectorType &       tmp) const
+{
+  this->mg_level_object[level]->prolongate_and_add(level, dst, src, tmp);
+}
+
 typedef dealii::LinearAlgebra::distributed::Vector<float>  VectorTypeFloat;
 typedef dealii::LinearAlgebra::distributed::Vector<double> VectorTypeDouble;
 
@@ -59,6 +59,12 @@ public:
   virtual void
   prolongate(unsigned int const level, VectorType & dst, VectorType const & src) const;
 
+  virtual void
+  prolongate_and_add(unsigned int const level,
+                     VectorType &       dst,
+                     VectorType const & src,
+                     VectorType &       tmp) const;
+
 private:
   MGLevelObject<std::shared_ptr<MGTransfer<VectorType>>> mg_level_object;
 };
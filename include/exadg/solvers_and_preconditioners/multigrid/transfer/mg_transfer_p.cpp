@@ -265,7 +265,8 @@ template<int dim, typename Number, typename VectorType, int components>
 template<int fe_degree_1, int fe_degree_2>
 void
 MGTransferP<dim, Number, VectorType, components>::do_prolongate(VectorType &       dst,
-                                                                VectorType const & src) const
+                                                                VectorType const & src,
+                                                                bool const         add_to_dst) const
 {
   FEEvaluation<dim, fe_degree_1, fe_degree_1 + 1, components, Number> fe_eval1(*matrixfree_1,
                                                                                dof_handler_index,
@@ -295,7 +296,12 @@ MGTransferP<dim, Number, VectorType, components>::do_prolongate(VectorType &
 
     if(is_dg)
     {
-      fe_eval1.set_dof_values(dst);
+      // for DG, each DoF belongs to exactly one cell, so that distribute_local_to_global() adds
+      // the prolongated values to dst
+      if(add_to_dst)
+        fe_eval1.distribute_local_to_global(dst);
+      else
+        fe_eval1.set_dof_values(dst);
     }
     else
     {
@@ -580,70 +586,93 @@ MGTransferP<dim, Number, VectorType, components>::prolongate(unsigned int const
     src.update_ghost_values();
   }
 
+  do_prolongate_dispatch(dst, src, false);
+
+  if(!this->is_dg) // only if CG
+    dst.compress(VectorOperation::add);
+}
+
+template<int dim, typename Number, typename VectorType, int components>
+void
+MGTransferP<dim, Number, VectorType, components>::prolongate_and_add(unsigned int const level,
+                                                                     VectorType &       dst,
+                                                                     VectorType const & src,
+                                                                     VectorType &       tmp) const
+{
+  if(this->is_dg)
+    do_prolongate_dispatch(dst, src, true);
+  else
+    MGTransfer<VectorType>::prolongate_and_add(level, dst, src, tmp);
+}
+
+template<int dim, typename Number, typename VectorType, int components>
+void
+MGTransferP<dim, Number, VectorType, components>::do_prolongate_dispatch(
+  VectorType &       dst,
+  VectorType const & src,
+  bool const         add_to_dst) const
+{
   // clang-format off
   switch(this->degree_1*100+this->degree_2)
   {
     // degree  2
-    case  201: do_prolongate< 2, 1>(dst, src); break;
+    case  201: do_prolongate< 2, 1>(dst, src, add_to_dst); break;
     // degree  3
-    case  301: do_prolongate< 3, 1>(dst, src); break;
-    case  302: do_prolongate< 3, 2>(dst, src); break;
+    case  301: do_prolongate< 3, 1>(dst, src, add_to_dst); break;
+    case  302: do_prolongate< 3, 2>(dst, src, add_to_dst); break;
     // degree  4
-    case  401: do_prolongate< 4, 1>(dst, src); break;
-    case  402: do_prolongate< 4, 2>(dst, src); break;
-    case  403: do_prolongate< 4, 3>(dst, src); break;
+    case  401: do_prolongate< 4, 1>(dst, src, add_to_dst); break;
+    case  402: do_prolongate< 4, 2>(dst, src, add_to_dst); break;
+    case  403: do_prolongate< 4, 3>(dst, src, add_to_dst); break;
     // degree  5
-    case  501: do_prolongate< 5, 1>(dst, src); break;
-    case  502: do_prolongate< 5, 2>(dst, src); break;
-    case  504: do_prolongate< 5, 4>(dst, src); break;
+    case  501: do_prolongate< 5, 1>(dst, src, add_to_dst); break;
+    case  502: do_prolongate< 5, 2>(dst, src, add_to_dst); break;
+    case  504: do_prolongate< 5, 4>(dst, src, add_to_dst); break;
     // degree  6
-    case  601: do_prolongate< 6, 1>(dst, src); break;
-    case  603: do_prolongate< 6, 3>(dst, src); break;
-    case  605: do_prolongate< 6, 5>(dst, src); break;
+    case  601: do_prolongate< 6, 1>(dst, src, add_to_dst); break;
+    case  603: do_prolongate< 6, 3>(dst, src, add_to_dst); break;
+    case  605: do_prolongate< 6, 5>(dst, src, add_to_dst); break;
     // degree  7
-    case  701: do_prolongate< 7, 1>(dst, src); break;
-    case  703: do_prolongate< 7, 3>(dst, src); break;
-    case  706: do_prolongate< 7, 6>(dst, src); break;
+    case  701: do_prolongate< 7, 1>(dst, src, add_to_dst); break;
+    case  703: do_prolongate< 7, 3>(dst, src, add_to_dst); break;
+    case  706: do_prolongate< 7, 6>(dst, src, add_to_dst); break;
     // degree  8
-    case  801: do_prolongate< 8, 1>(dst, src); break;
-    case  804: do_prolongate< 8, 4>(dst, src); break;
-    case  807: do_prolongate< 8, 7>(dst, src); break;
+    case  801: do_prolongate< 8, 1>(dst, src, add_to_dst); break;
+    case  804: do_prolongate< 8, 4>(dst, src, add_to_dst); break;
+    case  807: do_prolongate< 8, 7>(dst, src, add_to_dst); break;
     // degree  9
-    case  901: do_prolongate< 9, 1>(dst, src); break;
-    case  904: do_prolongate< 9, 4>(dst, src); break;
-    case  908: do_prolongate< 9, 8>(dst, src); break;
+    case  901: do_prolongate< 9, 1>(dst, src, add_to_dst); break;
+    case  904: do_prolongate< 9, 4>(dst, src, add_to_dst); break;
+    case  908: do_prolongate< 9, 8>(dst, src, add_to_dst); break;
     // degree 10
-    case 1001: do_prolongate<10, 1>(dst, src); break;
-    case 1005: do_prolongate<10, 5>(dst, src); break;
-    case 1009: do_prolongate<10, 9>(dst, src); break;
+    case 1001: do_prolongate<10, 1>(dst, src, add_to_dst); break;
+    case 1005: do_prolongate<10, 5>(dst, src, add_to_dst); break;
+    case 1009: do_prolongate<10, 9>(dst, src, add_to_dst); break;
     // degree 11
-    case 1101: do_prolongate<11, 1>(dst, src); break;
-    case 1105: do_prolongate<11, 5>(dst, src); break;
-    case 1110: do_prolongate<11,10>(dst, src); break;
+    case 1101: do_prolongate<11, 1>(dst, src, add_to_dst); break;
+    case 1105: do_prolongate<11, 5>(dst, src, add_to_dst); break;
+    case 1110: do_prolongate<11,10>(dst, src, add_to_dst); break;
     // degree 12
-    case 1201: do_prolongate<12, 1>(dst, src); break;
-    case 1206: do_prolongate<12, 6>(dst, src); break;
-    case 1211: do_prolongate<12,11>(dst, src); break;
+    case 1201: do_prolongate<12, 1>(dst, src, add_to_dst); break;
+    case 1206: do_prolongate<12, 6>(dst, src, add_to_dst); break;
+    case 1211: do_prolongate<12,11>(dst, src, add_to_dst); break;
     // degree 13
-    case 1301: do_prolongate<13, 1>(dst, src); break;
-    case 1306: do_prolongate<13, 6>(dst, src); break;
-    case 1312: do_prolongate<13,12>(dst, src); break;
+    case 1301: do_prolongate<13, 1>(dst, src, add_to_dst); break;
+    case 1306: do_prolongate<13, 6>(dst, src, add_to_dst); break;
+    case 1312: do_prolongate<13,12>(dst, src, add_to_dst); break;
     // degree 14
-    case 1401: do_prolongate<14, 1>(dst, src); break;
-    case 1407: do_prolongate<14, 7>(dst, src); break;
-    case 1413: do_prolongate<14,13>(dst, src); break;
+    case 1401: do_prolongate<14, 1>(dst, src, add_to_dst); break;
+    case 1407: do_prolongate<14, 7>(dst, src, add_to_dst); break;
+    case 1413: do_prolongate<14,13>(dst, src, add_to_dst); break;
     // degree 15
-    case 1501: do_prolongate<15, 1>(dst, src); break;
-    case 1507: do_prolongate<15, 7>(dst, src); break;
-    case 1514: do_prolongate<15,14>(dst, src); break;
+    case 1501: do_prolongate<15, 1>(dst, src, add_to_dst); break;
+    case 1507: do_prolongate<15, 7>(dst, src, add_to_dst); break;
+    case 1514: do_prolongate<15,14>(dst, src, add_to_dst); break;
     // error:
     default:
       AssertThrow(false, ExcMessage("MGTransferP::prolongate() not implemented for this degree combination!"));
   }
   // clang-format on
-
-  if(!this->is_dg) // only if CG
-    dst.compress(VectorOperation::add);
 }
 
 
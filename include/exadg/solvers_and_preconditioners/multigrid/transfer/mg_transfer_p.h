@@ -64,7 +64,20 @@ public:
   virtual void
   prolongate(unsigned int const /*level*/, VectorType & dst, VectorType const & src) const;
 
+  /*
+   * For DG, the prolongated values are added to dst cell by cell so that neither an auxiliary
+   * vector nor an additional vector pass is needed.
+   */
+  virtual void
+  prolongate_and_add(unsigned int const level,
+                     VectorType &       dst,
+                     VectorType const & src,
+                     VectorType &       tmp) const;
+
 private:
+  void
+  do_prolongate_dispatch(VectorType & dst, VectorType const & src, bool const add_to_dst) const;
+
   template<int fe_degree_1, int fe_degree_2>
   void
   do_interpolate(VectorType & dst, VectorType const & src) const;
@@ -75,7 +88,7 @@ private:
 
   template<int fe_degree_1, int fe_degree_2>
   void
-  do_prolongate(VectorType & dst, VectorType const & src) const;
+  do_prolongate(VectorType & dst, VectorType const & src, bool const add_to_dst) const;
 
   MatrixFree<dim, value_type> const *    matrixfree_1;
   MatrixFree<dim, value_type> const *    matrixfree_2;
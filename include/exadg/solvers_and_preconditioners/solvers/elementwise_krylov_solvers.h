@@ -115,6 +115,28 @@ converged(VectorizedArray<Number> & is_converged,
   return all_true(is_converged);
 }
 
+/*
+ * Sets x to zero for those entries that have already converged (is_converged > 0). This is used to
+ * freeze the iterates of converged components of a VectorizedArray while the iteration continues
+ * for the remaining components.
+ */
+template<typename Number>
+void
+set_zero_if_converged(Number & x, Number const is_converged)
+{
+  if(is_converged > 0.0)
+    x = 0.0;
+}
+
+template<typename Number>
+void
+set_zero_if_converged(VectorizedArray<Number> & x, VectorizedArray<Number> const is_converged)
+{
+  for(unsigned int v = 0; v < VectorizedArray<Number>::size(); ++v)
+    if(is_converged[v] > 0.0)
+      x[v] = 0.0;
+}
+
 template<typename Number>
 void
 adjust_division_by_zero(Number &)
@@ -247,6 +269,10 @@ private:
   unsigned int const        MAX_ITER;
   AlignedVector<value_type> storage;
   value_type *              p, *r, *v;
+
+  // convergence status of the individual components of a VectorizedArray, which are checked
+  // separately so that converged components are no longer updated (negative values = false)
+  value_type convergence_status;
 };
 
 /*
@@ -264,6 +290,9 @@ SolverCG<value_type, Matrix, Preconditioner>::SolverCG(unsigned int const unknow
   p = storage.begin();
   r = storage.begin() + M;
   v = storage.begin() + 2 * M;
+
+  // negative values = false (not converged)
+  convergence_status = -1.0;
 }
 
 template<typename value_type, typename Matrix, typename Preconditioner>
@@ -298,6 +327,11 @@ SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matri
 
   unsigned int n_iter = 0;
 
+  // components with zero right-hand side (e.g. unused lanes of a cell batch) have converged
+  // already before the first iteration
+  if(converged(convergence_status, norm_r_abs, ABS_TOL, norm_r_rel, REL_TOL, n_iter, MAX_ITER))
+    return;
+
   while(true)
   {
     // v = A*p
@@ -310,6 +344,9 @@ SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matri
     // alpha = (r^T*y) / (p^T*v)
     value_type alpha = (r_times_y) / (p_times_v);
 
+    // do not update components that have already converged
+    set_zero_if_converged(alpha, convergence_status);
+
     // solution <- solution + alpha*p
     add(solution, alpha, p, M);
 
@@ -323,8 +360,9 @@ SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matri
     // increment iteration counter
     ++n_iter;
 
-    // check convergence
-    if(all_smaller(norm_r_abs, ABS_TOL) || all_smaller(norm_r_rel, REL_TOL) || (n_iter > MAX_ITER))
+    // check convergence separately for each component, the iteration terminates once all
+    // components have converged
+    if(converged(convergence_status, norm_r_abs, ABS_TOL, norm_r_rel, REL_TOL, n_iter, MAX_ITER))
     {
       break;
     }
@@ -338,15 +376,15 @@ SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matri
     value_type r_times_y_new = inner_product(r, v, M);
 
     // beta = (r^T*y)_new / (r^T*y)
+    adjust_division_by_zero(r_times_y);
     value_type beta = r_times_y_new / r_times_y;
+    set_zero_if_converged(beta, convergence_status);
 
     // p <- y + beta*p
     equ(p, one, v, beta, p, M);
 
     r_times_y = r_times_y_new;
   }
-
-  //    std::cout<<"Number of iterations = "<< n_iter << std::endl;
 }
 
 
@@ -100,20 +100,24 @@ private:
 
     AlignedVector<VectorizedArray<Number>> solution(dofs_per_cell);
 
-    // setup elementwise solver
-    if(iterative_solver_data.solver_type == Solver::CG)
+    // setup elementwise solver (only once since the problem size is the same for all cells)
+    if(solver.get() == nullptr)
     {
-      solver.reset(new Elementwise::SolverCG<VectorizedArray<Number>, Operator, Preconditioner>(
-        dofs_per_cell, iterative_solver_data.solver_data));
-    }
-    else if(iterative_solver_data.solver_type == Solver::GMRES)
-    {
-      solver.reset(new Elementwise::SolverGMRES<VectorizedArray<Number>, Operator, Preconditioner>(
-        dofs_per_cell, iterative_solver_data.solver_data));
-    }
-    else
-    {
-      AssertThrow(false, ExcMessage("Not implemented."));
+      if(iterative_solver_data.solver_type == Solver::CG)
+      {
+        solver.reset(new Elementwise::SolverCG<VectorizedArray<Number>, Operator, Preconditioner>(
+          dofs_per_cell, iterative_solver_data.solver_data));
+      }
+      else if(iterative_solver_data.solver_type == Solver::GMRES)
+      {
+        solver.reset(
+          new Elementwise::SolverGMRES<VectorizedArray<Number>, Operator, Preconditioner>(
+            dofs_per_cell, iterative_solver_data.solver_data));
+      }
+      else
+      {
+        AssertThrow(false, ExcMessage("Not implemented."));
+      }
     }
 
     // loop over all cells and solve local problem iteratively on each cell
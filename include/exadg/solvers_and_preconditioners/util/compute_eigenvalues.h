@@ -22,6 +22,10 @@
 #ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_UTIL_COMPUTE_EIGENVALUES_H_
 #define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_UTIL_COMPUTE_EIGENVALUES_H_
 
+// deal.II
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+
 namespace ExaDG
 {
 using namespace dealii;
@@ -24,6 +24,7 @@
 #include <deal.II/numerics/vector_tools.h>
 
 // ExaDG
+#include <exadg/matrix_free/dof_renumbering.h>
 #include <exadg/solvers_and_preconditioners/preconditioner/jacobi_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioner/preconditioner_amg.h>
 #include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
@@ -93,6 +94,21 @@ Operator<dim, Number>::distribute_dofs()
   dof_handler.distribute_dofs(fe);
   dof_handler.distribute_mg_dofs();
 
+  initialize_affine_constraints();
+
+  pcout << std::endl
+        << "Continuous Galerkin finite element discretization:" << std::endl
+        << std::endl;
+
+  print_parameter(pcout, "degree of 1D polynomials", degree);
+  print_parameter(pcout, "number of dofs per cell", Utilities::pow(degree + 1, dim));
+  print_parameter(pcout, "number of dofs (total)", dof_handler.n_dofs());
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::initialize_affine_constraints()
+{
   // affine constraints
   affine_constraints.clear();
 
@@ -117,14 +133,16 @@ Operator<dim, Number>::distribute_dofs()
   // no constraints for mass operator
   constraints_mass.clear();
   constraints_mass.close();
+}
 
-  pcout << std::endl
-        << "Continuous Galerkin finite element discretization:" << std::endl
-        << std::endl;
+template<int dim, typename Number>
+void
+Operator<dim, Number>::renumber_dofs(MatrixFreeData<dim, Number> const & matrix_free_data)
+{
+  renumber_dofs_for_data_locality(dof_handler, affine_constraints, matrix_free_data.data);
 
-  print_parameter(pcout, "degree of 1D polynomials", degree);
-  print_parameter(pcout, "number of dofs per cell", Utilities::pow(degree + 1, dim));
-  print_parameter(pcout, "number of dofs (total)", dof_handler.n_dofs());
+  // the constraints refer to the DoF numbering
+  initialize_affine_constraints();
 }
 
 template<int dim, typename Number>
@@ -351,6 +369,9 @@ Operator<dim, Number>::initialize_preconditioner()
       std::shared_ptr<Multigrid> mg_preconditioner =
         std::dynamic_pointer_cast<Multigrid>(preconditioner);
 
+      if(param.use_dof_renumbering)
+        mg_preconditioner->set_dof_numbering_fine_level(dof_handler);
+
       mg_preconditioner->initialize(param.multigrid_data,
                                     tria,
                                     fe,
@@ -368,6 +389,9 @@ Operator<dim, Number>::initialize_preconditioner()
       std::shared_ptr<Multigrid> mg_preconditioner =
         std::dynamic_pointer_cast<Multigrid>(preconditioner);
 
+      if(param.use_dof_renumbering)
+        mg_preconditioner->set_dof_numbering_fine_level(dof_handler);
+
       mg_preconditioner->initialize(param.multigrid_data,
                                     tria,
                                     fe,
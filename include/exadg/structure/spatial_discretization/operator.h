@@ -190,6 +190,14 @@ public:
   void
   fill_matrix_free_data(MatrixFreeData<dim, Number> & matrix_free_data) const;
 
+  /*
+   * Renumbers the degrees of freedom for data locality in the matrix-free loops set up with
+   * matrix_free_data (parameter use_dof_renumbering). Has to be called after
+   * fill_matrix_free_data() and before MatrixFree is initialized.
+   */
+  void
+  renumber_dofs(MatrixFreeData<dim, Number> const & matrix_free_data);
+
   /*
    * Setup function. Initializes basic operators. This function does not perform the setup
    * related to the solution of linear systems of equations.
@@ -320,6 +328,12 @@ private:
   void
   distribute_dofs();
 
+  /*
+   * Initializes the constraints (Dirichlet boundary conditions).
+   */
+  void
+  initialize_affine_constraints();
+
   std::string
   get_dof_name() const;
 
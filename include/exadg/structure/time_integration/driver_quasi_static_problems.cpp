@@ -45,6 +45,7 @@ DriverQuasiStatic<dim, Number>::DriverQuasiStatic(
     print_wall_times(print_wall_times_in),
     pcout(std::cout, Utilities::MPI::this_mpi_process(mpi_comm_in) == 0),
     step_number(1),
+    n_history(0),
     timer_tree(new TimerTree()),
     iterations({0, {0, 0}})
 {
@@ -126,10 +127,14 @@ DriverQuasiStatic<dim, Number>::solve()
 
   pcout << std::endl << "Solving quasi-static problem ..." << std::endl << std::flush;
 
-  // perform time loop
+  // perform load steps
   double       load_factor    = 0.0;
   double       load_increment = param.load_increment;
   double const eps            = 1.e-10;
+
+  // the initial solution is the first entry of the history of converged solutions
+  update_history(load_factor);
+
   while(load_factor < 1.0 - eps)
   {
     std::tuple<unsigned int, unsigned int> iter;
@@ -139,19 +144,22 @@ DriverQuasiStatic<dim, Number>::solve()
     {
       // reduce load increment in factors of 2 until the current
       // step can be solved successfully
-      bool         success        = false;
-      unsigned int re_try_counter = 0;
-      while(!success && re_try_counter < 10)
+      bool success = false;
+      while(!success)
       {
         try
         {
           iter    = solve_step(load_factor + load_increment);
           success = true;
-          ++re_try_counter;
         }
         catch(...)
         {
           load_increment *= 0.5;
+
+          AssertThrow(
+            load_increment >= param.min_load_increment,
+            ExcMessage("Could not solve non-linear problem with minimum load increment."));
+
           pcout << std::endl
                 << "Could not solve non-linear problem. Reduce load factor to "
                 << load_factor + load_increment << std::flush;
@@ -171,12 +179,18 @@ DriverQuasiStatic<dim, Number>::solve()
     load_factor += load_increment;
     ++step_number;
 
-    // adjust increment for next load step
+    update_history(load_factor);
+
+    // adjust increment for next load step: increase the load increment if less Newton
+    // iterations than desired were needed and decrease it otherwise
     if(param.adjust_load_increment)
     {
+      double factor = param.max_load_increment_growth;
       if(std::get<0>(iter) > 0)
-        load_increment *=
+        factor =
           std::pow((double)param.desired_newton_iterations / (double)std::get<0>(iter), 0.5);
+
+      load_increment *= std::min(factor, param.max_load_increment_growth);
     }
 
     // make sure to hit maximum load exactly
@@ -196,6 +210,18 @@ DriverQuasiStatic<dim, Number>::initialize_vectors()
   // solution
   pde_operator->initialize_dof_vector(solution);
 
+  // history of converged solutions (one more than the order of the predictor)
+  unsigned int order = 0;
+  if(param.load_predictor == LoadPredictor::Linear)
+    order = 1;
+  else if(param.load_predictor == LoadPredictor::Quadratic)
+    order = 2;
+
+  solution_history.resize(order + 1);
+  for(auto & vector : solution_history)
+    pde_operator->initialize_dof_vector(vector);
+  load_factor_history.resize(order + 1);
+
   // rhs_vector
   pde_operator->initialize_dof_vector(rhs_vector);
 }
@@ -207,6 +233,42 @@ DriverQuasiStatic<dim, Number>::initialize_solution()
   pde_operator->prescribe_initial_displacement(solution, 0.0 /* time */);
 }
 
+template<int dim, typename Number>
+void
+DriverQuasiStatic<dim, Number>::update_history(double const load_factor)
+{
+  for(unsigned int i = solution_history.size() - 1; i > 0; --i)
+  {
+    solution_history[i].swap(solution_history[i - 1]);
+    load_factor_history[i] = load_factor_history[i - 1];
+  }
+
+  solution_history[0]    = solution;
+  load_factor_history[0] = load_factor;
+
+  n_history = std::min(n_history + 1, (unsigned int)solution_history.size());
+}
+
+template<int dim, typename Number>
+void
+DriverQuasiStatic<dim, Number>::predict_solution(double const load_factor)
+{
+  // Lagrange extrapolation in the load factor using all available previous solutions
+  solution = 0.0;
+  for(unsigned int i = 0; i < n_history; ++i)
+  {
+    double weight = 1.0;
+    for(unsigned int j = 0; j < n_history; ++j)
+    {
+      if(j != i)
+        weight *= (load_factor - load_factor_history[j]) /
+                  (load_factor_history[i] - load_factor_history[j]);
+    }
+
+    solution.add(weight, solution_history[i]);
+  }
+}
+
 template<int dim, typename Number>
 void
 DriverQuasiStatic<dim, Number>::output_solver_info_header(double const load_factor)
@@ -228,6 +290,9 @@ DriverQuasiStatic<dim, Number>::solve_step(double const load_factor)
 
   output_solver_info_header(load_factor);
 
+  // initial guess (also resets the solution after unsuccessful attempts)
+  predict_solution(load_factor);
+
   VectorType const const_vector;
 
   bool const update_preconditioner =
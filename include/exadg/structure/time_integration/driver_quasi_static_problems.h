@@ -82,6 +82,18 @@ private:
   void
   solve();
 
+  /*
+   * Stores the converged solution for the given load factor in the history of solutions.
+   */
+  void
+  update_history(double const load_factor);
+
+  /*
+   * Computes the initial guess for the given load factor by extrapolation of previous solutions.
+   */
+  void
+  predict_solution(double const load_factor);
+
   void
   output_solver_info_header(double const load_factor);
 
@@ -107,6 +119,11 @@ private:
   VectorType solution;
   VectorType rhs_vector;
 
+  // converged solutions of previous load steps (most recent first) used by the predictor
+  std::vector<VectorType> solution_history;
+  std::vector<double>     load_factor_history;
+  unsigned int            n_history;
+
   unsigned int step_number;
 
   std::shared_ptr<TimerTree> timer_tree;
@@ -145,9 +145,19 @@ TimeIntGenAlpha<dim, Number>::solve_timestep()
 
   // initial guess
   if(use_extrapolation)
-    displacement_np = displacement_n;
+  {
+    unsigned int order = 0;
+    if(param.gen_alpha_predictor == GenAlphaPredictor::ConstantVelocity)
+      order = 1;
+    else if(param.gen_alpha_predictor == GenAlphaPredictor::ConstantAcceleration)
+      order = 2;
+
+    this->predict_displacement(displacement_np, order, displacement_n, velocity_n, acceleration_n);
+  }
   else
+  {
     displacement_np = displacement_last_iter;
+  }
 
   if(param.large_deformation) // nonlinear case
   {
@@ -268,17 +278,17 @@ TimeIntGenAlpha<dim, Number>::prepare_vectors_for_next_timestep()
 
 template<int dim, typename Number>
 void
-TimeIntGenAlpha<dim, Number>::do_write_restart(std::string const & filename) const
+TimeIntGenAlpha<dim, Number>::do_write_restart(RestartArchiveOut & archive) const
 {
-  (void)filename;
+  (void)archive;
   AssertThrow(false, ExcMessage("Restart has not been implemented for Structure."));
 }
 
 template<int dim, typename Number>
 void
-TimeIntGenAlpha<dim, Number>::do_read_restart(std::ifstream & in)
+TimeIntGenAlpha<dim, Number>::do_read_restart(RestartArchiveIn & archive)
 {
-  (void)in;
+  (void)archive;
   AssertThrow(false, ExcMessage("Restart has not been implemented for Structure."));
 }
 
@@ -98,10 +98,10 @@ private:
   prepare_vectors_for_next_timestep() override;
 
   void
-  do_write_restart(std::string const & filename) const override;
+  do_write_restart(RestartArchiveOut & archive) const override;
 
   void
-  do_read_restart(std::ifstream & in) override;
+  do_read_restart(RestartArchiveIn & archive) override;
 
   void
   postprocessing() const override;
@@ -126,7 +126,53 @@ enum_to_string(MaterialType const enum_type)
 /*                                                                                    */
 /**************************************************************************************/
 
-// there are currently no enums for this section
+std::string
+enum_to_string(GenAlphaPredictor const enum_type)
+{
+  std::string string_type;
+
+  switch(enum_type)
+  {
+    case GenAlphaPredictor::Constant:
+      string_type = "Constant";
+      break;
+    case GenAlphaPredictor::ConstantVelocity:
+      string_type = "ConstantVelocity";
+      break;
+    case GenAlphaPredictor::ConstantAcceleration:
+      string_type = "ConstantAcceleration";
+      break;
+    default:
+      AssertThrow(false, ExcMessage("Not implemented."));
+      break;
+  }
+
+  return string_type;
+}
+
+std::string
+enum_to_string(LoadPredictor const enum_type)
+{
+  std::string string_type;
+
+  switch(enum_type)
+  {
+    case LoadPredictor::Constant:
+      string_type = "Constant";
+      break;
+    case LoadPredictor::Linear:
+      string_type = "Linear";
+      break;
+    case LoadPredictor::Quadratic:
+      string_type = "Quadratic";
+      break;
+    default:
+      AssertThrow(false, ExcMessage("Not implemented."));
+      break;
+  }
+
+  return string_type;
+}
 
 
 
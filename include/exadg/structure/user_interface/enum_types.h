@@ -86,7 +86,41 @@ enum_to_string(MaterialType const enum_type);
 /*                                                                                    */
 /**************************************************************************************/
 
-// there are currently no enums for this section
+/*
+ *  Predictor (initial guess) for the displacement of the generalized-alpha time
+ *  integration scheme:
+ *
+ *  Constant:             d_{n+1} = d_n
+ *  ConstantVelocity:     d_{n+1} = d_n + dt * v_n
+ *  ConstantAcceleration: d_{n+1} = d_n + dt * v_n + dt^2/2 * a_n
+ */
+enum class GenAlphaPredictor
+{
+  Constant,
+  ConstantVelocity,
+  ConstantAcceleration
+};
+
+std::string
+enum_to_string(GenAlphaPredictor const enum_type);
+
+/*
+ *  Predictor (initial guess) for the displacement of quasi-static problems, obtained by
+ *  polynomial extrapolation in the load factor of the solutions of previous load steps:
+ *
+ *  Constant:  solution of the previous load step
+ *  Linear:    secant through the solutions of the two previous load steps
+ *  Quadratic: parabola through the solutions of the three previous load steps
+ */
+enum class LoadPredictor
+{
+  Constant,
+  Linear,
+  Quadratic
+};
+
+std::string
+enum_to_string(LoadPredictor const enum_type);
 
 
 
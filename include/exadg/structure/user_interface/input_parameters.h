@@ -64,6 +64,7 @@ public:
       max_number_of_time_steps(std::numeric_limits<unsigned int>::max()),
       gen_alpha_type(GenAlphaType::GenAlpha),
       spectral_radius(1.0),
+      gen_alpha_predictor(GenAlphaPredictor::Constant),
       solver_info_data(SolverInfoData()),
       restarted_simulation(false),
       restart_data(RestartData()),
@@ -72,10 +73,14 @@ public:
       load_increment(1.0),
       adjust_load_increment(false),
       desired_newton_iterations(10),
+      max_load_increment_growth(2.0),
+      min_load_increment(1.e-6),
+      load_predictor(LoadPredictor::Constant),
 
       // SPATIAL DISCRETIZATION
       triangulation_type(TriangulationType::Undefined),
       mapping(MappingType::Affine),
+      use_dof_renumbering(false),
 
       // SOLVER
       newton_solver_data(Newton::SolverData(1e4, 1.e-12, 1.e-6)),
@@ -106,12 +111,35 @@ public:
       AssertThrow(restarted_simulation == false, ExcMessage("Restart has not been implemented."));
     }
 
+    // TEMPORAL DISCRETIZATION
+    if(problem_type == ProblemType::QuasiStatic)
+    {
+      AssertThrow(load_increment > 0.0 && load_increment <= 1.0,
+                  ExcMessage("Load increment has to be in (0,1]."));
+
+      if(adjust_load_increment)
+      {
+        AssertThrow(max_load_increment_growth >= 1.0,
+                    ExcMessage("Growth factor of load increment has to be >= 1."));
+        AssertThrow(min_load_increment > 0.0,
+                    ExcMessage("Minimum load increment has to be positive."));
+      }
+    }
+
     // SPATIAL DISCRETIZATION
     AssertThrow(triangulation_type != TriangulationType::Undefined,
                 ExcMessage("Parameter must be defined."));
 
     // SOLVER
     AssertThrow(solver != Solver::Undefined, ExcMessage("Parameter must be defined."));
+
+    if(use_dof_renumbering && preconditioner == Preconditioner::Multigrid)
+    {
+      // the level DoFs of local smoothing can not be renumbered consistently with the active DoFs
+      AssertThrow(multigrid_data.use_global_coarsening,
+                  ExcMessage(
+                    "DoF renumbering requires multigrid with use_global_coarsening = true."));
+    }
   }
 
   void
@@ -173,7 +201,13 @@ public:
     {
       print_parameter(pcout, "load_increment", load_increment);
       print_parameter(pcout, "Adjust load increment", adjust_load_increment);
-      print_parameter(pcout, "Desired Newton iterations", desired_newton_iterations);
+      if(adjust_load_increment)
+      {
+        print_parameter(pcout, "Desired Newton iterations", desired_newton_iterations);
+        print_parameter(pcout, "Max. growth of load increment", max_load_increment_growth);
+        print_parameter(pcout, "Min. load increment", min_load_increment);
+      }
+      print_parameter(pcout, "Load predictor", enum_to_string(load_predictor));
     }
 
     if(problem_type == ProblemType::Unsteady)
@@ -183,6 +217,7 @@ public:
       print_parameter(pcout, "Max. number of time steps", max_number_of_time_steps);
       print_parameter(pcout, "Time integration type", enum_to_string(gen_alpha_type));
       print_parameter(pcout, "Spectral radius", spectral_radius);
+      print_parameter(pcout, "Predictor", enum_to_string(gen_alpha_predictor));
       solver_info_data.print(pcout);
       if(restarted_simulation)
         restart_data.print(pcout);
@@ -196,6 +231,7 @@ public:
 
     print_parameter(pcout, "Triangulation type", enum_to_string(triangulation_type));
     print_parameter(pcout, "Mapping", enum_to_string(mapping));
+    print_parameter(pcout, "Use DoF renumbering", use_dof_renumbering);
   }
 
   void
@@ -301,6 +337,10 @@ public:
   // spectral radius rho_infty for generalized alpha time integration scheme
   double spectral_radius;
 
+  // predictor used as initial guess for the solution of the (non-)linear system of equations
+  // in each time step
+  GenAlphaPredictor gen_alpha_predictor;
+
   // configure printing of solver performance (wall time, number of iterations)
   SolverInfoData solver_info_data;
 
@@ -323,6 +363,18 @@ public:
   // Newton iterations according to which the load increment will be adjusted
   unsigned int desired_newton_iterations;
 
+  // in case of adaptively adjusting the load increment: maximum factor by which the load
+  // increment may grow from one load step to the next
+  double max_load_increment_growth;
+
+  // in case of adaptively adjusting the load increment: the simulation is aborted if the
+  // load increment has to be reduced below this value
+  double min_load_increment;
+
+  // predictor used as initial guess for the solution of the nonlinear system of equations
+  // in each load step
+  LoadPredictor load_predictor;
+
   /**************************************************************************************/
   /*                                                                                    */
   /*                              SPATIAL DISCRETIZATION                                */
@@ -335,6 +387,10 @@ public:
   // Type of mapping (polynomial degree) use for geometry approximation
   MappingType mapping;
 
+  // Renumber the degrees of freedom for data locality in the matrix-free loops, see
+  // renumber_dofs_for_data_locality() for details and restrictions.
+  bool use_dof_renumbering;
+
 
   /**************************************************************************************/
   /*                                                                                    */
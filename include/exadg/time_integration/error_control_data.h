@@ -0,0 +1,73 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_ERROR_CONTROL_DATA_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_ERROR_CONTROL_DATA_H_
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+
+// ExaDG
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+using namespace dealii;
+
+/*
+ * Parameters of the time step size control based on the local error estimate of embedded
+ * Runge-Kutta methods.
+ */
+struct ErrorControlData
+{
+  ErrorControlData()
+    : abs_tol(1.e-6), rel_tol(1.e-4), safety_factor(0.9), max_factor(5.0), max_rejected_steps(20)
+  {
+  }
+
+  void
+  print(ConditionalOStream & pcout) const
+  {
+    pcout << "  Error control:" << std::endl;
+    print_parameter(pcout, "Absolute tolerance", abs_tol);
+    print_parameter(pcout, "Relative tolerance", rel_tol);
+    print_parameter(pcout, "Safety factor", safety_factor);
+    print_parameter(pcout, "Maximum factor", max_factor);
+    print_parameter(pcout, "Max. number of rejected steps", max_rejected_steps);
+  }
+
+  // the local error e_i is scaled by abs_tol + rel_tol * |u_i| in the error norm
+  double abs_tol;
+  double rel_tol;
+
+  // safety factor of the step size controller (< 1)
+  double safety_factor;
+
+  // maximum increase/decrease of the time step size from one time step to the next
+  double max_factor;
+
+  // maximum number of consecutive rejected steps before aborting the simulation
+  unsigned int max_rejected_steps;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_ERROR_CONTROL_DATA_H_ */
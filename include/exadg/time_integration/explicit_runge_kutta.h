@@ -44,6 +44,37 @@ public:
   virtual unsigned int
   get_order() const = 0;
 
+  /*
+   * Returns true if the scheme provides an embedded method of order get_order()-1 that can be
+   * used to estimate the local error.
+   */
+  virtual bool
+  has_embedded_error_estimate() const
+  {
+    return false;
+  }
+
+  /*
+   * Same as solve_timestep(), but additionally computes the estimate error = u_np - u_np_hat of
+   * the local error, where u_np_hat is the solution of the embedded method. The error estimate is
+   * accumulated stage by stage, so that only one additional vector is needed.
+   */
+  virtual void
+  solve_timestep_with_error_estimate(VectorType & dst,
+                                     VectorType & src,
+                                     double const time,
+                                     double const time_step,
+                                     VectorType & error)
+  {
+    (void)dst;
+    (void)src;
+    (void)time;
+    (void)time_step;
+    (void)error;
+
+    AssertThrow(false, ExcMessage("This time integrator does not provide an error estimate."));
+  }
+
 protected:
   std::shared_ptr<Operator> underlying_operator;
 };
@@ -239,6 +270,39 @@ public:
 
   void
   solve_timestep(VectorType & vec_np, VectorType & vec_n, double const time, double const time_step)
+  {
+    do_solve_timestep(vec_np, vec_n, time, time_step, nullptr);
+  }
+
+  void
+  solve_timestep_with_error_estimate(VectorType & vec_np,
+                                     VectorType & vec_n,
+                                     double const time,
+                                     double const time_step,
+                                     VectorType & error)
+  {
+    do_solve_timestep(vec_np, vec_n, time, time_step, &error);
+  }
+
+  unsigned int
+  get_order() const
+  {
+    return 3;
+  }
+
+  bool
+  has_embedded_error_estimate() const
+  {
+    return true;
+  }
+
+private:
+  void
+  do_solve_timestep(VectorType & vec_np,
+                    VectorType & vec_n,
+                    double const time,
+                    double const time_step,
+                    VectorType * error)
   {
     if(!vec_tmp1.partitioners_are_globally_compatible(*vec_n.get_partitioner()))
     {
@@ -266,6 +330,12 @@ public:
     double const b3 = 57731312506979. / 19404895981398.;
     double const b4 = -101169746363290. / 37734290219643.;
 
+    // weights of the embedded method of order 2
+    double const bh1 = 15763415370699. / 46270243929542.;
+    double const bh2 = 514528521746. / 5659431552419.;
+    double const bh3 = 27030193851939. / 9429696342944.;
+    double const bh4 = -69544964788955. / 30262026368149.;
+
     double const c1 = 0.;
     double const c2 = a21;
     double const c3 = b1 + a32;
@@ -273,34 +343,35 @@ public:
 
     // stage 1
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_1 */, time + c1 * time_step);
+    if(error != nullptr)
+      error->equ((b1 - bh1) * time_step, vec_tmp1);
     vec_n.add(a21 * time_step, vec_tmp1); /* = u_2 */
     vec_np = vec_n;
     vec_np.add((b1 - a21) * time_step, vec_tmp1); /* = u_p */
 
     // stage 2
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_2 */, time + c2 * time_step);
+    if(error != nullptr)
+      error->add((b2 - bh2) * time_step, vec_tmp1);
     vec_np.add(a32 * time_step, vec_tmp1); /* = u_3 */
     vec_n = vec_np;
     vec_n.add((b2 - a32) * time_step, vec_tmp1); /* = u_p */
 
     // stage 3
     this->underlying_operator->evaluate(vec_tmp1, vec_np /* u_3 */, time + c3 * time_step);
+    if(error != nullptr)
+      error->add((b3 - bh3) * time_step, vec_tmp1);
     vec_n.add(a43 * time_step, vec_tmp1); /* = u_4 */
     vec_np = vec_n;
     vec_np.add((b3 - a43) * time_step, vec_tmp1); /* = u_p */
 
     // stage 4
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_3 */, time + c4 * time_step);
+    if(error != nullptr)
+      error->add((b4 - bh4) * time_step, vec_tmp1);
     vec_np.add(b4 * time_step, vec_tmp1); /* = u_p */
   }
 
-  unsigned int
-  get_order() const
-  {
-    return 3;
-  }
-
-private:
   VectorType vec_tmp1;
 };
 
@@ -321,6 +392,39 @@ public:
 
   void
   solve_timestep(VectorType & vec_np, VectorType & vec_n, double const time, double const time_step)
+  {
+    do_solve_timestep(vec_np, vec_n, time, time_step, nullptr);
+  }
+
+  void
+  solve_timestep_with_error_estimate(VectorType & vec_np,
+                                     VectorType & vec_n,
+                                     double const time,
+                                     double const time_step,
+                                     VectorType & error)
+  {
+    do_solve_timestep(vec_np, vec_n, time, time_step, &error);
+  }
+
+  unsigned int
+  get_order() const
+  {
+    return 4;
+  }
+
+  bool
+  has_embedded_error_estimate() const
+  {
+    return true;
+  }
+
+private:
+  void
+  do_solve_timestep(VectorType & vec_np,
+                    VectorType & vec_n,
+                    double const time,
+                    double const time_step,
+                    VectorType * error)
   {
     if(!vec_tmp1.partitioners_are_globally_compatible(*vec_n.get_partitioner()))
     {
@@ -351,6 +455,13 @@ public:
     double const b4 = 2114624349019. / 3568978502595.;
     double const b5 = 5198255086312. / 14908931495163.;
 
+    // weights of the embedded method of order 3
+    double const bh1 = 1016888040809. / 7410784769900.;
+    double const bh2 = 11231460423587. / 58533540763752.;
+    double const bh3 = -1563879915014. / 6823010717585.;
+    double const bh4 = 606302364029. / 971179775848.;
+    double const bh5 = 1097981568119. / 3980877426909.;
+
     double const c1 = 0.;
     double const c2 = a21;
     double const c3 = b1 + a32;
@@ -359,41 +470,44 @@ public:
 
     // stage 1
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_1 */, time + c1 * time_step);
+    if(error != nullptr)
+      error->equ((b1 - bh1) * time_step, vec_tmp1);
     vec_n.add(a21 * time_step, vec_tmp1); /* = u_2 */
     vec_np = vec_n;
     vec_np.add((b1 - a21) * time_step, vec_tmp1); /* = u_p */
 
     // stage 2
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_2 */, time + c2 * time_step);
+    if(error != nullptr)
+      error->add((b2 - bh2) * time_step, vec_tmp1);
     vec_np.add(a32 * time_step, vec_tmp1); /* = u_3 */
     vec_n = vec_np;
     vec_n.add((b2 - a32) * time_step, vec_tmp1); /* = u_p */
 
     // stage 3
     this->underlying_operator->evaluate(vec_tmp1, vec_np /* u_3 */, time + c3 * time_step);
+    if(error != nullptr)
+      error->add((b3 - bh3) * time_step, vec_tmp1);
     vec_n.add(a43 * time_step, vec_tmp1); /* = u_4 */
     vec_np = vec_n;
     vec_np.add((b3 - a43) * time_step, vec_tmp1); /* = u_p */
 
     // stage 4
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_3 */, time + c4 * time_step);
+    if(error != nullptr)
+      error->add((b4 - bh4) * time_step, vec_tmp1);
     vec_np.add(a54 * time_step, vec_tmp1); /* = u_5 */
     vec_n = vec_np;
     vec_n.add((b4 - a54) * time_step, vec_tmp1); /* = u_p */
 
     // stage 5
     this->underlying_operator->evaluate(vec_tmp1, vec_np /* u_4 */, time + c5 * time_step);
+    if(error != nullptr)
+      error->add((b5 - bh5) * time_step, vec_tmp1);
     vec_np = vec_n;
     vec_np.add(b5 * time_step, vec_tmp1);
   }
 
-  unsigned int
-  get_order() const
-  {
-    return 4;
-  }
-
-private:
   VectorType vec_tmp1;
 };
 
@@ -413,6 +527,39 @@ public:
 
   void
   solve_timestep(VectorType & vec_np, VectorType & vec_n, double const time, double const time_step)
+  {
+    do_solve_timestep(vec_np, vec_n, time, time_step, nullptr);
+  }
+
+  void
+  solve_timestep_with_error_estimate(VectorType & vec_np,
+                                     VectorType & vec_n,
+                                     double const time,
+                                     double const time_step,
+                                     VectorType & error)
+  {
+    do_solve_timestep(vec_np, vec_n, time, time_step, &error);
+  }
+
+  unsigned int
+  get_order() const
+  {
+    return 4;
+  }
+
+  bool
+  has_embedded_error_estimate() const
+  {
+    return true;
+  }
+
+private:
+  void
+  do_solve_timestep(VectorType & vec_np,
+                    VectorType & vec_n,
+                    double const time,
+                    double const time_step,
+                    VectorType * error)
   {
     if(!vec_tmp1.partitioners_are_globally_compatible(*vec_n.get_partitioner()))
     {
@@ -447,6 +594,14 @@ public:
     double const b4 = 1155491934595. / 2954287928812.;
     double const b5 = 707644755468. / 5028292464395.;
 
+    // weights of the embedded method of order 3, computed as the minimum-norm solution of the
+    // third-order conditions for the above coefficients a_ij
+    double const bh1 = 0.13780852332223695;
+    double const bh2 = 0.20989115121738811;
+    double const bh3 = 0.25349262949298329;
+    double const bh4 = 0.25685853241877965;
+    double const bh5 = 0.14194916354861201;
+
     double const c1 = 0.;
     double const c2 = a21;
     double const c3 = a31 + a32;
@@ -455,12 +610,16 @@ public:
 
     // stage 1
     this->underlying_operator->evaluate(vec_np /* F_1 */, vec_n /* u_1 */, time + c1 * time_step);
+    if(error != nullptr)
+      error->equ((b1 - bh1) * time_step, vec_np /* F_1 */);
     vec_n.add(a21 * time_step, vec_np /* F_1 */); /* = u_2 */
     vec_tmp1 = vec_n /* u_2 */;
     vec_tmp1.add((b1 - a21) * time_step, vec_np /* F_1 */); /* = u_p */
 
     // stage 2
     this->underlying_operator->evaluate(vec_tmp2 /* F_2 */, vec_n /* u_2 */, time + c2 * time_step);
+    if(error != nullptr)
+      error->add((b2 - bh2) * time_step, vec_tmp2 /* F_2 */);
     vec_tmp1.add(a32 * time_step,
                  vec_tmp2 /* F_2 */,
                  (a31 - b1) * time_step,
@@ -470,6 +629,8 @@ public:
 
     // stage 3
     this->underlying_operator->evaluate(vec_n /* F_3 */, vec_tmp1 /* u_3 */, time + c3 * time_step);
+    if(error != nullptr)
+      error->add((b3 - bh3) * time_step, vec_n /* F_3 */);
     vec_np.add(a43 * time_step,
                vec_n /* F_3 */,
                (a42 - b2) * time_step,
@@ -481,6 +642,8 @@ public:
     this->underlying_operator->evaluate(vec_tmp1 /* F_4 */,
                                         vec_np /* u_4 */,
                                         time + c4 * time_step);
+    if(error != nullptr)
+      error->add((b4 - bh4) * time_step, vec_tmp1 /* F_4 */);
     vec_tmp2.add(a54 * time_step,
                  vec_tmp1 /* F_4 */,
                  (a53 - b3) * time_step,
@@ -492,17 +655,12 @@ public:
     this->underlying_operator->evaluate(vec_tmp1 /* F_5 */,
                                         vec_tmp2 /* u_5 */,
                                         time + c5 * time_step);
+    if(error != nullptr)
+      error->add((b5 - bh5) * time_step, vec_tmp1 /* F_5 */);
     vec_np = vec_n;
     vec_np.add(b5 * time_step, vec_tmp1 /* F_5 */); /* = u_p */
   }
 
-  unsigned int
-  get_order() const
-  {
-    return 4;
-  }
-
-private:
   VectorType vec_tmp1, vec_tmp2;
 };
 
@@ -522,6 +680,39 @@ public:
 
   void
   solve_timestep(VectorType & vec_np, VectorType & vec_n, double const time, double const time_step)
+  {
+    do_solve_timestep(vec_np, vec_n, time, time_step, nullptr);
+  }
+
+  void
+  solve_timestep_with_error_estimate(VectorType & vec_np,
+                                     VectorType & vec_n,
+                                     double const time,
+                                     double const time_step,
+                                     VectorType & error)
+  {
+    do_solve_timestep(vec_np, vec_n, time, time_step, &error);
+  }
+
+  unsigned int
+  get_order() const
+  {
+    return 5;
+  }
+
+  bool
+  has_embedded_error_estimate() const
+  {
+    return true;
+  }
+
+private:
+  void
+  do_solve_timestep(VectorType & vec_np,
+                    VectorType & vec_n,
+                    double const time,
+                    double const time_step,
+                    VectorType * error)
   {
     if(!vec_tmp1.partitioners_are_globally_compatible(*vec_n.get_partitioner()))
     {
@@ -564,6 +755,18 @@ public:
     double const b8 = 720647959663. / 6565743875477.;
     double const b9 = 3559252274877. / 14424734981077.;
 
+    // weights of the embedded method of order 4, computed as the minimum-norm solution of the
+    // fourth-order conditions for the above coefficients a_ij
+    double const bh1 = 0.090733273758921748;
+    double const bh2 = 0.026832911880978388;
+    double const bh3 = -0.054144988751364378;
+    double const bh4 = 0.098398412572402991;
+    double const bh5 = 0.19160750364088908;
+    double const bh6 = 0.20735382086773291;
+    double const bh7 = 0.10311651678516712;
+    double const bh8 = 0.15315672262174501;
+    double const bh9 = 0.18294582662352715;
+
     double const c1 = 0.;
     double const c2 = a21;
     double const c3 = b1 + a32;
@@ -576,65 +779,76 @@ public:
 
     // stage 1
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_1 */, time + c1 * time_step);
+    if(error != nullptr)
+      error->equ((b1 - bh1) * time_step, vec_tmp1);
     vec_n.add(a21 * time_step, vec_tmp1); /* = u_2 */
     vec_np = vec_n;
     vec_np.add((b1 - a21) * time_step, vec_tmp1); /* = u_p */
 
     // stage 2
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_2 */, time + c2 * time_step);
+    if(error != nullptr)
+      error->add((b2 - bh2) * time_step, vec_tmp1);
     vec_np.add(a32 * time_step, vec_tmp1); /* = u_3 */
     vec_n = vec_np;
     vec_n.add((b2 - a32) * time_step, vec_tmp1); /* = u_p */
 
     // stage 3
     this->underlying_operator->evaluate(vec_tmp1, vec_np /* u_3 */, time + c3 * time_step);
+    if(error != nullptr)
+      error->add((b3 - bh3) * time_step, vec_tmp1);
     vec_n.add(a43 * time_step, vec_tmp1); /* = u_4 */
     vec_np = vec_n;
     vec_np.add((b3 - a43) * time_step, vec_tmp1); /* = u_p */
 
     // stage 4
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_4 */, time + c4 * time_step);
+    if(error != nullptr)
+      error->add((b4 - bh4) * time_step, vec_tmp1);
     vec_np.add(a54 * time_step, vec_tmp1); /* = u_5 */
     vec_n = vec_np;
     vec_n.add((b4 - a54) * time_step, vec_tmp1); /* = u_p */
 
     // stage 5
     this->underlying_operator->evaluate(vec_tmp1, vec_np /* u_5 */, time + c5 * time_step);
+    if(error != nullptr)
+      error->add((b5 - bh5) * time_step, vec_tmp1);
     vec_n.add(a65 * time_step, vec_tmp1); /* = u_6 */
     vec_np = vec_n;
     vec_np.add((b5 - a65) * time_step, vec_tmp1); /* = u_p */
 
     // stage 6
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_6 */, time + c6 * time_step);
+    if(error != nullptr)
+      error->add((b6 - bh6) * time_step, vec_tmp1);
     vec_np.add(a76 * time_step, vec_tmp1); /* = u_7 */
     vec_n = vec_np;
     vec_n.add((b6 - a76) * time_step, vec_tmp1); /* = u_p */
 
     // stage 7
     this->underlying_operator->evaluate(vec_tmp1, vec_np /* u_7 */, time + c7 * time_step);
+    if(error != nullptr)
+      error->add((b7 - bh7) * time_step, vec_tmp1);
     vec_n.add(a87 * time_step, vec_tmp1); /* = u_8 */
     vec_np = vec_n;
     vec_np.add((b7 - a87) * time_step, vec_tmp1); /* = u_p */
 
     // stage 8
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_8 */, time + c8 * time_step);
+    if(error != nullptr)
+      error->add((b8 - bh8) * time_step, vec_tmp1);
     vec_np.add(a98 * time_step, vec_tmp1); /* = u_9 */
     vec_n = vec_np;
     vec_n.add((b8 - a98) * time_step, vec_tmp1); /* = u_p */
 
     // stage 9
     this->underlying_operator->evaluate(vec_tmp1, vec_np /* u_9 */, time + c9 * time_step);
+    if(error != nullptr)
+      error->add((b9 - bh9) * time_step, vec_tmp1);
     vec_np = vec_n;
     vec_np.add(b9 * time_step, vec_tmp1);
   }
 
-  unsigned int
-  get_order() const
-  {
-    return 5;
-  }
-
-private:
   VectorType vec_tmp1;
 };
 
@@ -0,0 +1,258 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_MULTIRATE_RUNGE_KUTTA_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_MULTIRATE_RUNGE_KUTTA_H_
+
+// ExaDG
+#include <exadg/matrix_free/time_step_classes.h>
+#include <exadg/time_integration/explicit_runge_kutta.h>
+
+namespace ExaDG
+{
+using namespace dealii;
+
+/*
+ *  Multirate (local time stepping) variant of the classical, explicit Runge-Kutta schemes of
+ *  order 1-4, see ExplicitRungeKuttaTimeIntegrator. The cells are grouped into time step
+ *  classes c = 0, ..., n_classes-1 (see TimeStepClasses), where class c is advanced with time step
+ *  size time_step / 2^(n_classes-1-c), i.e., the time step size passed to solve_timestep() is the
+ *  one of the coarsest class. Within one step of class c, the finer class c-1 performs two steps
+ *  of half the size in a recursive manner.
+ *
+ *  A face between two classes is evaluated by the finer class only. The values of the coarser
+ *  neighbor at the stage times of the finer class are predicted by a first-order Taylor expansion
+ *  u(t) = u(t_0) + (t - t_0) du/dt(t_0), where the time derivative at the start time t_0 of the
+ *  coarser class consists of the first stage of the coarser class and the contributions of the
+ *  faces to finer classes, which are evaluated by the finer classes at t_0. The contributions of
+ *  these faces to the coarser neighbor are accumulated over all stages and steps of the finer
+ *  class (flux register) and are added to the coarser class as a constant source term over its
+ *  time step. Since the weights of all schemes sum up to one, the coarser neighbor receives
+ *  exactly the same face fluxes as the finer class, i.e., the scheme is conservative.
+ *
+ *  The prediction is accurate to O(dt^2) and the constant source term to O(dt) in every stage,
+ *  which limits the accuracy at the interface between two classes to second order in time. The
+ *  schemes of order 3 and 4 retain their order in the interior of the time step classes (and if
+ *  only one class exists), but are only second-order accurate at the interfaces between classes.
+ *
+ *  The operator has to provide the functions get_time_step_classes() and
+ *  evaluate_time_step_class(dst, src, time, c), which evaluates the right-hand side (including
+ *  the inverse mass matrix) for the cells and faces of class c and writes the results for the
+ *  cells of class c and their coarser neighbors.
+ */
+template<typename Operator, typename VectorType>
+class MultirateRungeKutta : public ExplicitTimeIntegrator<Operator, VectorType>
+{
+public:
+  typedef typename VectorType::value_type Number;
+
+  MultirateRungeKutta(unsigned int const              order_time_integrator,
+                      std::shared_ptr<Operator> const operator_in)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in), order(order_time_integrator)
+  {
+    // The Butcher tables of ExplicitRungeKuttaTimeIntegrator have only one non-zero entry
+    // a_{s,s-1} per row, which is stored in a[s] and also defines the stage time.
+    if(order == 1)
+    {
+      a = {0.0};
+      b = {1.0};
+    }
+    else if(order == 2)
+    {
+      a = {0.0, 1. / 2.};
+      b = {0.0, 1.0};
+    }
+    else if(order == 3)
+    {
+      a = {0.0, 1. / 3., 2. / 3.};
+      b = {1. / 4., 0.0, 3. / 4.};
+    }
+    else if(order == 4)
+    {
+      a = {0.0, 1. / 2., 1. / 2., 1.0};
+      b = {1. / 6., 2. / 6., 2. / 6., 1. / 6.};
+    }
+    else
+    {
+      AssertThrow(order <= 4,
+                  ExcMessage("Multirate Runge-Kutta method only implemented for order <= 4!"));
+    }
+
+    // initialize vectors
+    this->underlying_operator->initialize_dof_vector(u_start);
+    this->underlying_operator->initialize_dof_vector(u_eval);
+    this->underlying_operator->initialize_dof_vector(k1);
+    this->underlying_operator->initialize_dof_vector(k1_interface);
+    this->underlying_operator->initialize_dof_vector(k);
+    this->underlying_operator->initialize_dof_vector(rhs);
+    this->underlying_operator->initialize_dof_vector(flux_register);
+  }
+
+  void
+  solve_timestep(VectorType & dst, VectorType & src, double const time, double const time_step)
+  {
+    unsigned int const n_classes = this->underlying_operator->get_number_of_time_step_classes();
+
+    start_time_class.resize(n_classes);
+
+    dst           = src;
+    flux_register = 0.0;
+
+    advance(n_classes - 1, time, time_step, dst);
+  }
+
+  unsigned int
+  get_order() const
+  {
+    return order;
+  }
+
+private:
+  /*
+   * Advances the cells of class c (and recursively of all finer classes) from time to
+   * time + time_step.
+   */
+  void
+  advance(unsigned int const c, double const time, double const time_step, VectorType & dst)
+  {
+    std::vector<std::pair<unsigned int, unsigned int>> const & ranges =
+      this->underlying_operator->get_time_step_classes().get_dof_ranges(c);
+
+    start_time_class[c] = time;
+
+    for_each_local_index(ranges, [&](unsigned int const i) {
+      u_start.local_element(i) = dst.local_element(i);
+      u_eval.local_element(i)  = dst.local_element(i);
+
+      k1_interface.local_element(i) = 0.0;
+    });
+
+    // stage 1 (needed by the finer classes to predict the values of class c)
+    evaluate_stage(c, time, time_step * b[0]);
+    for_each_local_index(ranges,
+                         [&](unsigned int const i) { k1.local_element(i) = rhs.local_element(i); });
+
+    // finer classes: two steps of half the time step size
+    if(c > 0)
+    {
+      advance(c - 1, time, time_step / 2., dst);
+      advance(c - 1, time + time_step / 2., time_step / 2., dst);
+    }
+
+    // the face fluxes of the finer classes are added as a constant source term
+    Number const factor = 1.0 / time_step;
+
+    for_each_local_index(ranges, [&](unsigned int const i) {
+      k.local_element(i)   = k1.local_element(i) + factor * flux_register.local_element(i);
+      dst.local_element(i) = u_start.local_element(i) + time_step * b[0] * k.local_element(i);
+    });
+
+    // remaining stages
+    for(unsigned int s = 1; s < order; ++s)
+    {
+      for_each_local_index(ranges, [&](unsigned int const i) {
+        u_eval.local_element(i) = u_start.local_element(i) + time_step * a[s] * k.local_element(i);
+      });
+
+      evaluate_stage(c, time + a[s] * time_step, time_step * b[s]);
+
+      for_each_local_index(ranges, [&](unsigned int const i) {
+        k.local_element(i) = rhs.local_element(i) + factor * flux_register.local_element(i);
+        dst.local_element(i) += time_step * b[s] * k.local_element(i);
+      });
+    }
+
+    for_each_local_index(ranges,
+                         [&](unsigned int const i) { flux_register.local_element(i) = 0.0; });
+  }
+
+  /*
+   * Evaluates the right-hand side of class c for the stage values u_eval of class c into rhs and
+   * adds the contributions to the coarser neighbors, weighted by weight, to the flux register.
+   */
+  void
+  evaluate_stage(unsigned int const c, double const stage_time, double const weight)
+  {
+    TimeStepClasses<Number> const & classes = this->underlying_operator->get_time_step_classes();
+
+    unsigned int const n_classes = classes.get_number_of_classes();
+
+    // predict values of the coarser neighbors at the stage time
+    for(unsigned int c_neighbor = c + 1; c_neighbor < n_classes; ++c_neighbor)
+    {
+      Number const dt = stage_time - start_time_class[c_neighbor];
+
+      for_each_local_index(classes.get_dof_ranges_neighbors(c, c_neighbor),
+                           [&](unsigned int const i) {
+                             u_eval.local_element(i) =
+                               u_start.local_element(i) +
+                               dt * (k1.local_element(i) + k1_interface.local_element(i));
+                           });
+    }
+
+    // make sure that the ghost values of u_eval are updated by the matrix-free loop
+    u_eval.zero_out_ghosts();
+
+    this->underlying_operator->evaluate_time_step_class(rhs, u_eval, stage_time, c);
+
+    // The first stage of class c at the start time of a coarser neighbor provides the face
+    // contributions missing in the first stage of the coarser neighbor. This happens before any
+    // prediction with dt != 0 is needed, since the finer classes evaluate their first stage before
+    // advancing the next finer class.
+    for(unsigned int c_neighbor = c + 1; c_neighbor < n_classes; ++c_neighbor)
+    {
+      if(stage_time == start_time_class[c_neighbor])
+      {
+        for_each_local_index(classes.get_dof_ranges_neighbors(c, c_neighbor),
+                             [&](unsigned int const i) {
+                               k1_interface.local_element(i) += rhs.local_element(i);
+                             });
+      }
+    }
+
+    if(weight != 0.0)
+    {
+      for(unsigned int c_neighbor = c + 1; c_neighbor < n_classes; ++c_neighbor)
+      {
+        for_each_local_index(classes.get_dof_ranges_neighbors(c, c_neighbor),
+                             [&](unsigned int const i) {
+                               flux_register.local_element(i) += weight * rhs.local_element(i);
+                             });
+      }
+    }
+  }
+
+  unsigned int order;
+
+  std::vector<double> a, b;
+
+  // start time of the current time step of each class
+  std::vector<double> start_time_class;
+
+  VectorType u_start, u_eval, k1, k, rhs, flux_register;
+
+  // contributions of the faces to finer classes at the start time of the coarser class
+  VectorType k1_interface;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_MULTIRATE_RUNGE_KUTTA_H_ */
@@ -23,24 +23,54 @@
 #define INCLUDE_EXADG_TIME_INTEGRATION_RESTART_H_
 
 // C/C++
+#include <boost/crc.hpp>
+
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
 #include <sstream>
 
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/base/utilities.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/grid/cell_id.h>
+#include <deal.II/lac/vector.h>
+
 namespace ExaDG
 {
 using namespace dealii;
 
+/*
+ * The restart data of all processes is written to a single file, see RestartWriter.
+ */
 inline std::string
-restart_filename(std::string const & name, MPI_Comm const & mpi_comm)
+restart_filename(std::string const & name)
 {
-  std::string const rank = Utilities::int_to_string(Utilities::MPI::this_mpi_process(mpi_comm));
-
-  std::string const filename = name + "." + rank + ".restart";
+  std::string const filename = name + ".restart";
 
   return filename;
 }
 
-inline void
+inline std::uint32_t
+compute_checksum(char const * data, std::uint64_t const size)
+{
+  boost::crc_32_type crc;
+  crc.process_bytes(data, size);
+
+  return crc.checksum();
+}
+
+/*
+ * Returns false if the file could not be renamed. The error is not thrown here since this function
+ * is called by the first process only, see RestartWriter::wait().
+ */
+inline bool
 rename_restart_files(std::string const & filename)
 {
   // backup: rename current restart file into restart.old in case something fails while writing
@@ -52,16 +82,1023 @@ rename_restart_files(std::string const & filename)
   {
     int const error = rename(from.c_str(), to.c_str());
 
-    AssertThrow(error == 0, ExcMessage("Can not rename file: " + from + " -> " + to));
+    return error == 0;
   }
+
+  return true;
+}
+
+/*
+ * Layout of a restart file:
+ *
+ *   RestartFileHeader | RestartVectorHeader (one per vector) | preamble | records of vector 0 | ...
+ *
+ * The preamble contains the data of the time integrator that is the same on all processes
+ * (time, time step sizes, etc.). The DoF vectors are stored cell by cell: one record per active
+ * cell consisting of the CellId and the values of the degrees of freedom of the cell, which
+ * depends neither on the partitioning of the triangulation nor on the numbering of the degrees of
+ * freedom. The checksum of a vector is the sum of the checksums of its records and, hence, does
+ * not depend on the order of the records either.
+ */
+struct RestartFileHeader
+{
+  static std::uint64_t const magic_number = 0x5453524744617845; // "ExaDGRST"
+
+  std::uint64_t magic;
+  std::uint64_t preamble_size;
+  std::uint64_t preamble_checksum;
+  std::uint64_t n_vectors;
+};
+
+struct RestartVectorHeader
+{
+  std::uint64_t record_size;
+  std::uint64_t n_records;
+  std::uint64_t checksum;
+};
+
+// maximum number of elements that can be passed to MPI functions
+std::uint64_t const max_mpi_count = std::numeric_limits<int>::max();
+
+inline std::uint64_t
+compute_checksum_records(std::string const & records, std::uint64_t const record_size)
+{
+  std::uint64_t checksum = 0;
+  for(std::uint64_t offset = 0; offset < records.size(); offset += record_size)
+    checksum += compute_checksum(records.data() + offset, record_size);
+
+  return checksum;
 }
 
+/*
+ * MPI datatype of a record, so that the number of elements passed to MPI-IO functions is the
+ * number of records instead of the number of bytes. Has to be freed by the caller.
+ */
+inline MPI_Datatype
+create_record_type(std::uint64_t const record_size)
+{
+  AssertThrow(record_size > 0 && record_size <= max_mpi_count,
+              ExcMessage("Invalid record size in restart file."));
+
+  MPI_Datatype record_type;
+  MPI_Type_contiguous(record_size, MPI_BYTE, &record_type);
+  MPI_Type_commit(&record_type);
+
+  return record_type;
+}
+
+/*
+ * Restart data of one process to be written: the preamble (serialized by the time integrator,
+ * identical on all processes) and the records of the locally owned cells for each vector, see
+ * write_restart_vector().
+ */
+class RestartArchiveOut
+{
+public:
+  std::ostream &
+  preamble()
+  {
+    return preamble_stream;
+  }
+
+  void
+  add_vector(std::uint64_t const record_size, std::string && records_local)
+  {
+    AssertThrow(records_local.size() % record_size == 0,
+                ExcMessage("Restart data of a vector has to consist of complete records."));
+
+    record_sizes.push_back(record_size);
+    records.push_back(std::move(records_local));
+  }
+
+  /*
+   * Serializes the restart data of this process in the layout of a restart file, where the vector
+   * headers refer to the records of this process only, see RestartArchiveIn and
+   * CheckpointInMemory.
+   */
+  std::string
+  serialize() const
+  {
+    std::string const preamble = preamble_stream.str();
+
+    RestartFileHeader file_header;
+    file_header.magic             = RestartFileHeader::magic_number;
+    file_header.preamble_size     = preamble.size();
+    file_header.preamble_checksum = compute_checksum(preamble.data(), preamble.size());
+    file_header.n_vectors         = records.size();
+
+    std::string data(reinterpret_cast<char const *>(&file_header), sizeof(file_header));
+
+    for(unsigned int v = 0; v < records.size(); ++v)
+    {
+      RestartVectorHeader vector_header;
+      vector_header.record_size = record_sizes[v];
+      vector_header.n_records   = records[v].size() / record_sizes[v];
+      vector_header.checksum    = compute_checksum_records(records[v], record_sizes[v]);
+
+      data.append(reinterpret_cast<char const *>(&vector_header), sizeof(vector_header));
+    }
+
+    data.append(preamble);
+
+    for(auto const & records_vector : records)
+      data.append(records_vector);
+
+    return data;
+  }
+
+private:
+  friend class RestartWriter;
+
+  std::ostringstream preamble_stream;
+
+  std::vector<std::uint64_t> record_sizes;
+  std::vector<std::string>   records;
+};
+
+/*
+ * Writes the restart data of all processes to a single file with MPI-IO (collective operation).
+ * Each process writes the records of its locally owned cells at an offset given by the number of
+ * records of the processes with lower rank, and the first process writes the headers and the
+ * preamble. The file is written to filename.tmp first and replaces the restart file by a single
+ * rename once it has been written completely, i.e., a complete restart file exists at any time.
+ *
+ * In asynchronous mode, the data is kept in staging buffers and written with non-blocking
+ * collective MPI-IO operations, so that the simulation can continue while the data is written to
+ * the file system. The requests remain outstanding over the following time steps, in which
+ * progress() should be called to let the MPI library advance them. The completion of a pending
+ * write is awaited only before the next write and at the end of the simulation (or on
+ * destruction), i.e., errors during writing are reported by the next call of write() or wait(). A
+ * write has completed only once wait() returned true (or once write() returned in synchronous
+ * mode), see get_wall_time_last_write().
+ *
+ * Errors are reduced over all processes before an exception is thrown, so that either all or none
+ * of the processes leave the collective operations.
+ */
+class RestartWriter
+{
+public:
+  RestartWriter(MPI_Comm const & mpi_comm_in, bool const asynchronous_in = false)
+    : mpi_comm(mpi_comm_in),
+      asynchronous(asynchronous_in),
+      pending(false),
+      error_progress(false),
+      file(MPI_FILE_NULL),
+      wall_time_last_write(0.0)
+  {
+  }
+
+  ~RestartWriter()
+  {
+    // do not throw from the destructor
+    if(pending)
+    {
+      try
+      {
+        wait();
+      }
+      catch(...)
+      {
+      }
+    }
+  }
+
+  bool
+  is_asynchronous() const
+  {
+    return asynchronous;
+  }
+
+  void
+  write(RestartArchiveOut & archive, std::string const & filename_in)
+  {
+    wait();
+
+    timer.restart();
+
+    filename = filename_in;
+
+    unsigned int const rank = Utilities::MPI::this_mpi_process(mpi_comm);
+
+    preamble = archive.preamble_stream.str();
+    records.swap(archive.records);
+    record_sizes = archive.record_sizes;
+
+    unsigned int const n_vectors = records.size();
+
+    // offsets of the records of this process and global number of records of each vector
+    std::vector<RestartVectorHeader> vector_headers(n_vectors);
+    std::vector<std::uint64_t>       offsets_local(n_vectors, 0);
+    for(unsigned int v = 0; v < n_vectors; ++v)
+    {
+      std::uint64_t const n_records_local = records[v].size() / record_sizes[v];
+
+      int const ierr = MPI_Exscan(&n_records_local,
+                                  &offsets_local[v],
+                                  1,
+                                  MPI_UINT64_T,
+                                  MPI_SUM,
+                                  mpi_comm);
+      AssertThrowMPI(ierr);
+
+      if(rank == 0)
+        offsets_local[v] = 0;
+
+      vector_headers[v].record_size = record_sizes[v];
+      vector_headers[v].n_records   = Utilities::MPI::sum(n_records_local, mpi_comm);
+      vector_headers[v].checksum =
+        Utilities::MPI::sum(compute_checksum_records(records[v], record_sizes[v]), mpi_comm);
+    }
+
+    RestartFileHeader file_header;
+    file_header.magic             = RestartFileHeader::magic_number;
+    file_header.preamble_size     = preamble.size();
+    file_header.preamble_checksum = compute_checksum(preamble.data(), preamble.size());
+    file_header.n_vectors         = n_vectors;
+
+    // the headers and the preamble are written by the first process
+    if(rank == 0)
+    {
+      head.assign(reinterpret_cast<char const *>(&file_header), sizeof(file_header));
+      head.append(reinterpret_cast<char const *>(vector_headers.data()),
+                  n_vectors * sizeof(RestartVectorHeader));
+      head.append(preamble);
+    }
+    else
+    {
+      head.clear();
+    }
+
+    MPI_Offset offset = sizeof(RestartFileHeader) + n_vectors * sizeof(RestartVectorHeader) +
+                        preamble.size();
+
+    // the sizes are checked before the file is opened, see create_record_type()
+    bool valid_sizes = head.size() <= max_mpi_count;
+    for(unsigned int v = 0; v < n_vectors; ++v)
+      valid_sizes = valid_sizes && record_sizes[v] > 0 && record_sizes[v] <= max_mpi_count &&
+                    records[v].size() / record_sizes[v] <= max_mpi_count;
+    check_on_all_processes(valid_sizes, "Restart data too large for MPI-IO.");
+
+    std::string const filename_tmp = filename + ".tmp";
+
+    int ierr = MPI_File_open(mpi_comm,
+                             filename_tmp.c_str(),
+                             MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                             MPI_INFO_NULL,
+                             &file);
+    check_on_all_processes(ierr == MPI_SUCCESS, "Could not open file: " + filename_tmp);
+
+    // remove the data of a previously written file
+    ierr         = MPI_File_set_size(file, 0);
+    bool success = ierr == MPI_SUCCESS;
+
+    requests.clear();
+
+    // All processes take part in the collective write of the headers and the preamble, i.e.,
+    // head is empty on all processes except the first one.
+    if(asynchronous)
+    {
+      requests.emplace_back();
+      ierr = MPI_File_iwrite_at_all(file, 0, head.data(), head.size(), MPI_BYTE, &requests.back());
+    }
+    else
+    {
+      ierr = MPI_File_write_at_all(file, 0, head.data(), head.size(), MPI_BYTE, MPI_STATUS_IGNORE);
+    }
+    success = success && ierr == MPI_SUCCESS;
+
+    for(unsigned int v = 0; v < n_vectors; ++v)
+    {
+      MPI_Datatype record_type = create_record_type(record_sizes[v]);
+
+      std::uint64_t const n_records_local = records[v].size() / record_sizes[v];
+
+      MPI_Offset const offset_local = offset + offsets_local[v] * record_sizes[v];
+
+      if(asynchronous)
+      {
+        requests.emplace_back();
+        ierr = MPI_File_iwrite_at_all(file,
+                                      offset_local,
+                                      records[v].data(),
+                                      n_records_local,
+                                      record_type,
+                                      &requests.back());
+      }
+      else
+      {
+        ierr = MPI_File_write_at_all(file,
+                                     offset_local,
+                                     records[v].data(),
+                                     n_records_local,
+                                     record_type,
+                                     MPI_STATUS_IGNORE);
+      }
+      success = success && ierr == MPI_SUCCESS;
+
+      MPI_Type_free(&record_type);
+
+      offset += vector_headers[v].n_records * record_sizes[v];
+    }
+
+    pending = true;
+
+    // In case of an error, the file is closed by wait(), which reports the error on all processes.
+    // In asynchronous mode, wait() is called by the next write or at the end of the simulation.
+    error_progress = not success;
+
+    if(not asynchronous || Utilities::MPI::min(success ? 1 : 0, mpi_comm) == 0)
+      wait();
+  }
+
+  /*
+   * Lets the MPI library advance the requests of a pending asynchronous write (local operation,
+   * to be called regularly, e.g. once per time step). Errors are reported by wait().
+   */
+  void
+  progress()
+  {
+    if(not pending or error_progress)
+      return;
+
+    int       flag = 0;
+    int const ierr = MPI_Testall(requests.size(), requests.data(), &flag, MPI_STATUSES_IGNORE);
+
+    error_progress = ierr != MPI_SUCCESS;
+  }
+
+  /*
+   * Waits for the completion of a pending write (collective operation). Returns true if a write
+   * has been completed by this call.
+   */
+  bool
+  wait()
+  {
+    if(not pending)
+      return false;
+
+    pending = false;
+
+    std::string const filename_tmp = filename + ".tmp";
+
+    // completed requests have been set to MPI_REQUEST_NULL by progress()
+    int  ierr    = MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    bool success = ierr == MPI_SUCCESS && not error_progress;
+
+    ierr    = MPI_File_close(&file);
+    success = success && ierr == MPI_SUCCESS;
+
+    // release the staging buffers
+    requests.clear();
+    head.clear();
+    preamble.clear();
+    records.clear();
+
+    check_on_all_processes(success, "Could not write file: " + filename_tmp);
+
+    // replace the restart file by a single rename
+    bool renamed = true;
+    if(Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    {
+      renamed = rename_restart_files(filename) &&
+                rename(filename_tmp.c_str(), filename.c_str()) == 0;
+    }
+
+    check_on_all_processes(renamed, "Can not rename file: " + filename_tmp + " -> " + filename);
+
+    wall_time_last_write = Utilities::MPI::max(timer.wall_time(), mpi_comm);
+
+    return true;
+  }
+
+  /*
+   * Wall time of the last completed write (maximum over all processes, including the time in
+   * which the simulation continued in asynchronous mode).
+   */
+  double
+  get_wall_time_last_write() const
+  {
+    return wall_time_last_write;
+  }
+
+private:
+  /*
+   * Throws an exception on all processes if success is false on at least one process (collective
+   * operation).
+   */
+  void
+  check_on_all_processes(bool const success, std::string const & message) const
+  {
+    AssertThrow(Utilities::MPI::min(success ? 1 : 0, mpi_comm) == 1, ExcMessage(message));
+  }
+
+  MPI_Comm const mpi_comm;
+
+  bool asynchronous;
+
+  bool pending;
+
+  // error reported by MPI_Testall() in progress() or when starting the write
+  bool error_progress;
+
+  std::string filename;
+
+  // staging buffers
+  std::string                head;
+  std::string                preamble;
+  std::vector<std::string>   records;
+  std::vector<std::uint64_t> record_sizes;
+
+  MPI_File                 file;
+  std::vector<MPI_Request> requests;
+
+  Timer  timer;
+  double wall_time_last_write;
+};
+
+/*
+ * Restart data read from a file written by RestartWriter (the constructor and the destructor are
+ * collective operations). The headers and the preamble are read by the first process and
+ * broadcast to all processes. The records of the vectors are read in contiguous chunks of
+ * (almost) equal size by all processes, i.e., independently of the number of processes used to
+ * write the file, see read_restart_vector(). The size of the file and the checksums of the
+ * preamble and of all vectors are validated, and a mismatch is a hard error.
+ *
+ * Alternatively, the restart data can be read from memory, where each process provides the data
+ * serialized by RestartArchiveOut::serialize(), see CheckpointInMemory.
+ */
+class RestartArchiveIn
+{
+public:
+  RestartArchiveIn(std::string const & filename_in, MPI_Comm const & mpi_comm_in)
+    : filename(filename_in), mpi_comm(mpi_comm_in), file(MPI_FILE_NULL), next_vector(0)
+  {
+    int ierr =
+      MPI_File_open(mpi_comm, filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &file);
+    AssertThrow(ierr == MPI_SUCCESS, ExcMessage("File " + filename + " does not exist."));
+
+    MPI_Offset file_size = 0;
+    ierr                 = MPI_File_get_size(file, &file_size);
+    AssertThrowMPI(ierr);
+
+    bool const root = Utilities::MPI::this_mpi_process(mpi_comm) == 0;
+
+    RestartFileHeader file_header;
+    std::memset(&file_header, 0, sizeof(file_header));
+    if(root && std::uint64_t(file_size) >= sizeof(file_header))
+    {
+      ierr = MPI_File_read_at(
+        file, 0, &file_header, sizeof(file_header), MPI_BYTE, MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+    }
+    ierr = MPI_Bcast(&file_header, sizeof(file_header), MPI_BYTE, 0, mpi_comm);
+    AssertThrowMPI(ierr);
+
+    AssertThrow(file_header.magic == RestartFileHeader::magic_number,
+                ExcMessage("File " + filename + " is not a valid restart file (missing header)."));
+
+    // check the sizes before allocating memory
+    std::uint64_t const head_size = sizeof(RestartFileHeader) +
+                                    file_header.n_vectors * sizeof(RestartVectorHeader) +
+                                    file_header.preamble_size;
+    AssertThrow(file_header.n_vectors <= std::uint64_t(file_size) &&
+                  file_header.preamble_size <= std::uint64_t(file_size) &&
+                  head_size <= std::uint64_t(file_size) &&
+                  head_size - sizeof(RestartFileHeader) <= max_mpi_count,
+                ExcMessage("Restart file " + filename + " is corrupted (size mismatch)."));
+
+    std::string data(head_size - sizeof(RestartFileHeader), '\0');
+    if(root)
+    {
+      ierr = MPI_File_read_at(
+        file, sizeof(RestartFileHeader), &data[0], data.size(), MPI_BYTE, MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+    }
+    ierr = MPI_Bcast(&data[0], data.size(), MPI_BYTE, 0, mpi_comm);
+    AssertThrowMPI(ierr);
+
+    vector_headers.resize(file_header.n_vectors);
+    std::memcpy(vector_headers.data(),
+                data.data(),
+                file_header.n_vectors * sizeof(RestartVectorHeader));
+
+    std::string const preamble(data, file_header.n_vectors * sizeof(RestartVectorHeader));
+    AssertThrow(compute_checksum(preamble.data(), preamble.size()) ==
+                  file_header.preamble_checksum,
+                ExcMessage("Restart file " + filename + " is corrupted (checksum mismatch)."));
+
+    preamble_stream.str(preamble);
+
+    // offsets of the vectors and size of the file
+    std::uint64_t offset = head_size;
+    for(auto const & vector_header : vector_headers)
+    {
+      offsets.push_back(offset);
+
+      AssertThrow(vector_header.record_size > 0 &&
+                    vector_header.n_records <= std::uint64_t(file_size) / vector_header.record_size,
+                  ExcMessage("Restart file " + filename + " is corrupted (size mismatch)."));
+
+      offset += vector_header.n_records * vector_header.record_size;
+    }
+
+    AssertThrow(offset == std::uint64_t(file_size),
+                ExcMessage("Restart file " + filename + " is corrupted (size mismatch)."));
+  }
+
+  /*
+   * Reads the restart data of this process from data_local, which has been serialized by
+   * RestartArchiveOut::serialize() (collective operation). The number of records and the checksum
+   * of each vector are summed up over all processes, i.e., the data of all processes forms one
+   * restart file.
+   */
+  RestartArchiveIn(MPI_Comm const & mpi_comm_in, std::string const & data_local)
+    : filename("in-memory checkpoint"), mpi_comm(mpi_comm_in), file(MPI_FILE_NULL), next_vector(0)
+  {
+    RestartFileHeader file_header;
+    std::memset(&file_header, 0, sizeof(file_header));
+    if(data_local.size() >= sizeof(file_header))
+      std::memcpy(&file_header, data_local.data(), sizeof(file_header));
+
+    std::uint64_t const head_size =
+      sizeof(RestartFileHeader) + file_header.n_vectors * sizeof(RestartVectorHeader);
+
+    bool valid = file_header.magic == RestartFileHeader::magic_number &&
+                 file_header.n_vectors <= data_local.size() &&
+                 file_header.preamble_size <= data_local.size() &&
+                 head_size + file_header.preamble_size <= data_local.size();
+
+    std::vector<RestartVectorHeader> vector_headers_local;
+    if(valid)
+    {
+      vector_headers_local.resize(file_header.n_vectors);
+      std::memcpy(vector_headers_local.data(),
+                  data_local.data() + sizeof(RestartFileHeader),
+                  file_header.n_vectors * sizeof(RestartVectorHeader));
+
+      std::string const preamble(data_local, head_size, file_header.preamble_size);
+      valid = compute_checksum(preamble.data(), preamble.size()) == file_header.preamble_checksum;
+
+      preamble_stream.str(preamble);
+
+      std::uint64_t offset = head_size + file_header.preamble_size;
+      for(auto const & vector_header : vector_headers_local)
+      {
+        valid = valid && vector_header.record_size > 0 &&
+                vector_header.n_records <= data_local.size() / vector_header.record_size &&
+                offset + vector_header.n_records * vector_header.record_size <= data_local.size();
+        if(not valid)
+          break;
+
+        records_local.emplace_back(data_local,
+                                   offset,
+                                   vector_header.n_records * vector_header.record_size);
+
+        offset += vector_header.n_records * vector_header.record_size;
+      }
+
+      valid = valid && offset == data_local.size();
+    }
+
+    // all processes have to take part in the communication below or throw
+    AssertThrow(Utilities::MPI::min(valid ? 1u : 0u, mpi_comm) == 1,
+                ExcMessage("Restart data of " + filename + " is corrupted."));
+
+    unsigned int const n_vectors = vector_headers_local.size();
+    AssertThrow(Utilities::MPI::min(n_vectors, mpi_comm) ==
+                  Utilities::MPI::max(n_vectors, mpi_comm),
+                ExcMessage("Restart data of " + filename + " is corrupted."));
+
+    vector_headers = vector_headers_local;
+    for(auto & vector_header : vector_headers)
+    {
+      vector_header.n_records = Utilities::MPI::sum(vector_header.n_records, mpi_comm);
+      vector_header.checksum  = Utilities::MPI::sum(vector_header.checksum, mpi_comm);
+    }
+  }
+
+  ~RestartArchiveIn()
+  {
+    if(file != MPI_FILE_NULL)
+      MPI_File_close(&file);
+  }
+
+  MPI_Comm const &
+  get_mpi_communicator() const
+  {
+    return mpi_comm;
+  }
+
+  std::istream &
+  preamble()
+  {
+    return preamble_stream;
+  }
+
+  /*
+   * Returns true if all vectors contained in the file have been read.
+   */
+  bool
+  is_complete() const
+  {
+    return next_vector == vector_headers.size();
+  }
+
+  /*
+   * Reads the next vector of the file (collective operation): Process i of N reads the records
+   * [i*n/N, (i+1)*n/N) of the n records of the vector. The checksum of the vector is validated.
+   */
+  std::string
+  read_next_vector(std::uint64_t const record_size, std::uint64_t & n_records)
+  {
+    AssertThrow(next_vector < vector_headers.size(),
+                ExcMessage("Restart file " + filename + " contains less vectors than expected."));
+
+    RestartVectorHeader const & vector_header = vector_headers[next_vector];
+
+    AssertThrow(vector_header.record_size == record_size,
+                ExcMessage("Restart file " + filename +
+                           " does not match the discretization (size of records)."));
+
+    n_records = vector_header.n_records;
+
+    std::string records;
+
+    if(file != MPI_FILE_NULL)
+    {
+      std::uint64_t const rank    = Utilities::MPI::this_mpi_process(mpi_comm);
+      std::uint64_t const n_ranks = Utilities::MPI::n_mpi_processes(mpi_comm);
+
+      std::uint64_t const begin = n_records * rank / n_ranks;
+      std::uint64_t const end   = n_records * (rank + 1) / n_ranks;
+
+      AssertThrow(end - begin <= max_mpi_count,
+                  ExcMessage("Too many records in restart data of one process."));
+
+      records.resize((end - begin) * record_size);
+
+      MPI_Datatype record_type = create_record_type(record_size);
+
+      int const ierr = MPI_File_read_at_all(file,
+                                            offsets[next_vector] + begin * record_size,
+                                            &records[0],
+                                            end - begin,
+                                            record_type,
+                                            MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      MPI_Type_free(&record_type);
+    }
+    else
+    {
+      // in-memory data: the records of the locally owned cells of the process that wrote the data
+      records.swap(records_local[next_vector]);
+    }
+
+    std::uint64_t const checksum =
+      Utilities::MPI::sum(compute_checksum_records(records, record_size), mpi_comm);
+    AssertThrow(checksum == vector_header.checksum,
+                ExcMessage("Restart file " + filename + " is corrupted (checksum mismatch)."));
+
+    ++next_vector;
+
+    return records;
+  }
+
+private:
+  std::string const filename;
+
+  MPI_Comm const mpi_comm;
+
+  MPI_File file;
+
+  std::istringstream preamble_stream;
+
+  std::vector<RestartVectorHeader> vector_headers;
+  std::vector<std::uint64_t>       offsets;
+
+  // records of the vectors in case of in-memory data
+  std::vector<std::string> records_local;
+
+  unsigned int next_vector;
+};
+
+/*
+ * Sends data (and its checksum) to process destination and receives the data (and its checksum)
+ * of process source (collective operation).
+ */
 inline void
-write_restart_file(std::ostringstream & oss, std::string const & filename)
+sendrecv_checkpoint(std::string const & data_send,
+                    std::uint32_t const checksum_send,
+                    unsigned int const  destination,
+                    std::string &       data_recv,
+                    std::uint32_t &     checksum_recv,
+                    unsigned int const  source,
+                    MPI_Comm const &    mpi_comm)
+{
+  int const tag = 1207;
+
+  std::uint64_t header_send[2] = {data_send.size(), checksum_send};
+  std::uint64_t header_recv[2] = {0, 0};
+
+  int ierr = MPI_Sendrecv(header_send,
+                          2,
+                          MPI_UINT64_T,
+                          destination,
+                          tag,
+                          header_recv,
+                          2,
+                          MPI_UINT64_T,
+                          source,
+                          tag,
+                          mpi_comm,
+                          MPI_STATUS_IGNORE);
+  AssertThrowMPI(ierr);
+
+  // all processes have to take part in the communication below or throw
+  bool const size_ok = header_send[0] <= max_mpi_count && header_recv[0] <= max_mpi_count;
+  AssertThrow(Utilities::MPI::min(size_ok ? 1u : 0u, mpi_comm) == 1,
+              ExcMessage("Checkpoint data exceeds the maximum message size."));
+
+  data_recv.resize(header_recv[0]);
+  checksum_recv = header_recv[1];
+
+  ierr = MPI_Sendrecv(data_send.data(),
+                      header_send[0],
+                      MPI_CHAR,
+                      destination,
+                      tag,
+                      &data_recv[0],
+                      header_recv[0],
+                      MPI_CHAR,
+                      source,
+                      tag,
+                      mpi_comm,
+                      MPI_STATUS_IGNORE);
+  AssertThrowMPI(ierr);
+}
+
+/*
+ * In-memory checkpoint: The compressed restart data of each process is kept in the memory of the
+ * process itself and of a partner process (buddy, the next rank), which allows frequent and cheap
+ * checkpoints without touching the file system. The data is validated by a checksum before it is
+ * used, and the copy of the buddy is used if the own copy is missing or corrupted. Both store()
+ * and restore() are collective operations.
+ */
+class CheckpointInMemory
+{
+public:
+  CheckpointInMemory() : own_checksum(0), buddy_checksum(0)
+  {
+  }
+
+  void
+  store(RestartArchiveOut const & archive, MPI_Comm const & mpi_comm)
+  {
+    unsigned int const rank    = Utilities::MPI::this_mpi_process(mpi_comm);
+    unsigned int const n_ranks = Utilities::MPI::n_mpi_processes(mpi_comm);
+
+    own_data     = Utilities::compress(archive.serialize());
+    own_checksum = compute_checksum(own_data.data(), own_data.size());
+
+    // send own copy to the next process, receive the copy of the previous process
+    sendrecv_checkpoint(own_data,
+                        own_checksum,
+                        (rank + 1) % n_ranks,
+                        buddy_data,
+                        buddy_checksum,
+                        (rank + n_ranks - 1) % n_ranks,
+                        mpi_comm);
+  }
+
+  /*
+   * Returns the restart data of the last checkpoint, or an empty pointer on all processes if no
+   * valid copy of the data of some process exists (e.g., if no checkpoint has been stored so far).
+   */
+  std::shared_ptr<RestartArchiveIn>
+  restore(MPI_Comm const & mpi_comm) const
+  {
+    unsigned int const rank    = Utilities::MPI::this_mpi_process(mpi_comm);
+    unsigned int const n_ranks = Utilities::MPI::n_mpi_processes(mpi_comm);
+
+    // return the copy of the previous process, receive the copy held by the next process
+    std::string   data_from_buddy;
+    std::uint32_t checksum_from_buddy = 0;
+    sendrecv_checkpoint(buddy_data,
+                        buddy_checksum,
+                        (rank + n_ranks - 1) % n_ranks,
+                        data_from_buddy,
+                        checksum_from_buddy,
+                        (rank + 1) % n_ranks,
+                        mpi_comm);
+
+    std::string const * data = nullptr;
+    if(not own_data.empty() && compute_checksum(own_data.data(), own_data.size()) == own_checksum)
+      data = &own_data;
+    else if(not data_from_buddy.empty() &&
+            compute_checksum(data_from_buddy.data(), data_from_buddy.size()) ==
+              checksum_from_buddy)
+      data = &data_from_buddy;
+
+    if(Utilities::MPI::min(data != nullptr ? 1u : 0u, mpi_comm) == 0)
+      return std::shared_ptr<RestartArchiveIn>();
+
+    return std::make_shared<RestartArchiveIn>(mpi_comm, Utilities::decompress(*data));
+  }
+
+  /*
+   * Discards the own copy of the data of this process as if the memory of the process had been
+   * lost, so that the data is restored from the copy of the buddy.
+   */
+  void
+  discard_own_copy()
+  {
+    own_data.clear();
+    own_checksum = 0;
+  }
+
+private:
+  std::string   own_data;
+  std::uint32_t own_checksum;
+
+  std::string   buddy_data;
+  std::uint32_t buddy_checksum;
+};
+
+/*
+ * Partition-independent serialization of a DoF vector for restart: The values are stored cell by
+ * cell together with the CellId of the locally owned cells, which depends neither on the
+ * partitioning of the triangulation nor on the numbering of the degrees of freedom. Hence, the
+ * data can be read with a different number of processes, see read_restart_vector().
+ */
+template<int dim, typename VectorType>
+void
+write_restart_vector(RestartArchiveOut &     archive,
+                     VectorType const &      vector,
+                     DoFHandler<dim> const & dof_handler)
+{
+  typedef typename VectorType::value_type Number;
+
+  // cells at processor boundaries need ghost values in case of continuous elements
+  IndexSet relevant_dofs;
+  DoFTools::extract_locally_relevant_dofs(dof_handler, relevant_dofs);
+
+  VectorType vector_ghosted(dof_handler.locally_owned_dofs(),
+                            relevant_dofs,
+                            vector.get_mpi_communicator());
+  vector_ghosted.copy_locally_owned_data_from(vector);
+  vector_ghosted.update_ghost_values();
+
+  unsigned int const  dofs_per_cell = dof_handler.get_fe().dofs_per_cell;
+  std::uint64_t const record_size = sizeof(CellId::binary_type) + dofs_per_cell * sizeof(Number);
+
+  std::string records;
+
+  Vector<Number> values(dofs_per_cell);
+  for(auto const & cell : dof_handler.active_cell_iterators())
+  {
+    if(not cell->is_locally_owned())
+      continue;
+
+    CellId::binary_type const id = cell->id().template to_binary<dim>();
+    records.append(reinterpret_cast<char const *>(&id), sizeof(id));
+
+    cell->get_dof_values(vector_ghosted, values);
+    records.append(reinterpret_cast<char const *>(values.begin()), dofs_per_cell * sizeof(Number));
+  }
+
+  archive.add_vector(record_size, std::move(records));
+}
+
+/*
+ * Reads a vector written by write_restart_vector() (collective operation). The records read by a
+ * process (see RestartArchiveIn::read_next_vector()) are in general not the ones of its locally
+ * owned cells. The records are therefore sent to a rendezvous process determined by a hash of the
+ * CellId, to which the owners of the cells also send their requests. The rendezvous processes
+ * answer the requests with the values of the cells, so that each record is communicated twice
+ * independently of the number of processes.
+ */
+template<int dim, typename VectorType>
+void
+read_restart_vector(RestartArchiveIn &      archive,
+                    VectorType &            vector,
+                    DoFHandler<dim> const & dof_handler)
 {
-  std::ofstream stream(filename.c_str());
+  typedef typename VectorType::value_type Number;
+
+  MPI_Comm const &   mpi_comm = archive.get_mpi_communicator();
+  unsigned int const n_ranks  = Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  unsigned int const  dofs_per_cell = dof_handler.get_fe().dofs_per_cell;
+  std::uint64_t const id_size       = sizeof(CellId::binary_type);
+  std::uint64_t const values_size   = dofs_per_cell * sizeof(Number);
+  std::uint64_t const record_size   = id_size + values_size;
+
+  std::uint64_t     n_records = 0;
+  std::string const records   = archive.read_next_vector(record_size, n_records);
+
+  AssertThrow(n_records == dof_handler.get_triangulation().n_global_active_cells(),
+              ExcMessage("Restart file does not match the triangulation (number of cells)."));
+
+  auto const rendezvous_rank = [&](char const * id) -> unsigned int {
+    return compute_checksum(id, id_size) % n_ranks;
+  };
+
+  // 1. send the records read from the file to the rendezvous processes
+  std::map<unsigned int, std::vector<char>> records_send;
+  for(std::uint64_t offset = 0; offset < records.size(); offset += record_size)
+  {
+    std::vector<char> & buffer = records_send[rendezvous_rank(records.data() + offset)];
+    buffer.insert(buffer.end(),
+                  records.data() + offset,
+                  records.data() + offset + record_size);
+  }
+
+  std::map<unsigned int, std::vector<char>> const records_recv =
+    Utilities::MPI::some_to_some(mpi_comm, records_send);
+
+  // 2. send the CellIds of the locally owned cells to the rendezvous processes
+  std::map<unsigned int, std::vector<char>>                                         requests_send;
+  std::map<unsigned int, std::vector<typename DoFHandler<dim>::active_cell_iterator>> cells;
+  for(auto const & cell : dof_handler.active_cell_iterators())
+  {
+    if(not cell->is_locally_owned())
+      continue;
+
+    CellId::binary_type const id     = cell->id().template to_binary<dim>();
+    char const *              id_ptr = reinterpret_cast<char const *>(&id);
+    unsigned int const        target = rendezvous_rank(id_ptr);
 
-  stream << oss.str() << std::endl;
+    requests_send[target].insert(requests_send[target].end(), id_ptr, id_ptr + id_size);
+    cells[target].push_back(cell);
+  }
+
+  std::map<unsigned int, std::vector<char>> const requests_recv =
+    Utilities::MPI::some_to_some(mpi_comm, requests_send);
+
+  // 3. answer the requests with the values of the cells
+  std::map<CellId::binary_type, char const *> values_of_cell;
+  for(auto const & rank_and_records : records_recv)
+  {
+    std::vector<char> const & buffer = rank_and_records.second;
+    for(std::uint64_t offset = 0; offset < buffer.size(); offset += record_size)
+    {
+      CellId::binary_type id;
+      std::memcpy(&id, buffer.data() + offset, id_size);
+      values_of_cell[id] = buffer.data() + offset + id_size;
+    }
+  }
+
+  unsigned int                              n_missing_cells = 0;
+  std::map<unsigned int, std::vector<char>> values_send;
+  for(auto const & rank_and_requests : requests_recv)
+  {
+    std::vector<char> const & buffer = rank_and_requests.second;
+    std::vector<char> &       values = values_send[rank_and_requests.first];
+    values.resize(buffer.size() / id_size * values_size);
+
+    for(std::uint64_t c = 0; c < buffer.size() / id_size; ++c)
+    {
+      CellId::binary_type id;
+      std::memcpy(&id, buffer.data() + c * id_size, id_size);
+
+      auto const it = values_of_cell.find(id);
+      if(it != values_of_cell.end())
+        std::memcpy(values.data() + c * values_size, it->second, values_size);
+      else
+        ++n_missing_cells;
+    }
+  }
+
+  // all processes have to take part in the communication below or throw
+  n_missing_cells = Utilities::MPI::sum(n_missing_cells, mpi_comm);
+  AssertThrow(n_missing_cells == 0,
+              ExcMessage("Restart file does not match the triangulation (" +
+                         Utilities::to_string(n_missing_cells) + " cells not found)."));
+
+  std::map<unsigned int, std::vector<char>> const values_recv =
+    Utilities::MPI::some_to_some(mpi_comm, values_send);
+
+  // 4. set the values of the locally owned degrees of freedom
+  std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
+  std::vector<Number>                  values(dofs_per_cell);
+  for(auto const & rank_and_cells : cells)
+  {
+    auto const it = values_recv.find(rank_and_cells.first);
+    AssertThrow(it != values_recv.end() &&
+                  it->second.size() == rank_and_cells.second.size() * values_size,
+                ExcMessage("Restart data of locally owned cells has not been received."));
+
+    for(unsigned int c = 0; c < rank_and_cells.second.size(); ++c)
+    {
+      std::memcpy(values.data(), it->second.data() + c * values_size, values_size);
+
+      rank_and_cells.second[c]->get_dof_indices(dof_indices);
+      for(unsigned int i = 0; i < dofs_per_cell; ++i)
+        if(vector.in_local_range(dof_indices[i]))
+          vector(dof_indices[i]) = values[i];
+    }
+  }
 }
 
 } // namespace ExaDG
@@ -43,6 +43,9 @@ struct RestartData
       interval_wall_time(std::numeric_limits<double>::max()),
       interval_time_steps(std::numeric_limits<unsigned int>::max()),
       filename("restart"),
+      write_asynchronously(false),
+      write_checkpoint_in_memory(false),
+      interval_time_steps_in_memory(std::numeric_limits<unsigned int>::max()),
       counter(1)
   {
   }
@@ -59,6 +62,14 @@ struct RestartData
       print_parameter(pcout, "Interval wall time", interval_wall_time);
       print_parameter(pcout, "Interval time steps", interval_time_steps);
       print_parameter(pcout, "Filename", filename);
+      print_parameter(pcout, "Write asynchronously", write_asynchronously);
+    }
+
+    print_parameter(pcout, "Write checkpoint in memory", write_checkpoint_in_memory);
+
+    if(write_checkpoint_in_memory == true)
+    {
+      print_parameter(pcout, "Interval time steps (memory)", interval_time_steps_in_memory);
     }
   }
 
@@ -98,6 +109,16 @@ struct RestartData
   // filename for restart files
   std::string filename;
 
+  // write the restart file with non-blocking MPI-IO operations instead of stalling the simulation
+  bool write_asynchronously;
+
+  // additional checkpoint level: the compressed restart data of each process is kept in memory
+  // on the process itself and on a partner process (independent of write_restart)
+  bool write_checkpoint_in_memory;
+
+  // number of time steps after which to write the in-memory checkpoint
+  unsigned int interval_time_steps_in_memory;
+
   // counter needed do decide when to write restart
   mutable unsigned int counter;
 };
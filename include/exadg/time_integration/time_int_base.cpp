@@ -39,6 +39,8 @@ TimeIntBase::TimeIntBase(double const &      start_time_,
     time_step_number(1),
     max_number_of_time_steps(max_number_of_time_steps_),
     restart_data(restart_data_),
+    restart_writer(mpi_comm_, restart_data_.write_asynchronously),
+    time_step_number_checkpoint(1),
     mpi_comm(mpi_comm_),
     timer_tree(new TimerTree()),
     print_wall_times(print_wall_times_)
@@ -114,6 +116,10 @@ TimeIntBase::advance_one_timestep_post_solve()
     do_timestep_post_solve();
 
     postprocessing();
+
+    // make sure that the last restart file has been written
+    if(finished())
+      wait_for_restart_writer();
   }
   else
   {
@@ -169,6 +175,12 @@ TimeIntBase::get_timings() const
   return timer_tree;
 }
 
+bool
+TimeIntBase::resume_from_checkpoint()
+{
+  return read_restart();
+}
+
 void
 TimeIntBase::do_timestep()
 {
@@ -188,43 +200,129 @@ TimeIntBase::get_time_step_number() const
 void
 TimeIntBase::write_restart() const
 {
-  double const wall_time = global_timer.wall_time();
+  // let the MPI library advance a pending asynchronous write of the previous restart file
+  restart_writer.progress();
+
+  // All processes take part in writing the restart file. Hence, the wall time used to decide
+  // whether to write restart data has to be the same on all processes. The global reduction is
+  // only needed if the restart is controlled by the wall time.
+  bool write_file = false;
+  if(restart_data.write_restart == true)
+  {
+    double const wall_time =
+      restart_data.interval_wall_time < std::numeric_limits<double>::max() ?
+        Utilities::MPI::max(global_timer.wall_time(), mpi_comm) :
+        0.0;
+
+    write_file = restart_data.do_restart(wall_time,
+                                         time - start_time,
+                                         time_step_number,
+                                         time_step_number == 2);
+  }
+
+  bool const write_memory =
+    restart_data.write_checkpoint_in_memory == true &&
+    get_number_of_time_steps() % restart_data.interval_time_steps_in_memory == 0;
 
-  if(restart_data.do_restart(wall_time, time - start_time, time_step_number, time_step_number == 2))
+  if(write_file || write_memory)
   {
-    pcout << std::endl
-          << print_horizontal_line() << std::endl
-          << std::endl
-          << " Writing restart file at time t = " << this->get_time() << ":" << std::endl;
+    if(write_file)
+    {
+      pcout << std::endl
+            << print_horizontal_line() << std::endl
+            << std::endl
+            << " Writing restart file at time t = " << this->get_time() << ":" << std::endl;
 
-    std::string const filename = restart_filename(restart_data.filename, mpi_comm);
+      // a pending write has to be completed before the next one is started
+      wait_for_restart_writer();
+    }
 
-    rename_restart_files(filename);
+    // the data is serialized once for both checkpoint levels
+    RestartArchiveOut archive;
+    do_write_restart(archive);
 
-    do_write_restart(restart_filename(restart_data.filename, mpi_comm));
+    if(write_memory)
+    {
+      Timer timer;
+      timer.restart();
 
-    pcout << std::endl << " ... done!" << std::endl << print_horizontal_line() << std::endl;
+      checkpoint_in_memory.store(archive, mpi_comm);
+      time_step_number_checkpoint = time_step_number;
+
+      timer_tree->insert({"Timeloop", "Checkpoint in memory"}, timer.wall_time());
+    }
+
+    if(write_file)
+    {
+      // the rotation of the restart files is done by the restart writer once the new file has
+      // been written completely
+      restart_writer.write(archive, restart_filename(restart_data.filename));
+
+      // in asynchronous mode, the completion is reported by wait_for_restart_writer()
+      if(restart_writer.is_asynchronous())
+        pcout << std::endl << " ... writing in background." << std::endl;
+      else
+        pcout << std::endl
+              << " ... done! (wall time: " << restart_writer.get_wall_time_last_write() << " s)"
+              << std::endl;
+
+      pcout << print_horizontal_line() << std::endl;
+    }
   }
 }
 
 void
+TimeIntBase::wait_for_restart_writer() const
+{
+  if(restart_writer.wait())
+  {
+    pcout << std::endl
+          << " Writing restart file in background ... done! (wall time: "
+          << restart_writer.get_wall_time_last_write() << " s)" << std::endl;
+  }
+}
+
+bool
 TimeIntBase::read_restart()
 {
   pcout << std::endl
         << print_horizontal_line() << std::endl
         << std::endl
-        << " Reading restart file:" << std::endl;
+        << " Reading restart data:" << std::endl;
+
+  // fast resume path: the in-memory checkpoint is validated by CheckpointInMemory
+  std::shared_ptr<RestartArchiveIn> archive = checkpoint_in_memory.restore(mpi_comm);
+
+  bool const from_memory = archive.get() != nullptr;
+
+  if(from_memory)
+  {
+    pcout << std::endl
+          << " Using in-memory checkpoint of time step " << time_step_number_checkpoint;
+  }
+  else
+  {
+    pcout << std::endl << " Using restart file " << restart_filename(restart_data.filename);
 
-  std::string   filename = restart_filename(restart_data.filename, mpi_comm);
-  std::ifstream in(filename);
-  AssertThrow(in, ExcMessage("File " + filename + " does not exist."));
+    // The restart file is written in a partition-independent format, i.e., the number of
+    // processes may change between restarts. The file is validated by RestartArchiveIn.
+    archive = std::make_shared<RestartArchiveIn>(restart_filename(restart_data.filename), mpi_comm);
+  }
+
+  do_read_restart(*archive);
 
-  do_read_restart(in);
+  AssertThrow(archive->is_complete(),
+              ExcMessage("Restart data contains more vectors than read by the time integrator."));
+
+  if(from_memory)
+    time_step_number = time_step_number_checkpoint;
 
   pcout << std::endl
         << " ... done!" << std::endl
         << print_horizontal_line() << std::endl
         << std::endl;
+
+  return from_memory;
 }
 
 void
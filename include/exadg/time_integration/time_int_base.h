@@ -135,6 +135,13 @@ public:
   std::shared_ptr<TimerTree>
   get_timings() const;
 
+  /*
+   * Fast resume path: resets the time integrator to the last checkpoint, see read_restart().
+   * Returns true if the in-memory checkpoint has been used.
+   */
+  bool
+  resume_from_checkpoint();
+
 protected:
   /*
    * Do one time step including different updates before and after the actual solution of the
@@ -171,16 +178,24 @@ protected:
   get_time_step_number() const;
 
   /*
-   * Write solution vectors to files so that the simulation can be restart from an intermediate
-   * state.
+   * Write solution vectors to files (and/or to the in-memory checkpoint) so that the simulation
+   * can be restart from an intermediate state.
    */
   void
   write_restart() const;
 
   /*
-   * Read all relevant data from restart files to start the time integrator.
+   * Waits for the completion of an asynchronous write of restart files and reports it.
    */
   void
+  wait_for_restart_writer() const;
+
+  /*
+   * Read all relevant data from the in-memory checkpoint if a valid copy exists on all processes,
+   * and from restart files otherwise, to start the time integrator. Returns true if the in-memory
+   * checkpoint has been used.
+   */
+  bool
   read_restart();
 
   /*
@@ -231,6 +246,17 @@ protected:
    */
   RestartData const restart_data;
 
+  /*
+   * Writes the restart files (possibly in the background).
+   */
+  mutable RestartWriter restart_writer;
+
+  /*
+   * In-memory checkpoint and the time step number at which it has been written.
+   */
+  mutable CheckpointInMemory checkpoint_in_memory;
+  mutable unsigned int       time_step_number_checkpoint;
+
   /*
    * MPI communicator.
    */
@@ -248,13 +274,13 @@ private:
    * Write restart data.
    */
   virtual void
-  do_write_restart(std::string const & filename) const = 0;
+  do_write_restart(RestartArchiveOut & archive) const = 0;
 
   /*
    * Read restart data.
    */
   virtual void
-  do_read_restart(std::ifstream & in) = 0;
+  do_read_restart(RestartArchiveIn & archive) = 0;
 };
 
 } // namespace ExaDG
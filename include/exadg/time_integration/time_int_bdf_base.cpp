@@ -245,7 +245,7 @@ TimeIntBDFBase<Number>::do_timestep_post_solve()
     time_steps[0] = recalculate_time_step_size();
   }
 
-  if(restart_data.write_restart == true)
+  if(restart_data.write_restart == true || restart_data.write_checkpoint_in_memory == true)
   {
     write_restart();
   }
@@ -305,7 +305,7 @@ TimeIntBDFBase<Number>::calculate_sum_alphai_ui_oif_substepping(VectorType & sum
    *                           +--------+---------->+
    *
    *  i=2:               k=2       k=1       k=0
-   *                 +-------- +--------+---------->+
+   *                 +---------+--------+---------->+
    */
   for(unsigned int i = 0; i < order; ++i)
   {
@@ -322,13 +322,7 @@ TimeIntBDFBase<Number>::calculate_sum_alphai_ui_oif_substepping(VectorType & sum
       double const time_n_k = this->get_previous_time(k);
 
       // number of sub-steps per "macro" time step
-      int M = (int)(cfl / (cfl_oif - eps));
-
-      AssertThrow(M >= 1, ExcMessage("Invalid parameters cfl and cfl_oif."));
-
-      // make sure that cfl_oif is not violated
-      if(cfl_oif < cfl / double(M) - eps)
-        M += 1;
+      int const M = get_number_of_oif_substeps(cfl, cfl_oif);
 
       // calculate sub-stepping time step size delta_s
       double const delta_s = this->get_time_step_size(k) / (double)M;
@@ -351,11 +345,118 @@ TimeIntBDFBase<Number>::calculate_sum_alphai_ui_oif_substepping(VectorType & sum
 
 template<typename Number>
 void
-TimeIntBDFBase<Number>::do_read_restart(std::ifstream & in)
+TimeIntBDFBase<Number>::calculate_sum_alphai_ui_oif_substepping_single_sweep(
+  VectorType & sum_alphai_ui,
+  double const cfl,
+  double const cfl_oif)
 {
-  boost::archive::binary_iarchive ia(in);
-  read_restart_preamble(ia);
-  read_restart_vectors(ia);
+  VectorType solution_tilde_mp(sum_alphai_ui), solution_tilde_m(sum_alphai_ui),
+    solution_n_k(sum_alphai_ui);
+
+  /*
+   * Instead of integrating each history term u(t_{n-i}) separately over t_{n-i} <= t <= t_{n+1},
+   * which requires order*(order+1)/2 "macro" time steps, the OIF problem is integrated only once
+   * over t_{n-J+1} <= t <= t_{n+1}. The solution u(t_{n-k}) is added to the combined state when
+   * the sweep passes time level t_{n-k}:
+   *
+   *   time t
+   *  -------->   t_{n-2}   t_{n-1}   t_{n}     t_{n+1}
+   *  _______________|_________|________|___________|___________\
+   *                 |         |        |           |           /
+   *                 k=2       k=1       k=0
+   *                 +---------+--------+---------->+
+   *                 ^         ^        ^
+   *              add u_2   add u_1   add u_0
+   *
+   * The combined state is normalized by the partial sum of the weights alpha_i of all terms added
+   * so far, i.e., it is an affine combination of the propagated solutions. Since the OIF transport
+   * problem with prescribed/interpolated velocity is affine in the transported quantity (including
+   * the contributions of inhomogeneous boundary conditions) and since explicit Runge-Kutta methods
+   * preserve this property, the result equals the one of the standard algorithm up to round-off.
+   */
+
+  // skip history terms with weight zero (e.g. when starting with low order)
+  int i_start = order - 1;
+  while(i_start > 0 && std::abs(this->bdf.get_alpha(i_start)) < eps)
+    --i_start;
+
+  double sum_alpha = 0.0;
+  for(int k = i_start; k >= 0; --k)
+  {
+    double const alpha_k = this->bdf.get_alpha(k);
+
+    // add u(t_{n-k}) to the combined state
+    if(k == i_start)
+    {
+      initialize_solution_oif_substepping(solution_tilde_m, k);
+    }
+    else
+    {
+      initialize_solution_oif_substepping(solution_n_k, k);
+
+      AssertThrow(std::abs(sum_alpha + alpha_k) > eps,
+                  ExcMessage("Single-sweep OIF substepping failed due to vanishing partial sum "
+                             "of BDF coefficients."));
+
+      solution_tilde_m.sadd(sum_alpha / (sum_alpha + alpha_k),
+                            alpha_k / (sum_alpha + alpha_k),
+                            solution_n_k);
+    }
+    sum_alpha += alpha_k;
+
+    // integrate over interval: t_{n-k} <= t <= t_{n-k+1}
+
+    // calculate start time t_{n-k}
+    double const time_n_k = this->get_previous_time(k);
+
+    // number of sub-steps per "macro" time step
+    int const M = get_number_of_oif_substeps(cfl, cfl_oif);
+
+    // calculate sub-stepping time step size delta_s
+    double const delta_s = this->get_time_step_size(k) / (double)M;
+
+    for(int m = 0; m < M; ++m)
+    {
+      do_timestep_oif_substepping(solution_tilde_mp,
+                                  solution_tilde_m,
+                                  time_n_k + delta_s * m,
+                                  delta_s);
+
+      solution_tilde_mp.swap(solution_tilde_m);
+    }
+  }
+
+  // The function update_sum_alphai_ui_oif_substepping() scales the vector by alpha_0, while the
+  // normalized combined state has to be scaled by the sum of all weights.
+  solution_tilde_m *= sum_alpha / this->bdf.get_alpha(0);
+  update_sum_alphai_ui_oif_substepping(sum_alphai_ui, solution_tilde_m, 0);
+}
+
+template<typename Number>
+int
+TimeIntBDFBase<Number>::get_number_of_oif_substeps(double const cfl, double const cfl_oif) const
+{
+  int M = (int)(cfl / (cfl_oif - eps));
+
+  AssertThrow(M >= 1, ExcMessage("Invalid parameters cfl and cfl_oif."));
+
+  // make sure that cfl_oif is not violated
+  if(cfl_oif < cfl / double(M) - eps)
+    M += 1;
+
+  return M;
+}
+
+template<typename Number>
+void
+TimeIntBDFBase<Number>::do_read_restart(RestartArchiveIn & archive)
+{
+  {
+    boost::archive::binary_iarchive ia(archive.preamble());
+    read_restart_preamble(ia);
+  }
+
+  read_restart_vectors(archive);
 
   // In order to change the CFL number (or the time step calculation criterion in general),
   // start_with_low_order = true has to be used. Otherwise, the old solutions would not fit the
@@ -370,64 +471,47 @@ TimeIntBDFBase<Number>::read_restart_preamble(boost::archive::binary_iarchive &
 {
   // Note that the operations done here must be in sync with the output.
 
-  // 1. ranks
-  unsigned int n_old_ranks = 1;
-  ia &         n_old_ranks;
-
-  unsigned int n_ranks = Utilities::MPI::n_mpi_processes(mpi_comm);
-  AssertThrow(n_old_ranks == n_ranks,
-              ExcMessage("Tried to restart with " + Utilities::to_string(n_ranks) +
-                         " processes, "
-                         "but restart was written on " +
-                         Utilities::to_string(n_old_ranks) + " processes."));
-
-  // 2. time
+  // 1. time
   ia & time;
 
   // Note that start_time has to be set to the new start_time (since param.start_time might still be
   // the original start time).
   this->start_time = time;
 
-  // 3. order
+  // 2. order
   unsigned int old_order = 1;
   ia &         old_order;
 
   AssertThrow(old_order == order, ExcMessage("Order of time integrator may not change."));
 
-  // 4. time step sizes
+  // 3. time step sizes
   for(unsigned int i = 0; i < order; i++)
     ia & time_steps[i];
 }
 
 template<typename Number>
 void
-TimeIntBDFBase<Number>::do_write_restart(std::string const & filename) const
+TimeIntBDFBase<Number>::do_write_restart(RestartArchiveOut & archive) const
 {
-  std::ostringstream oss;
-
-  boost::archive::binary_oarchive oa(oss);
+  {
+    boost::archive::binary_oarchive oa(archive.preamble());
+    write_restart_preamble(oa);
+  }
 
-  write_restart_preamble(oa);
-  write_restart_vectors(oa);
-  write_restart_file(oss, filename);
+  write_restart_vectors(archive);
 }
 
 template<typename Number>
 void
 TimeIntBDFBase<Number>::write_restart_preamble(boost::archive::binary_oarchive & oa) const
 {
-  unsigned int n_ranks = Utilities::MPI::n_mpi_processes(mpi_comm);
-
-  // 1. ranks
-  oa & n_ranks;
-
-  // 2. time
+  // 1. time
   oa & time;
 
-  // 3. order
+  // 2. order
   oa & order;
 
-  // 4. time step sizes
+  // 3. time step sizes
   for(unsigned int i = 0; i < order; i++)
     oa & time_steps[i];
 }
@@ -140,6 +140,16 @@ protected:
                                           double const cfl,
                                           double const cfl_oif);
 
+  /*
+   * Variant of the OIF sub-stepping algorithm that integrates all history terms in a single sweep,
+   * so that the number of sub-steps grows linearly instead of quadratically with the order of the
+   * BDF scheme. Requires the OIF operator to be affine in the transported quantity.
+   */
+  void
+  calculate_sum_alphai_ui_oif_substepping_single_sweep(VectorType & sum_alphai_ui,
+                                                       double const cfl,
+                                                       double const cfl_oif);
+
   /*
    * Calculate time step size.
    */
@@ -242,26 +252,30 @@ private:
    * Restart: read solution vectors (has to be implemented in derived classes).
    */
   void
-  do_read_restart(std::ifstream & in);
+  do_read_restart(RestartArchiveIn & archive);
 
   void
   read_restart_preamble(boost::archive::binary_iarchive & ia);
 
+  /*
+   * The vectors have to be written with write_restart_vector() and read with
+   * read_restart_vector() in the same order (both are collective operations).
+   */
   virtual void
-  read_restart_vectors(boost::archive::binary_iarchive & ia) = 0;
+  read_restart_vectors(RestartArchiveIn & archive) = 0;
 
   /*
    * Write solution vectors to files so that the simulation can be restart from an intermediate
    * state.
    */
   void
-  do_write_restart(std::string const & filename) const;
+  do_write_restart(RestartArchiveOut & archive) const;
 
   void
   write_restart_preamble(boost::archive::binary_oarchive & oa) const;
 
   virtual void
-  write_restart_vectors(boost::archive::binary_oarchive & oa) const = 0;
+  write_restart_vectors(RestartArchiveOut & archive) const = 0;
 
   /*
    * Recalculate the time step size after each time step in case of adaptive time stepping.
@@ -295,6 +309,12 @@ private:
    */
   virtual bool
   print_solver_info() const = 0;
+
+  /*
+   * Number of OIF sub-steps per "macro" time step such that cfl_oif is not violated.
+   */
+  int
+  get_number_of_oif_substeps(double const cfl, double const cfl_oif) const;
 };
 
 } // namespace ExaDG
@@ -20,6 +20,7 @@
  */
 
 #include <exadg/time_integration/time_int_explicit_runge_kutta_base.h>
+#include <exadg/time_integration/time_step_calculation.h>
 
 namespace ExaDG
 {
@@ -31,6 +32,7 @@ TimeIntExplRKBase<Number>::TimeIntExplRKBase(double const &      start_time_,
                                              unsigned int const  max_number_of_time_steps_,
                                              RestartData const & restart_data_,
                                              bool const          adaptive_time_stepping_,
+                                             bool const          error_control_,
                                              MPI_Comm const &    mpi_comm_,
                                              bool const          print_wall_times_)
   : TimeIntBase(start_time_,
@@ -40,7 +42,11 @@ TimeIntExplRKBase<Number>::TimeIntExplRKBase(double const &      start_time_,
                 mpi_comm_,
                 print_wall_times_),
     time_step(1.0),
-    adaptive_time_stepping(adaptive_time_stepping_)
+    adaptive_time_stepping(adaptive_time_stepping_),
+    error_control(error_control_),
+    time_step_error_control(1.0),
+    error_last(1.0),
+    n_rejected_steps(0)
 {
 }
 
@@ -110,7 +116,8 @@ TimeIntExplRKBase<Number>::do_timestep_post_solve()
     this->time_step = recalculate_time_step_size();
   }
 
-  if(this->restart_data.write_restart == true)
+  if(this->restart_data.write_restart == true ||
+     this->restart_data.write_checkpoint_in_memory == true)
   {
     this->write_restart();
   }
@@ -121,6 +128,83 @@ TimeIntExplRKBase<Number>::do_timestep_post_solve()
   }
 }
 
+template<typename Number>
+void
+TimeIntExplRKBase<Number>::solve_timestep_error_controlled(
+  std::function<void(VectorType &, VectorType &, VectorType &)> const & solve_timestep_embedded,
+  unsigned int const                                                  order,
+  ErrorControlData const &                                            data)
+{
+  if(!solution_backup.partitioners_are_globally_compatible(*solution_n.get_partitioner()))
+  {
+    solution_backup.reinit(solution_n, true);
+    error_estimate.reinit(solution_n, true);
+  }
+
+  n_rejected_steps = 0;
+
+  while(true)
+  {
+    solution_backup = solution_n;
+
+    solve_timestep_embedded(solution_np, solution_n, error_estimate);
+
+    double const error =
+      calculate_scaled_error_norm(error_estimate, solution_backup, solution_np, data);
+
+    if(error <= 1.0)
+    {
+      time_step_error_control = calculate_time_step_pi_controller(
+        time_step, error, error_last, order, data.safety_factor, data.max_factor);
+
+      error_last = error;
+
+      break;
+    }
+
+    // reject time step and repeat it with a smaller time step size (note that a NaN error also
+    // ends up here)
+    ++n_rejected_steps;
+
+    AssertThrow(n_rejected_steps <= data.max_rejected_steps,
+                ExcMessage("Maximum number of rejected time steps exceeded. The time step "
+                           "size controller failed to find an acceptable time step size."));
+
+    solution_n.swap(solution_backup);
+
+    time_step = std::min(time_step,
+                         calculate_time_step_pi_controller(
+                           time_step, error, 1.0, order, data.safety_factor, data.max_factor));
+  }
+
+  // do not step over the end time
+  double const remaining_time = end_time - (time + time_step);
+  if(remaining_time > eps)
+    time_step_error_control = std::min(time_step_error_control, remaining_time);
+}
+
+template<typename Number>
+double
+TimeIntExplRKBase<Number>::calculate_scaled_error_norm(VectorType const &       error,
+                                                       VectorType const &       solution_old,
+                                                       VectorType const &       solution_new,
+                                                       ErrorControlData const & data) const
+{
+  double sum = 0.0;
+  for(unsigned int i = 0; i < error.local_size(); ++i)
+  {
+    double const scale =
+      data.abs_tol + data.rel_tol * std::max(std::abs(solution_old.local_element(i)),
+                                             std::abs(solution_new.local_element(i)));
+    double const e = error.local_element(i) / scale;
+    sum += e * e;
+  }
+
+  sum = Utilities::MPI::sum(sum, this->mpi_comm);
+
+  return std::sqrt(sum / error.size());
+}
+
 template<typename Number>
 void
 TimeIntExplRKBase<Number>::prepare_vectors_for_next_timestep()
@@ -131,60 +215,59 @@ TimeIntExplRKBase<Number>::prepare_vectors_for_next_timestep()
 
 template<typename Number>
 void
-TimeIntExplRKBase<Number>::do_write_restart(std::string const & filename) const
+TimeIntExplRKBase<Number>::do_write_restart(RestartArchiveOut & archive) const
 {
-  std::ostringstream oss;
-
-  boost::archive::binary_oarchive oa(oss);
-
-  unsigned int n_ranks = Utilities::MPI::n_mpi_processes(this->mpi_comm);
+  {
+    boost::archive::binary_oarchive oa(archive.preamble());
 
-  // 1. ranks
-  oa & n_ranks;
+    // 1. time
+    oa & time;
 
-  // 2. time
-  oa & time;
+    // 2. time step size
+    oa & time_step;
 
-  // 3. time step size
-  oa & time_step;
+    // 3. state of the time step size controller
+    if(error_control)
+    {
+      oa & time_step_error_control;
+      oa & error_last;
+    }
+  }
 
   // 4. solution vectors
-  oa << solution_n;
-
-  write_restart_file(oss, filename);
+  write_restart_vectors(archive);
 }
 
 template<typename Number>
 void
-TimeIntExplRKBase<Number>::do_read_restart(std::ifstream & in)
+TimeIntExplRKBase<Number>::do_read_restart(RestartArchiveIn & archive)
 {
-  boost::archive::binary_iarchive ia(in);
-
-  // Note that the operations done here must be in sync with the output.
+  {
+    boost::archive::binary_iarchive ia(archive.preamble());
 
-  // 1. ranks
-  unsigned int n_old_ranks = 1;
-  ia &         n_old_ranks;
+    // Note that the operations done here must be in sync with the output.
 
-  unsigned int n_ranks = Utilities::MPI::n_mpi_processes(this->mpi_comm);
-  AssertThrow(n_old_ranks == n_ranks,
-              ExcMessage("Tried to restart with " + Utilities::to_string(n_ranks) +
-                         " processes, "
-                         "but restart was written on " +
-                         Utilities::to_string(n_old_ranks) + " processes."));
+    // 1. time
+    ia & time;
 
-  // 2. time
-  ia & time;
+    // Note that start_time has to be set to the new start_time (since param.start_time might still
+    // be the original start time).
+    this->start_time = time;
 
-  // Note that start_time has to be set to the new start_time (since param.start_time might still be
-  // the original start time).
-  this->start_time = time;
+    // 2. time step size
+    ia & time_step;
 
-  // 3. time step size
-  ia & time_step;
+    // 3. state of the time step size controller
+    if(error_control)
+    {
+      ia & time_step_error_control;
+      ia & error_last;
+    }
+  }
 
-  // 4. solution vectors
-  ia >> solution_n;
+  // 4. solution vectors (the number of processes may change, since the vectors are stored in a
+  // partition-independent format)
+  read_restart_vectors(archive);
 }
 
 // instantiations
@@ -22,10 +22,14 @@
 #ifndef INCLUDE_EXADG_TIME_INTEGRATION_TIME_INT_EXPLICIT_RUNGE_KUTTA_BASE_H_
 #define INCLUDE_EXADG_TIME_INTEGRATION_TIME_INT_EXPLICIT_RUNGE_KUTTA_BASE_H_
 
+// C/C++
+#include <functional>
+
 // deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
+#include <exadg/time_integration/error_control_data.h>
 #include <exadg/time_integration/time_int_base.h>
 
 namespace ExaDG
@@ -43,6 +47,7 @@ public:
                     unsigned int const  max_number_of_time_steps_,
                     RestartData const & restart_data_,
                     bool const          adaptive_time_stepping_,
+                    bool const          error_control_,
                     MPI_Comm const &    mpi_comm_,
                     bool const          print_wall_times_);
 
@@ -65,7 +70,38 @@ protected:
   // use adaptive time stepping?
   bool const adaptive_time_stepping;
 
+  // adaptive time stepping based on the error estimate of an embedded Runge-Kutta method?
+  bool const error_control;
+
+  /*
+   * Performs a time step with step size control based on the error estimate of an embedded
+   * Runge-Kutta method. If the scaled error exceeds 1, the time step is rejected and repeated
+   * with a smaller time step size. After an accepted time step, the time step size for the next
+   * time step is computed by a PI controller and stored in time_step_error_control. The function
+   * solve_timestep_embedded(dst, src, error) performs one step with the current time step size.
+   */
+  void
+  solve_timestep_error_controlled(
+    std::function<void(VectorType &, VectorType &, VectorType &)> const & solve_timestep_embedded,
+    unsigned int const                                                  order,
+    ErrorControlData const &                                            data);
+
+  // time step size for the next time step proposed by the error controller
+  double time_step_error_control;
+
+  // scaled error norm of the last accepted time step (needed by the PI controller)
+  double error_last;
+
+  // number of rejected steps in the current time step
+  unsigned int n_rejected_steps;
+
 private:
+  double
+  calculate_scaled_error_norm(VectorType const &       error,
+                              VectorType const &       solution_old,
+                              VectorType const &       solution_new,
+                              ErrorControlData const & data) const;
+
   void
   do_timestep_pre_solve(bool const print_header);
 
@@ -97,10 +133,24 @@ private:
   print_solver_info() const = 0;
 
   void
-  do_write_restart(std::string const & filename) const override;
+  do_write_restart(RestartArchiveOut & archive) const override;
 
   void
-  do_read_restart(std::ifstream & in) override;
+  do_read_restart(RestartArchiveIn & archive) override;
+
+  /*
+   * The solution vector has to be written with write_restart_vector() and read with
+   * read_restart_vector(), which requires the DoFHandler of the PDE operator.
+   */
+  virtual void
+  write_restart_vectors(RestartArchiveOut & archive) const = 0;
+
+  virtual void
+  read_restart_vectors(RestartArchiveIn & archive) = 0;
+
+  // the low-storage Runge-Kutta schemes overwrite the old solution, which therefore has to be
+  // stored to be able to repeat rejected time steps
+  VectorType solution_backup, error_estimate;
 };
 
 } // namespace ExaDG
@@ -124,6 +124,26 @@ TimeIntGenAlphaBase<Number>::compute_const_vector(VectorType &       const_vecto
   const_vector.add(factor_acc, acceleration_n);
 }
 
+template<typename Number>
+void
+TimeIntGenAlphaBase<Number>::predict_displacement(VectorType &       displacement_np,
+                                                  unsigned int const order,
+                                                  VectorType const & displacement_n,
+                                                  VectorType const & velocity_n,
+                                                  VectorType const & acceleration_n) const
+{
+  AssertThrow(order <= 2, ExcMessage("Predictor only implemented for order <= 2."));
+
+  // d_{n+1-alpha_f} = d_n + (1 - alpha_f) * (d_{n+1} - d_n)
+  displacement_np = displacement_n;
+
+  if(order >= 1)
+    displacement_np.add((1.0 - alpha_f) * time_step, velocity_n);
+
+  if(order >= 2)
+    displacement_np.add((1.0 - alpha_f) * 0.5 * time_step * time_step, acceleration_n);
+}
+
 template<typename Number>
 void
 TimeIntGenAlphaBase<Number>::update_displacement(VectorType &       displacement_np,
@@ -180,7 +200,8 @@ TimeIntGenAlphaBase<Number>::do_timestep_post_solve()
   ++this->time_step_number;
 
   // restart
-  if(this->restart_data.write_restart == true)
+  if(this->restart_data.write_restart == true ||
+     this->restart_data.write_checkpoint_in_memory == true)
   {
     this->write_restart();
   }
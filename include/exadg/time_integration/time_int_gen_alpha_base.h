@@ -67,6 +67,18 @@ protected:
                        VectorType const & velocity_n,
                        VectorType const & acceleration_n) const;
 
+  /*
+   * Predicts the displacement d_{n+1-alpha_f} (the unknown of the system of equations solved in
+   * each time step) by a Taylor expansion of order 0 (constant displacement), 1 (constant
+   * velocity), or 2 (constant acceleration) of the displacement d_{n+1} around t_n.
+   */
+  void
+  predict_displacement(VectorType &       displacement_np,
+                       unsigned int const order,
+                       VectorType const & displacement_n,
+                       VectorType const & velocity_n,
+                       VectorType const & acceleration_n) const;
+
   void
   update_displacement(VectorType & displacement_np, VectorType const & displacement_n) const;
 
@@ -24,7 +24,9 @@
 
 // deal.II
 #include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
 
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
@@ -63,6 +65,36 @@ adjust_time_step_to_hit_end_time(double const start_time,
   return (end_time - start_time) / (1 + int((end_time - start_time) / time_step));
 }
 
+/*
+ * PI controller for the time step size of embedded Runge-Kutta methods, see Hairer & Wanner,
+ * "Solving ordinary differential equations II", Section IV.2. The arguments error and error_last
+ * are the scaled norms of the local error estimate of the current and the previous time step
+ * (a time step is accepted if error <= 1), and order is the order of the main method, i.e., the
+ * local error estimate behaves like time_step^order. The change of the time step size is limited
+ * to the interval [1/max_factor, max_factor].
+ */
+inline double
+calculate_time_step_pi_controller(double const       time_step,
+                                  double const       error,
+                                  double const       error_last,
+                                  unsigned int const order,
+                                  double const       safety_factor,
+                                  double const       max_factor)
+{
+  double const alpha = 0.7 / order;
+  double const beta  = 0.4 / order;
+
+  // avoid division by zero for (almost) exact solutions
+  double const error_min = 1.e-10;
+
+  double factor = safety_factor * std::pow(std::max(error, error_min), -alpha) *
+                  std::pow(std::max(error_last, error_min), beta);
+
+  factor = std::min(max_factor, std::max(1.0 / max_factor, factor));
+
+  return factor * time_step;
+}
+
 /*
  * This function calculates the time step size for a given time step size and a specified number of
  * refinements, where the time step size is reduced by a factor of 2 for each refinement level.
@@ -98,7 +130,9 @@ calculate_time_step_max_efficiency(double const       c_eff,
 
 /*
  * This function calculates the maximum velocity for a given velocity field (which is known
- * analytically). The maximum value is defined as the maximum velocity at the cell center.
+ * analytically). The maximum value is defined as the maximum velocity at the cell center. The
+ * velocity is evaluated for all cell centers of the current process with a single call of
+ * Function::vector_value_list() instead of dim calls of Function::value() per cell.
  */
 template<int dim>
 inline double
@@ -107,29 +141,22 @@ calculate_max_velocity(Triangulation<dim> const &     triangulation,
                        double const                   time,
                        MPI_Comm const &               mpi_comm)
 {
-  typename Triangulation<dim>::active_cell_iterator cell = triangulation.begin_active(),
-                                                    endc = triangulation.end();
-
-  double U = 0.0, max_U = std::numeric_limits<double>::min();
-
-  Tensor<1, dim, double> vel;
-  velocity->set_time(time);
-
-  for(; cell != endc; ++cell)
+  std::vector<Point<dim>> points;
+  points.reserve(triangulation.n_active_cells());
+  for(auto const & cell : triangulation.active_cell_iterators())
   {
     if(cell->is_locally_owned())
-    {
-      // calculate maximum velocity
-      Point<dim> point = cell->center();
+      points.push_back(cell->center());
+  }
 
-      for(unsigned int d = 0; d < dim; ++d)
-        vel[d] = velocity->value(point, d);
+  std::vector<Vector<double>> values(points.size(), Vector<double>(dim));
+  velocity->set_time(time);
+  velocity->vector_value_list(points, values);
+
+  double max_U = std::numeric_limits<double>::min();
+  for(auto const & value : values)
+    max_U = std::max(max_U, value.l2_norm());
 
-      U = vel.norm();
-      if(U > max_U)
-        max_U = U;
-    }
-  }
   double const global_max_U = Utilities::MPI::max(max_U, mpi_comm);
 
   return global_max_U;
@@ -332,6 +359,131 @@ calculate_time_step_cfl_local(MatrixFree<dim, value_type> const &
   return new_time_step;
 }
 
+/*
+ * Calculates the time step size according to the local CFL criterion with a CFL number of 1 (and
+ * without the scaling with the polynomial degree) for each cell of the current cell batch of the
+ * integrator. The velocity values have to be evaluated in the quadrature points. This function is
+ * intended to be called within the cell loops of operators that evaluate the velocity anyway. The
+ * type of the CFL condition is a template argument so that it is resolved at compile time.
+ */
+template<CFLConditionType cfl_condition_type, int dim, typename Number>
+inline VectorizedArray<Number>
+calculate_time_step_cfl_cells(CellIntegrator<dim, dim, Number> const & integrator)
+{
+  VectorizedArray<Number> delta_t_cell =
+    make_vectorized_array<Number>(std::numeric_limits<Number>::max());
+
+  for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+  {
+    Tensor<1, dim, VectorizedArray<Number>> const u_x = integrator.get_value(q);
+    Tensor<1, dim, VectorizedArray<Number>> const ut_xi =
+      transpose(integrator.inverse_jacobian(q)) * u_x;
+
+    if(cfl_condition_type == CFLConditionType::VelocityNorm)
+    {
+      delta_t_cell = std::min(delta_t_cell, Number(1.0) / ut_xi.norm());
+    }
+    else if(cfl_condition_type == CFLConditionType::VelocityComponents)
+    {
+      for(unsigned int d = 0; d < dim; ++d)
+        delta_t_cell = std::min(delta_t_cell, Number(1.0) / std::abs(ut_xi[d]));
+    }
+  }
+
+  return delta_t_cell;
+}
+
+/*
+ * Same as calculate_time_step_cfl_cells(), but returns the minimum over the cell batch.
+ */
+template<CFLConditionType cfl_condition_type, int dim, typename Number>
+inline double
+calculate_time_step_cfl_cell_batch(CellIntegrator<dim, dim, Number> const & integrator)
+{
+  VectorizedArray<Number> const delta_t_cell =
+    calculate_time_step_cfl_cells<cfl_condition_type>(integrator);
+
+  // loop over vectorized array
+  double dt = std::numeric_limits<double>::max();
+  for(unsigned int v = 0; v < VectorizedArray<Number>::size(); ++v)
+    dt = std::min(dt, (double)delta_t_cell[v]);
+
+  return dt;
+}
+
+/*
+ * Computes the global minimum of a time step size with a non-blocking reduction, so that the
+ * communication overlaps with the computations performed until the result is needed.
+ */
+class NonBlockingMinimum
+{
+public:
+  NonBlockingMinimum()
+    : local_value(std::numeric_limits<double>::max()),
+      global_value(std::numeric_limits<double>::max()),
+      request(MPI_REQUEST_NULL)
+  {
+  }
+
+  ~NonBlockingMinimum()
+  {
+    // no exceptions in destructor
+    if(request != MPI_REQUEST_NULL)
+      MPI_Wait(&request, MPI_STATUS_IGNORE);
+  }
+
+  /*
+   * Starts the reduction of the given local value. A reduction that is still in progress is
+   * completed first.
+   */
+  void
+  start(double const value, MPI_Comm const & mpi_comm)
+  {
+    wait();
+
+    local_value = value;
+
+    int const ierr =
+      MPI_Iallreduce(&local_value, &global_value, 1, MPI_DOUBLE, MPI_MIN, mpi_comm, &request);
+    AssertThrowMPI(ierr);
+  }
+
+  /*
+   * Returns true if a reduction has been started and its result has not been obtained yet.
+   */
+  bool
+  is_active() const
+  {
+    return request != MPI_REQUEST_NULL;
+  }
+
+  /*
+   * Completes the reduction and returns the global minimum.
+   */
+  double
+  get()
+  {
+    wait();
+
+    return global_value;
+  }
+
+private:
+  void
+  wait()
+  {
+    if(request != MPI_REQUEST_NULL)
+    {
+      int const ierr = MPI_Wait(&request, MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+    }
+  }
+
+  double      local_value;
+  double      global_value;
+  MPI_Request request;
+};
+
 /*
  * this function computes the actual CFL number in each cell given a global time step size
  * (that holds for all cells)
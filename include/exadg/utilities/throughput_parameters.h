@@ -114,6 +114,16 @@ struct ThroughputParameters
                         "Number of runs (taking minimum wall time).",
                         Patterns::Integer(1,10),
                         true);
+      prm.add_parameter("TimeSteps",
+                        n_time_steps,
+                        "Number of time steps (only for measurements of complete time steps).",
+                        Patterns::Integer(1),
+                        false);
+      prm.add_parameter("SummaryFile",
+                        summary_file,
+                        "File to which a summary of the measurements is appended (only for measurements of complete time steps, disabled if empty).",
+                        Patterns::Anything(),
+                        false);
     prm.leave_subsection();
     // clang-format on
   }
@@ -131,6 +141,14 @@ struct ThroughputParameters
   unsigned int n_repetitions_inner = 100; // take the average of inner repetitions
   unsigned int n_repetitions_outer = 1;   // take the minimum of outer repetitions
 
+  // number of time steps for throughput measurements of complete time steps (including solver
+  // iterations and preconditioners) instead of single operator evaluations
+  unsigned int n_time_steps = 10;
+
+  // a summary of each measurement of complete time steps is appended to this file (one JSON
+  // object per line), no summary is written if empty
+  std::string summary_file = "";
+
   // global variable used to store the wall times for different polynomial degrees and problem sizes
   mutable std::vector<std::tuple<unsigned int, types::global_dof_index, double>> wall_times;
 };
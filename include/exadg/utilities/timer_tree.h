@@ -214,6 +214,25 @@ public:
     do_print_level(pcout, level, 0, length);
   }
 
+  /*
+   * Returns the wall times (accumulated on the current processor) of all direct children of this
+   * tree for which a wall time has been inserted, i.e. pairs of ID and wall time. Unlike the
+   * print functions, this function does not involve any communication.
+   */
+  std::vector<std::pair<std::string, double>>
+  get_wall_times_of_direct_children() const
+  {
+    std::vector<std::pair<std::string, double>> wall_times;
+
+    for(auto it = sub_trees.begin(); it != sub_trees.end(); ++it)
+    {
+      if((*it)->data.get())
+        wall_times.push_back(std::make_pair((*it)->id, (*it)->data->wall_time));
+    }
+
+    return wall_times;
+  }
+
 private:
   void
   copy_from(std::shared_ptr<TimerTree> other)
@@ -29,6 +29,9 @@
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
+// ExaDG
+#include <exadg/vector_tools/interpolate_solution.h>
+
 namespace ExaDG
 {
 using namespace dealii;
@@ -142,6 +145,138 @@ void evaluate_vectorial_quantity_in_point(
   solution_value /= (double)counter;
 }
 
+/*
+ * Evaluates a finite element solution in a fixed set of points. The search for the cells
+ * containing the points and the evaluation of the shape functions in these points is done only
+ * once when the solution is evaluated for the first time, i.e. subsequent evaluations only
+ * interpolate the solution from the cached data. The contributions of all processors are
+ * gathered by a single reduction over all points. Like evaluate_scalar_quantity_in_point() and
+ * evaluate_vectorial_quantity_in_point(), the result is averaged over all adjacent cells of a
+ * point.
+ */
+template<int dim, typename Number>
+class PointValueCache
+{
+public:
+  typedef LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  PointValueCache() : is_initialized(false)
+  {
+  }
+
+  void
+  setup(DoFHandler<dim> const &         dof_handler_in,
+        Mapping<dim> const &            mapping_in,
+        std::vector<Point<dim>> const & points_in,
+        MPI_Comm const &                mpi_comm_in,
+        double const                    tolerance_in = 1.e-10)
+  {
+    dof_handler = &dof_handler_in;
+    mapping     = &mapping_in;
+    points      = points_in;
+    mpi_comm    = mpi_comm_in;
+    tolerance   = tolerance_in;
+
+    // the cached data depends on the numbering of the vector entries and is therefore computed
+    // when evaluating the solution for the first time
+    is_initialized = false;
+  }
+
+  void
+  evaluate_scalar(std::vector<Number> & values, VectorType const & solution) const
+  {
+    initialize(solution);
+
+    values.resize(points.size());
+    for(unsigned int p = 0; p < points.size(); ++p)
+    {
+      values[p] = 0.0;
+      for(auto const & cell_data : cell_data_per_point[p])
+        values[p] += Interpolator<0, dim, Number>::value(*dof_handler,
+                                                         solution,
+                                                         cell_data.first,
+                                                         cell_data.second);
+    }
+
+    Utilities::MPI::sum(values, mpi_comm, values);
+
+    for(unsigned int p = 0; p < points.size(); ++p)
+      values[p] /= (Number)counter[p];
+  }
+
+  void
+  evaluate_vectorial(std::vector<Tensor<1, dim, Number>> & values,
+                     VectorType const &                    solution) const
+  {
+    initialize(solution);
+
+    values.resize(points.size());
+    for(unsigned int p = 0; p < points.size(); ++p)
+    {
+      values[p] = Tensor<1, dim, Number>();
+      for(auto const & cell_data : cell_data_per_point[p])
+        values[p] += Interpolator<1, dim, Number>::value(*dof_handler,
+                                                         solution,
+                                                         cell_data.first,
+                                                         cell_data.second);
+    }
+
+    if(points.size() > 0)
+      Utilities::MPI::sum(ArrayView<Number const>(&values[0][0], dim * values.size()),
+                          mpi_comm,
+                          ArrayView<Number>(&values[0][0], dim * values.size()));
+
+    for(unsigned int p = 0; p < points.size(); ++p)
+      values[p] /= (Number)counter[p];
+  }
+
+private:
+  void
+  initialize(VectorType const & solution) const
+  {
+    if(is_initialized)
+      return;
+
+    cell_data_per_point.resize(points.size());
+    counter.resize(points.size());
+
+    for(unsigned int p = 0; p < points.size(); ++p)
+    {
+      auto adjacent_cells = GridTools::find_all_active_cells_around_point(
+        *mapping, dof_handler->get_triangulation(), points[p], tolerance);
+
+      cell_data_per_point[p] =
+        get_dof_indices_and_shape_values(adjacent_cells, *dof_handler, *mapping, solution);
+
+      counter[p] = cell_data_per_point[p].size();
+    }
+
+    // parallel computations: number of adjacent cells of all processors
+    Utilities::MPI::sum(counter, mpi_comm, counter);
+
+    for(unsigned int p = 0; p < points.size(); ++p)
+      AssertThrow(counter[p] > 0, ExcMessage("No points found."));
+
+    is_initialized = true;
+  }
+
+  SmartPointer<DoFHandler<dim> const> dof_handler;
+  SmartPointer<Mapping<dim> const>    mapping;
+  std::vector<Point<dim>>             points;
+  MPI_Comm                            mpi_comm;
+  double                              tolerance;
+
+  mutable bool is_initialized;
+
+  // dof indices and shape values for all locally owned cells adjacent to a point
+  mutable std::vector<
+    std::vector<std::pair<std::vector<types::global_dof_index>, std::vector<Number>>>>
+    cell_data_per_point;
+
+  // number of adjacent cells of a point over all processors
+  mutable std::vector<unsigned int> counter;
+};
+
 } // namespace ExaDG
 
 #endif /* INCLUDE_VECTOR_TOOLS_POINT_VALUE_H_ */
@@ -0,0 +1,315 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <functional>
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/fe/mapping_q_generic.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/spatial_discretization/operator_dual_splitting.h>
+
+using namespace dealii;
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+typedef LinearAlgebra::distributed::Vector<double> VectorType;
+
+typedef IncNS::RhsPPEData<VectorType> RhsPPEData;
+
+typedef std::pair<types::boundary_id, std::shared_ptr<Function<dim>>> pair;
+
+/*
+ * Smooth time-dependent function used for all boundary conditions, body forces, and velocity
+ * fields. The parameter shift allows to generate different fields.
+ */
+class TestFunction : public Function<dim>
+{
+public:
+  TestFunction(unsigned int const n_components, double const shift)
+    : Function<dim>(n_components, 0.0), shift(shift)
+  {
+  }
+
+  double
+  value(Point<dim> const & p, unsigned int const component = 0) const override
+  {
+    double const t = this->get_time();
+
+    return (1.0 + component) * std::sin(numbers::PI * p[0] + shift) *
+           std::cos(numbers::PI * p[1] + component * shift) * (1.0 + t);
+  }
+
+private:
+  double const shift;
+};
+
+class SuppressOutput
+{
+public:
+  SuppressOutput() : buffer(std::cout.rdbuf(nullptr))
+  {
+  }
+
+  ~SuppressOutput()
+  {
+    std::cout.rdbuf(buffer);
+  }
+
+private:
+  std::streambuf * buffer;
+};
+
+/*
+ * Compares the right-hand side of the pressure Poisson equation evaluated in a single loop with
+ * the sum of the individual terms evaluated in separate loops as done before fusing all terms.
+ * The results are equal up to round-off errors, see OperatorDualSplitting::rhs_ppe().
+ */
+void
+test(bool const dirichlet_bc_from_dof_vector)
+{
+  MPI_Comm const mpi_comm = MPI_COMM_WORLD;
+
+  parallel::distributed::Triangulation<dim> triangulation(mpi_comm);
+  GridGenerator::hyper_cube(triangulation, 0.0, 1.0, true);
+  triangulation.refine_global(2);
+
+  MappingQGeneric<dim> mapping(3);
+
+  std::vector<GridTools::PeriodicFacePair<typename Triangulation<dim>::cell_iterator>>
+    periodic_faces;
+
+  // inflow/wall boundaries (velocity Dirichlet, pressure Neumann) on three sides and an outflow
+  // boundary (velocity Neumann, pressure Dirichlet) on the right
+  std::shared_ptr<IncNS::BoundaryDescriptorU<dim>> boundary_descriptor_velocity(
+    new IncNS::BoundaryDescriptorU<dim>());
+  std::shared_ptr<IncNS::BoundaryDescriptorP<dim>> boundary_descriptor_pressure(
+    new IncNS::BoundaryDescriptorP<dim>());
+
+  for(types::boundary_id const id : {0, 2, 3})
+  {
+    boundary_descriptor_velocity->dirichlet_bc.insert(pair(id, new TestFunction(dim, 0.0)));
+    boundary_descriptor_pressure->neumann_bc.insert(pair(id, new TestFunction(dim, 0.5)));
+  }
+  boundary_descriptor_velocity->neumann_bc.insert(pair(1, new Functions::ZeroFunction<dim>(dim)));
+  boundary_descriptor_pressure->dirichlet_bc.insert(pair(1, new TestFunction(1, 1.0)));
+
+  std::shared_ptr<IncNS::FieldFunctions<dim>> field_functions(new IncNS::FieldFunctions<dim>());
+  field_functions->initial_solution_velocity.reset(new Functions::ZeroFunction<dim>(dim));
+  field_functions->initial_solution_pressure.reset(new Functions::ZeroFunction<dim>(1));
+  field_functions->analytical_solution_pressure.reset(new Functions::ZeroFunction<dim>(1));
+  field_functions->right_hand_side.reset(new TestFunction(dim, 0.25));
+  field_functions->gravitational_force.reset(new Functions::ZeroFunction<dim>(dim));
+
+  IncNS::InputParameters param;
+  param.problem_type                   = IncNS::ProblemType::Unsteady;
+  param.equation_type                  = IncNS::EquationType::NavierStokes;
+  param.right_hand_side                = true;
+  param.viscosity                      = 1.0e-2;
+  param.solver_type                    = IncNS::SolverType::Unsteady;
+  param.temporal_discretization        = IncNS::TemporalDiscretization::BDFDualSplittingScheme;
+  param.treatment_of_convective_term   = IncNS::TreatmentOfConvectiveTerm::Explicit;
+  param.order_time_integrator          = 2;
+  param.triangulation_type             = TriangulationType::Distributed;
+  param.degree_p                       = IncNS::DegreePressure::MixedOrder;
+  param.mapping                        = MappingType::Isoparametric;
+  param.store_previous_boundary_values = dirichlet_bc_from_dof_vector;
+
+  std::shared_ptr<IncNS::OperatorDualSplitting<dim, double>> pde_operator;
+  {
+    SuppressOutput suppress_output;
+
+    pde_operator.reset(new IncNS::OperatorDualSplitting<dim, double>(
+      triangulation,
+      mapping,
+      3,
+      periodic_faces,
+      boundary_descriptor_velocity,
+      boundary_descriptor_pressure,
+      field_functions,
+      param,
+      "fluid",
+      mpi_comm));
+
+    std::shared_ptr<MatrixFreeData<dim, double>> matrix_free_data(
+      new MatrixFreeData<dim, double>());
+    pde_operator->fill_matrix_free_data(*matrix_free_data);
+
+    std::shared_ptr<MatrixFree<dim, double>> matrix_free(new MatrixFree<dim, double>());
+    matrix_free->reinit(mapping,
+                        matrix_free_data->get_dof_handler_vector(),
+                        matrix_free_data->get_constraint_vector(),
+                        matrix_free_data->get_quadrature_vector(),
+                        matrix_free_data->data);
+
+    pde_operator->setup(matrix_free, matrix_free_data);
+  }
+
+  // u_np, two previous velocities, two previous Dirichlet boundary values, and acceleration
+  std::vector<VectorType> velocities(6);
+  for(unsigned int i = 0; i < velocities.size(); ++i)
+  {
+    pde_operator->initialize_vector_velocity(velocities[i]);
+    VectorTools::interpolate(mapping,
+                             pde_operator->get_dof_handler_u(),
+                             TestFunction(dim, 0.1 * (i + 1)),
+                             velocities[i]);
+  }
+
+  VectorType vorticity;
+  pde_operator->initialize_vector_velocity(vorticity);
+  pde_operator->compute_vorticity(vorticity, velocities[1]);
+
+  double const time = 0.3;
+
+  // all terms evaluated in one loop
+  RhsPPEData data;
+  data.time                       = time;
+  data.velocity_np                = &velocities[0];
+  data.factor_div_term            = -15.0;
+  data.factors_div_term_dirichlet = {20.0, -5.0};
+  if(dirichlet_bc_from_dof_vector)
+    data.velocities_div_term_dirichlet = {&velocities[3], &velocities[4]};
+  else
+    data.times_div_term_dirichlet = {0.2, 0.1};
+  data.laplace_dirichlet           = true;
+  data.velocities                  = {&velocities[1], &velocities[2]};
+  data.factors_div_term_convective = {2.0, -1.0};
+  data.factors_nbc_convective      = {2.0, -1.0};
+  data.div_term_body_forces        = true;
+  data.nbc_body_forces             = true;
+  if(dirichlet_bc_from_dof_vector)
+    data.acceleration = &velocities[5];
+  else
+    data.nbc_analytical_time_derivative = true;
+  data.vorticity = &vorticity;
+
+  VectorType rhs_fused;
+  pde_operator->initialize_vector_pressure(rhs_fused);
+  pde_operator->rhs_ppe(rhs_fused, data);
+
+  // individual terms evaluated in separate loops
+  VectorType rhs, temp;
+  pde_operator->initialize_vector_pressure(rhs);
+  pde_operator->initialize_vector_pressure(temp);
+
+  pde_operator->apply_velocity_divergence_term(rhs, velocities[0]);
+  rhs *= data.factor_div_term;
+
+  for(unsigned int i = 0; i < data.factors_div_term_dirichlet.size(); ++i)
+  {
+    if(dirichlet_bc_from_dof_vector)
+      pde_operator->rhs_velocity_divergence_term_dirichlet_bc_from_dof_vector(
+        temp, *data.velocities_div_term_dirichlet[i]);
+    else
+      pde_operator->rhs_velocity_divergence_term(temp, data.times_div_term_dirichlet[i]);
+
+    rhs.add(data.factors_div_term_dirichlet[i], temp);
+  }
+
+  pde_operator->rhs_ppe_laplace_add(rhs, time);
+
+  auto add_single_term = [&](std::function<void(RhsPPEData &)> const & set_term) {
+    RhsPPEData single_term;
+    single_term.time = time;
+    set_term(single_term);
+
+    pde_operator->rhs_ppe(temp, single_term);
+    rhs += temp;
+  };
+
+  for(unsigned int i = 0; i < data.velocities.size(); ++i)
+  {
+    add_single_term([&](RhsPPEData & single_term) {
+      single_term.velocities                  = {data.velocities[i]};
+      single_term.factors_div_term_convective = {data.factors_div_term_convective[i]};
+      single_term.factors_nbc_convective      = {0.0};
+    });
+    add_single_term([&](RhsPPEData & single_term) {
+      single_term.velocities                  = {data.velocities[i]};
+      single_term.factors_div_term_convective = {0.0};
+      single_term.factors_nbc_convective      = {data.factors_nbc_convective[i]};
+    });
+  }
+
+  add_single_term([&](RhsPPEData & single_term) { single_term.div_term_body_forces = true; });
+  add_single_term([&](RhsPPEData & single_term) { single_term.nbc_body_forces = true; });
+  add_single_term([&](RhsPPEData & single_term) {
+    single_term.acceleration                   = data.acceleration;
+    single_term.nbc_analytical_time_derivative = data.nbc_analytical_time_derivative;
+  });
+  add_single_term([&](RhsPPEData & single_term) { single_term.vorticity = &vorticity; });
+
+  VectorType difference(rhs_fused);
+  difference -= rhs;
+
+  double const relative_difference = difference.linfty_norm() / rhs.linfty_norm();
+
+  std::cout << "Dirichlet boundary data from "
+            << (dirichlet_bc_from_dof_vector ? "dof vectors:" : "functions:") << std::endl;
+  std::cout << "  right-hand side: " << (relative_difference < 1.0e-12 ? "ok" : "wrong")
+            << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    deallog.depth_console(0);
+
+    test(false);
+    test(true);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
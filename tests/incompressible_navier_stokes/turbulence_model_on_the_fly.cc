@@ -0,0 +1,263 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/fe/mapping_q_generic.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/spatial_discretization/operator_pressure_correction.h>
+
+using namespace dealii;
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+typedef LinearAlgebra::distributed::Vector<double> VectorType;
+
+typedef IncNS::OperatorPressureCorrection<dim, double> Operator;
+
+typedef std::pair<types::boundary_id, std::shared_ptr<Function<dim>>> pair;
+
+/*
+ * Smooth velocity field used for the boundary conditions and the velocity at which the operators
+ * are evaluated.
+ */
+class Velocity : public Function<dim>
+{
+public:
+  Velocity() : Function<dim>(dim, 0.0)
+  {
+  }
+
+  double
+  value(Point<dim> const & p, unsigned int const component = 0) const override
+  {
+    if(component == 0)
+      return std::sin(numbers::PI * p[0]) * std::cos(numbers::PI * p[1]) + 0.5 * p[1] * p[1];
+    else
+      return -std::cos(numbers::PI * p[0]) * std::sin(numbers::PI * p[1]) + 0.25 * p[0];
+  }
+};
+
+class SuppressOutput
+{
+public:
+  SuppressOutput() : buffer(std::cout.rdbuf(nullptr))
+  {
+  }
+
+  ~SuppressOutput()
+  {
+    std::cout.rdbuf(buffer);
+  }
+
+private:
+  std::streambuf * buffer;
+};
+
+/*
+ * Evaluates the nonlinear residual (containing the viscous operator with the standard quadrature
+ * rule) and the linearized momentum operator for the given eddy viscosity model.
+ */
+void
+evaluate(VectorType &                             residual,
+         VectorType &                             momentum,
+         IncNS::TurbulenceEddyViscosityModel const model,
+         bool const                               on_the_fly,
+         IncNS::QuadratureRuleLinearization const quad_rule_linearization)
+{
+  MPI_Comm const mpi_comm = MPI_COMM_WORLD;
+
+  parallel::distributed::Triangulation<dim> triangulation(mpi_comm);
+  GridGenerator::hyper_cube(triangulation, 0.0, 1.0);
+  triangulation.refine_global(2);
+
+  MappingQGeneric<dim> mapping(1);
+
+  std::vector<GridTools::PeriodicFacePair<typename Triangulation<dim>::cell_iterator>>
+    periodic_faces;
+
+  std::shared_ptr<IncNS::BoundaryDescriptorU<dim>> boundary_descriptor_velocity(
+    new IncNS::BoundaryDescriptorU<dim>());
+  std::shared_ptr<IncNS::BoundaryDescriptorP<dim>> boundary_descriptor_pressure(
+    new IncNS::BoundaryDescriptorP<dim>());
+
+  boundary_descriptor_velocity->dirichlet_bc.insert(pair(0, new Velocity()));
+  boundary_descriptor_pressure->neumann_bc.insert(pair(0, new Functions::ZeroFunction<dim>(dim)));
+
+  std::shared_ptr<IncNS::FieldFunctions<dim>> field_functions(new IncNS::FieldFunctions<dim>());
+  field_functions->initial_solution_velocity.reset(new Functions::ZeroFunction<dim>(dim));
+  field_functions->initial_solution_pressure.reset(new Functions::ZeroFunction<dim>(1));
+  field_functions->analytical_solution_pressure.reset(new Functions::ZeroFunction<dim>(1));
+  field_functions->right_hand_side.reset(new Functions::ZeroFunction<dim>(dim));
+  field_functions->gravitational_force.reset(new Functions::ZeroFunction<dim>(dim));
+
+  IncNS::InputParameters param;
+  param.problem_type                 = IncNS::ProblemType::Unsteady;
+  param.equation_type                = IncNS::EquationType::NavierStokes;
+  param.viscosity                    = 1.0e-3;
+  param.solver_type                  = IncNS::SolverType::Unsteady;
+  param.temporal_discretization      = IncNS::TemporalDiscretization::BDFPressureCorrection;
+  param.treatment_of_convective_term = IncNS::TreatmentOfConvectiveTerm::Implicit;
+  param.order_time_integrator        = 2;
+  param.triangulation_type           = TriangulationType::Distributed;
+  param.degree_p                     = IncNS::DegreePressure::MixedOrder;
+  param.mapping                      = MappingType::Affine;
+  param.quad_rule_linearization      = quad_rule_linearization;
+  param.use_turbulence_model         = true;
+  param.turbulence_model             = model;
+  param.turbulence_model_constant    = 0.5;
+  param.turbulence_model_on_the_fly  = on_the_fly;
+
+  std::shared_ptr<Operator> pde_operator;
+  {
+    SuppressOutput suppress_output;
+
+    pde_operator.reset(new Operator(triangulation,
+                                    mapping,
+                                    3,
+                                    periodic_faces,
+                                    boundary_descriptor_velocity,
+                                    boundary_descriptor_pressure,
+                                    field_functions,
+                                    param,
+                                    "fluid",
+                                    mpi_comm));
+
+    std::shared_ptr<MatrixFreeData<dim, double>> matrix_free_data(
+      new MatrixFreeData<dim, double>());
+    pde_operator->fill_matrix_free_data(*matrix_free_data);
+
+    std::shared_ptr<MatrixFree<dim, double>> matrix_free(new MatrixFree<dim, double>());
+    matrix_free->reinit(mapping,
+                        matrix_free_data->get_dof_handler_vector(),
+                        matrix_free_data->get_constraint_vector(),
+                        matrix_free_data->get_quadrature_vector(),
+                        matrix_free_data->data);
+
+    pde_operator->setup(matrix_free, matrix_free_data);
+  }
+
+  VectorType velocity, rhs;
+  pde_operator->initialize_vector_velocity(velocity);
+  pde_operator->initialize_vector_velocity(rhs);
+  pde_operator->initialize_vector_velocity(residual);
+  pde_operator->initialize_vector_velocity(momentum);
+
+  VectorTools::interpolate(mapping, pde_operator->get_dof_handler_u(), Velocity(), velocity);
+
+  pde_operator->update_turbulence_model(velocity);
+
+  pde_operator->evaluate_nonlinear_residual(residual, velocity, &rhs, 0.0, 1.0);
+
+  pde_operator->set_velocity_ptr(velocity);
+  pde_operator->apply_momentum_operator(momentum, velocity);
+}
+
+/*
+ * Compares the eddy viscosity evaluated on the fly in the quadrature points of the operators with
+ * the eddy viscosity read from the precomputed tables. The results are equal up to round-off
+ * errors for the standard quadrature rule. With over-integration of the linearized momentum
+ * operator, the eddy viscosity is evaluated in the quadrature points of the momentum operator,
+ * which is only possible on the fly, and the results differ by the quadrature error.
+ */
+void
+test(IncNS::TurbulenceEddyViscosityModel const model)
+{
+  VectorType residual_table, momentum_table;
+  evaluate(residual_table,
+           momentum_table,
+           model,
+           false,
+           IncNS::QuadratureRuleLinearization::Standard);
+
+  VectorType residual, momentum;
+  evaluate(residual, momentum, model, true, IncNS::QuadratureRuleLinearization::Standard);
+
+  auto const relative_difference = [](VectorType const & vector, VectorType const & reference) {
+    VectorType difference(vector);
+    difference -= reference;
+    return difference.l2_norm() / reference.l2_norm();
+  };
+
+  bool const residual_ok = relative_difference(residual, residual_table) < 1.0e-12;
+  bool const momentum_ok = relative_difference(momentum, momentum_table) < 1.0e-12;
+
+  evaluate(residual, momentum, model, true, IncNS::QuadratureRuleLinearization::Overintegration32k);
+
+  bool const residual_overintegration_ok = relative_difference(residual, residual_table) < 1.0e-12;
+  bool const momentum_overintegration_ok = relative_difference(momentum, momentum_table) < 1.0e-2;
+
+  std::cout << IncNS::enum_to_string(model) << ":" << std::endl;
+  std::cout << "  nonlinear residual: " << (residual_ok ? "ok" : "wrong") << std::endl;
+  std::cout << "  momentum operator: " << (momentum_ok ? "ok" : "wrong") << std::endl;
+  std::cout << "  nonlinear residual (over-integration): "
+            << (residual_overintegration_ok ? "ok" : "wrong") << std::endl;
+  std::cout << "  momentum operator (over-integration): "
+            << (momentum_overintegration_ok ? "ok" : "wrong") << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    deallog.depth_console(0);
+
+    test(IncNS::TurbulenceEddyViscosityModel::Smagorinsky);
+    test(IncNS::TurbulenceEddyViscosityModel::Vreman);
+    test(IncNS::TurbulenceEddyViscosityModel::WALE);
+    test(IncNS::TurbulenceEddyViscosityModel::Sigma);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,155 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/spatial_discretization/operators/wall_model_kernel.h>
+
+using namespace dealii;
+using namespace ExaDG;
+
+unsigned int const dim = 3;
+
+typedef VectorizedArray<double>                 scalar;
+typedef Tensor<1, dim, VectorizedArray<double>> vector;
+
+/*
+ * Law of the wall by Spalding, which defines y^+ explicitly as a function of u^+.
+ */
+double
+get_y_plus(double const u_plus, double const kappa, double const B)
+{
+  double const k_u = kappa * u_plus;
+
+  return u_plus + std::exp(-kappa * B) *
+                    (std::exp(k_u) - 1.0 - k_u - 0.5 * k_u * k_u - k_u * k_u * k_u / 6.0);
+}
+
+/*
+ * Prescribes the friction velocity u_tau and the values of u^+ in the viscous sublayer, the
+ * buffer layer, and the logarithmic layer. The tangential velocity and the wall distance are
+ * computed from the law of the wall, and the friction velocity obtained by the Newton solver of the
+ * wall model has to agree with the prescribed one.
+ */
+void
+test(IncNS::WallModelData const & data)
+{
+  double const u_tau     = 0.05;
+  double const viscosity = 1.e-5;
+
+  std::vector<double> const u_plus = {0.5, 5.0, 12.0, 20.0, 28.0};
+
+  bool success = true;
+
+  for(unsigned int i = 0; i < u_plus.size(); i += scalar::size())
+  {
+    vector velocity_tangential;
+    scalar wall_distance = make_vectorized_array<double>(1.0);
+    for(unsigned int v = 0; v < scalar::size() && i + v < u_plus.size(); ++v)
+    {
+      double const y_plus = get_y_plus(u_plus[i + v], data.kappa, data.B);
+
+      // tangential velocity in a direction that is not aligned with the coordinate axes
+      velocity_tangential[0][v] = 0.6 * u_plus[i + v] * u_tau;
+      velocity_tangential[1][v] = 0.8 * u_plus[i + v] * u_tau;
+      wall_distance[v]          = y_plus * viscosity / u_tau;
+    }
+
+    IncNS::Operators::WallModelKernel<dim, double> kernel;
+    kernel.reinit(data);
+
+    vector const wall_shear_stress =
+      kernel.calculate_wall_shear_stress(velocity_tangential,
+                                         wall_distance,
+                                         make_vectorized_array<double>(viscosity));
+
+    for(unsigned int v = 0; v < scalar::size() && i + v < u_plus.size(); ++v)
+    {
+      Tensor<1, dim> tau, velocity;
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        tau[d]      = wall_shear_stress[d][v];
+        velocity[d] = velocity_tangential[d][v];
+      }
+
+      // the wall shear stress -u_tau^2 * u_t / |u_t| acts against the tangential velocity
+      double const u_tau_wall_model = std::sqrt(tau.norm());
+      double const direction        = tau * velocity / (tau.norm() * velocity.norm());
+
+      if(std::abs(u_tau_wall_model - u_tau) > 1.e-8 * u_tau || std::abs(direction + 1.0) > 1.e-12)
+        success = false;
+    }
+  }
+
+  std::cout << "kappa = " << data.kappa << ", B = " << data.B << ":" << std::endl;
+  std::cout << "  friction velocity: " << (success ? "ok" : "wrong") << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    deallog.depth_console(0);
+
+    IncNS::WallModelData data;
+    test(data);
+
+    data.kappa          = 0.4;
+    data.B              = 5.5;
+    data.max_iterations = 50;
+    data.tolerance      = 1.e-12;
+    test(data);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
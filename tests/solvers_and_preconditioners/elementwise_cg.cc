@@ -0,0 +1,322 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                        HEADER                                      */
+/*                                                                                    */
+/**************************************************************************************/
+
+// C++
+#include <cmath>
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/vectorization.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/preconditioner/elementwise_preconditioners.h>
+#include <exadg/solvers_and_preconditioners/solvers/elementwise_krylov_solvers.h>
+
+namespace ExaDG
+{
+using namespace dealii;
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                   PARAMETERS                                       */
+/*                                                                                    */
+/**************************************************************************************/
+unsigned int const M = 3;
+
+
+/*
+ * Dense matrix counting the number of matrix-vector products, i.e., the number of CG iterations
+ * plus one for the initial residual.
+ */
+template<typename value_type>
+class MyMatrix
+{
+public:
+  MyMatrix(unsigned int const size) : M(size), n_vmult(0)
+  {
+    data.resize(M * M);
+  }
+
+  void
+  vmult(value_type * dst, value_type * src) const
+  {
+    ++n_vmult;
+
+    for(unsigned int i = 0; i < M; ++i)
+    {
+      dst[i] = value_type();
+      for(unsigned int j = 0; j < M; ++j)
+        dst[i] += data[i * M + j] * src[j];
+    }
+  }
+
+  void
+  set_value(value_type const value, unsigned int const i, unsigned int const j)
+  {
+    AssertThrow(i < M && j < M, ExcMessage("Index exceeds matrix dimensions."));
+
+    data[i * M + j] = value;
+  }
+
+  unsigned int
+  get_n_iterations() const
+  {
+    return n_vmult - 1;
+  }
+
+private:
+  // number of rows and columns of matrix
+  unsigned int const        M;
+  AlignedVector<value_type> data;
+
+  mutable unsigned int n_vmult;
+};
+
+template<typename value_type>
+value_type
+residual_norm(MyMatrix<value_type> const &      matrix,
+              AlignedVector<value_type> const & x,
+              AlignedVector<value_type> const & b)
+{
+  AlignedVector<value_type> x_copy(x), residual(b.size());
+  matrix.vmult(residual.begin(), x_copy.begin());
+
+  value_type norm = value_type();
+  for(unsigned int i = 0; i < b.size(); ++i)
+    norm += (b[i] - residual[i]) * (b[i] - residual[i]);
+
+  return std::sqrt(norm);
+}
+
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                         MAIN                                       */
+/*                                                                                    */
+/**************************************************************************************/
+
+// double: symmetric positive definite matrix of size M=3, converges in at most M iterations up to
+// round-off errors
+void
+cg_test_1a()
+{
+  std::cout << std::endl << "CG solver (double), size M=3:" << std::endl << std::endl;
+
+  SolverData solver_data(100, 1e-20, 1e-12);
+
+  typedef Elementwise::PreconditionerIdentity<double>   Preconditioner;
+  typedef MyMatrix<double>                              Matrix;
+  Preconditioner                                        preconditioner(M);
+  Elementwise::SolverCG<double, Matrix, Preconditioner> cg_solver(M, solver_data);
+
+  AlignedVector<double> b(M), x(M);
+  b[0] = 1.0;
+  b[1] = 4.0;
+  b[2] = 6.0;
+
+  Matrix matrix(M);
+  matrix.set_value(4.0, 0, 0);
+  matrix.set_value(1.0, 0, 1);
+  matrix.set_value(1.0, 0, 2);
+  matrix.set_value(1.0, 1, 0);
+  matrix.set_value(3.0, 1, 1);
+  matrix.set_value(0.5, 1, 2);
+  matrix.set_value(1.0, 2, 0);
+  matrix.set_value(0.5, 2, 1);
+  matrix.set_value(2.0, 2, 2);
+
+  cg_solver.solve(&matrix, x.begin(), b.begin(), &preconditioner);
+
+  unsigned int const n_iterations = matrix.get_n_iterations();
+
+  bool const converged =
+    residual_norm(matrix, x, b) < 1e-10 * residual_norm(matrix, AlignedVector<double>(M), b);
+
+  std::cout << "Converged: " << (converged ? "ok" : "wrong") << std::endl;
+  std::cout << "Number of iterations <= M + 1: " << (n_iterations <= M + 1 ? "ok" : "wrong")
+            << std::endl;
+}
+
+// double: 1D Laplace matrix of size M=100, the iteration terminates once the relative tolerance
+// is reached (before the maximum number of iterations)
+void
+cg_test_1b()
+{
+  std::cout << std::endl << "CG solver (double), size M=100:" << std::endl << std::endl;
+
+  unsigned int const M_large  = 100;
+  unsigned int const max_iter = 1000;
+  SolverData         solver_data(max_iter, 1e-20, 1e-10);
+
+  typedef Elementwise::PreconditionerIdentity<double>   Preconditioner;
+  typedef MyMatrix<double>                              Matrix;
+  Preconditioner                                        preconditioner(M_large);
+  Elementwise::SolverCG<double, Matrix, Preconditioner> cg_solver(M_large, solver_data);
+
+  AlignedVector<double> b(M_large), x(M_large);
+  for(unsigned int i = 0; i < M_large; ++i)
+    b[i] = 1.0;
+
+  Matrix matrix(M_large);
+  for(unsigned int i = 0; i < M_large; ++i)
+  {
+    matrix.set_value(2.0, i, i);
+    if(i > 0)
+    {
+      matrix.set_value(-1.0, i - 1, i);
+      matrix.set_value(-1.0, i, i - 1);
+    }
+  }
+
+  cg_solver.solve(&matrix, x.begin(), b.begin(), &preconditioner);
+
+  unsigned int const n_iterations = matrix.get_n_iterations();
+
+  bool const converged =
+    residual_norm(matrix, x, b) < 1e-8 * residual_norm(matrix, AlignedVector<double>(M_large), b);
+
+  std::cout << "Converged: " << (converged ? "ok" : "wrong") << std::endl;
+  std::cout << "Number of iterations < max_iter: " << (n_iterations < max_iter ? "ok" : "wrong")
+            << std::endl;
+}
+
+// VectorizedArray: solve different systems of equations for the different components of the
+// vectorized array, i.e., a zero right-hand side (converged before the first iteration), a
+// multiple of the identity matrix (converged after one iteration), and a symmetric positive
+// definite matrix. The components that have converged are not updated anymore.
+void
+cg_test_2()
+{
+  std::cout << std::endl
+            << "CG solver (VectorizedArray<double>), size M=3, solve different systems:"
+            << std::endl
+            << std::endl;
+
+  SolverData solver_data(100, 1e-20, 1e-12);
+
+  typedef VectorizedArray<double>                       Number;
+  typedef Elementwise::PreconditionerIdentity<Number>   Preconditioner;
+  typedef MyMatrix<Number>                              Matrix;
+  Preconditioner                                        preconditioner(M);
+  Elementwise::SolverCG<Number, Matrix, Preconditioner> cg_solver(M, solver_data);
+
+  double const A_spd[M][M] = {{4.0, 1.0, 1.0}, {1.0, 3.0, 0.5}, {1.0, 0.5, 2.0}};
+
+  AlignedVector<Number> b(M), x(M);
+  Matrix                matrix(M);
+  for(unsigned int i = 0; i < M; ++i)
+  {
+    for(unsigned int j = 0; j < M; ++j)
+    {
+      Number a;
+      for(unsigned int v = 0; v < Number::size(); ++v)
+      {
+        if(v % 3 == 0)
+          a[v] = (i == j) ? 1.0 : 0.0;
+        else if(v % 3 == 1)
+          a[v] = (i == j) ? 2.0 : 0.0;
+        else
+          a[v] = A_spd[i][j];
+      }
+      matrix.set_value(a, i, j);
+    }
+
+    for(unsigned int v = 0; v < Number::size(); ++v)
+      b[i][v] = (v % 3 == 0) ? 0.0 : 1.0 + i;
+  }
+
+  cg_solver.solve(&matrix, x.begin(), b.begin(), &preconditioner);
+
+  unsigned int const n_iterations = matrix.get_n_iterations();
+
+  Number const norm   = residual_norm(matrix, x, b);
+  Number const norm_b = residual_norm(matrix, AlignedVector<Number>(M), b);
+
+  for(unsigned int v = 0; v < Number::size(); ++v)
+  {
+    bool exact = true;
+    for(unsigned int i = 0; i < M; ++i)
+    {
+      if(v % 3 == 0 && x[i][v] != 0.0)
+        exact = false;
+      if(v % 3 == 1 && x[i][v] != 0.5 * b[i][v])
+        exact = false;
+    }
+
+    bool const converged = norm[v] <= 1e-10 * norm_b[v];
+
+    std::cout << "Converged[" << v << "]: " << (converged && exact ? "ok" : "wrong") << std::endl;
+  }
+
+  std::cout << "Number of iterations <= M + 1: " << (n_iterations <= M + 1 ? "ok" : "wrong")
+            << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    // double
+    ExaDG::cg_test_1a();
+    ExaDG::cg_test_1b();
+
+    // VectorizedArray<double>
+    ExaDG::cg_test_2();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
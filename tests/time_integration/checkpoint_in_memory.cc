@@ -0,0 +1,323 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/time_integration/time_int_base.h>
+
+using namespace dealii;
+
+typedef LinearAlgebra::distributed::Vector<double> VectorType;
+
+/*
+ * Explicit Euler time integrator for du/dt = u + t, which is just complex enough to write and read
+ * restart data through TimeIntBase.
+ */
+class TimeIntTest : public ExaDG::TimeIntBase
+{
+public:
+  TimeIntTest(DoFHandler<2> const &      dof_handler_in,
+              ExaDG::RestartData const & restart_data,
+              MPI_Comm const &           mpi_comm)
+    : TimeIntBase(0.0, 1.0e3, 1000000, restart_data, mpi_comm, false),
+      dof_handler(dof_handler_in),
+      time_step(0.1)
+  {
+  }
+
+  void
+  setup(bool const do_restart) override
+  {
+    solution.reinit(dof_handler.locally_owned_dofs(), mpi_comm);
+
+    if(do_restart)
+    {
+      read_restart();
+    }
+    else
+    {
+      for(auto const i : solution.locally_owned_elements())
+        solution(i) = 1.0 + 0.01 * i;
+    }
+  }
+
+  double
+  get_time_step_size() const override
+  {
+    return time_step;
+  }
+
+  void
+  set_current_time_step_size(double const & time_step_size) override
+  {
+    time_step = time_step_size;
+  }
+
+  VectorType &
+  get_solution()
+  {
+    return solution;
+  }
+
+  void
+  discard_own_copy_of_checkpoint()
+  {
+    checkpoint_in_memory.discard_own_copy();
+  }
+
+private:
+  void
+  do_timestep_pre_solve(bool const /*print_header*/) override
+  {
+  }
+
+  void
+  solve_timestep() override
+  {
+    solution *= 1.0 + time_step;
+    solution.add(time_step * time);
+  }
+
+  void
+  do_timestep_post_solve() override
+  {
+    time += time_step;
+    ++time_step_number;
+
+    write_restart();
+  }
+
+  void
+  postprocessing() const override
+  {
+  }
+
+  void
+  do_write_restart(ExaDG::RestartArchiveOut & archive) const override
+  {
+    {
+      boost::archive::binary_oarchive oa(archive.preamble());
+      oa & time;
+    }
+
+    ExaDG::write_restart_vector(archive, solution, dof_handler);
+  }
+
+  void
+  do_read_restart(ExaDG::RestartArchiveIn & archive) override
+  {
+    {
+      boost::archive::binary_iarchive ia(archive.preamble());
+      ia & time;
+    }
+
+    ExaDG::read_restart_vector(archive, solution, dof_handler);
+  }
+
+  DoFHandler<2> const & dof_handler;
+
+  double time_step;
+
+  VectorType solution;
+};
+
+/*
+ * The time integrator prints wall times, which are not reproducible.
+ */
+class SuppressOutput
+{
+public:
+  SuppressOutput() : buffer(std::cout.rdbuf(nullptr))
+  {
+  }
+
+  ~SuppressOutput()
+  {
+    std::cout.rdbuf(buffer);
+  }
+
+private:
+  std::streambuf * buffer;
+};
+
+std::string
+compare(VectorType const & a, VectorType const & b)
+{
+  VectorType difference(a);
+  difference -= b;
+
+  return (difference.linfty_norm() == 0.0) ? "ok" : "wrong";
+}
+
+void
+test()
+{
+  MPI_Comm const     mpi_comm = MPI_COMM_WORLD;
+  ConditionalOStream pcout(std::cout, Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+  parallel::distributed::Triangulation<2> triangulation(mpi_comm);
+  GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(3);
+
+  FE_DGQ<2>     fe(1);
+  DoFHandler<2> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  ExaDG::RestartData restart_data;
+  restart_data.write_restart                 = true;
+  restart_data.interval_time_steps           = 3;
+  restart_data.filename                      = "checkpoint_in_memory";
+  restart_data.write_checkpoint_in_memory    = true;
+  restart_data.interval_time_steps_in_memory = 4;
+
+  TimeIntTest time_integrator(dof_handler, restart_data, mpi_comm);
+
+  // the restart file is written after 3 time steps, the in-memory checkpoint after 4 time steps
+  VectorType solution_3, solution_4, solution_5;
+  double     time_3 = 0.0, time_4 = 0.0;
+  {
+    SuppressOutput suppress_output;
+
+    time_integrator.setup(false);
+
+    for(unsigned int i = 0; i < 5; ++i)
+    {
+      time_integrator.advance_one_timestep();
+
+      if(i == 2)
+      {
+        solution_3 = time_integrator.get_solution();
+        time_3     = time_integrator.get_time();
+      }
+      else if(i == 3)
+      {
+        solution_4 = time_integrator.get_solution();
+        time_4     = time_integrator.get_time();
+      }
+    }
+
+    solution_5 = time_integrator.get_solution();
+  }
+
+  // kill the state and resume from the in-memory checkpoint
+  {
+    time_integrator.get_solution() = 0.0;
+
+    bool from_memory = false;
+    {
+      SuppressOutput suppress_output;
+      from_memory = time_integrator.resume_from_checkpoint();
+    }
+
+    pcout << "Resume from in-memory checkpoint: " << from_memory << std::endl;
+    pcout << "  time: " << (time_integrator.get_time() == time_4 ? "ok" : "wrong") << std::endl;
+    pcout << "  number of time steps: " << time_integrator.get_number_of_time_steps()
+          << std::endl;
+    pcout << "  solution: " << compare(time_integrator.get_solution(), solution_4) << std::endl;
+
+    {
+      SuppressOutput suppress_output;
+      time_integrator.advance_one_timestep();
+    }
+
+    pcout << "  solution after next time step: "
+          << compare(time_integrator.get_solution(), solution_5) << std::endl;
+  }
+
+  // lose the own copy of the first process, which is then restored from its buddy
+  {
+    if(Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+      time_integrator.discard_own_copy_of_checkpoint();
+
+    time_integrator.get_solution() = 0.0;
+
+    bool from_memory = false;
+    {
+      SuppressOutput suppress_output;
+      from_memory = time_integrator.resume_from_checkpoint();
+    }
+
+    pcout << "Resume from in-memory checkpoint of buddy: " << from_memory << std::endl;
+    pcout << "  time: " << (time_integrator.get_time() == time_4 ? "ok" : "wrong") << std::endl;
+    pcout << "  solution: " << compare(time_integrator.get_solution(), solution_4) << std::endl;
+  }
+
+  // a new time integrator has no in-memory checkpoint and falls back to the restart file
+  {
+    TimeIntTest time_integrator_new(dof_handler, restart_data, mpi_comm);
+
+    {
+      SuppressOutput suppress_output;
+      time_integrator_new.setup(true);
+    }
+
+    pcout << "Resume from restart file:" << std::endl;
+    pcout << "  time: " << (time_integrator_new.get_time() == time_3 ? "ok" : "wrong")
+          << std::endl;
+    pcout << "  solution: " << compare(time_integrator_new.get_solution(), solution_3) << std::endl;
+  }
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    deallog.depth_console(0);
+
+    test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
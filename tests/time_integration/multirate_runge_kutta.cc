@@ -0,0 +1,335 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/fe/mapping_q_generic.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/compressible_navier_stokes/spatial_discretization/operator.h>
+#include <exadg/time_integration/explicit_runge_kutta.h>
+#include <exadg/time_integration/multirate_runge_kutta.h>
+
+using namespace dealii;
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+typedef LinearAlgebra::distributed::Vector<double> VectorType;
+
+typedef CompNS::Operator<dim, double> Operator;
+
+typedef std::pair<types::boundary_id, std::shared_ptr<Function<dim>>> pair;
+
+double const GAMMA    = 1.4;
+double const PRESSURE = 1.0;
+double const VELOCITY = 1.0;
+
+/*
+ * Density wave transported with constant velocity and pressure, which is an exact solution of the
+ * Euler equations.
+ */
+double
+get_density(Point<dim> const & p, double const t)
+{
+  return 1.0 + 0.2 * std::sin(2.0 * numbers::PI * (p[0] - VELOCITY * t));
+}
+
+class Solution : public Function<dim>
+{
+public:
+  Solution() : Function<dim>(dim + 2, 0.0)
+  {
+  }
+
+  double
+  value(Point<dim> const & p, unsigned int const component = 0) const override
+  {
+    double const rho = get_density(p, this->get_time());
+
+    if(component == 0)
+      return rho;
+    else if(component == 1)
+      return rho * VELOCITY;
+    else if(component == dim + 1)
+      return PRESSURE / (GAMMA - 1.0) + 0.5 * rho * VELOCITY * VELOCITY;
+    else
+      return 0.0;
+  }
+};
+
+class DensityBC : public Function<dim>
+{
+public:
+  DensityBC() : Function<dim>(1, 0.0)
+  {
+  }
+
+  double
+  value(Point<dim> const & p, unsigned int const /*component*/) const override
+  {
+    return get_density(p, this->get_time());
+  }
+};
+
+// energy per unit mass
+class EnergyBC : public Function<dim>
+{
+public:
+  EnergyBC() : Function<dim>(1, 0.0)
+  {
+  }
+
+  double
+  value(Point<dim> const & p, unsigned int const /*component*/) const override
+  {
+    double const rho = get_density(p, this->get_time());
+
+    return PRESSURE / (rho * (GAMMA - 1.0)) + 0.5 * VELOCITY * VELOCITY;
+  }
+};
+
+class SuppressOutput
+{
+public:
+  SuppressOutput() : buffer(std::cout.rdbuf(nullptr))
+  {
+  }
+
+  ~SuppressOutput()
+  {
+    std::cout.rdbuf(buffer);
+  }
+
+private:
+  std::streambuf * buffer;
+};
+
+/*
+ * Compares the multirate Runge-Kutta scheme with the global (single-rate) Runge-Kutta scheme of
+ * the same order on a graded mesh, where the left half of the domain is refined once more. The
+ * single-rate scheme uses the time step size of the fine cells for all cells, while the multirate
+ * scheme advances the coarse cells with twice this time step size. The errors with respect to the
+ * exact solution are dominated by the spatial discretization and have to agree closely.
+ */
+void
+test(unsigned int const order)
+{
+  MPI_Comm const mpi_comm = MPI_COMM_WORLD;
+
+  parallel::distributed::Triangulation<dim> triangulation(mpi_comm);
+  GridGenerator::hyper_cube(triangulation, 0.0, 1.0);
+  triangulation.refine_global(2);
+  for(auto const & cell : triangulation.active_cell_iterators())
+    if(cell->is_locally_owned() && cell->center()[0] < 0.5)
+      cell->set_refine_flag();
+  triangulation.execute_coarsening_and_refinement();
+
+  MappingQGeneric<dim> mapping(1);
+
+  unsigned int const degree = 2;
+
+  std::shared_ptr<CompNS::BoundaryDescriptor<dim>> boundary_descriptor_density(
+    new CompNS::BoundaryDescriptor<dim>());
+  std::shared_ptr<CompNS::BoundaryDescriptor<dim>> boundary_descriptor_velocity(
+    new CompNS::BoundaryDescriptor<dim>());
+  std::shared_ptr<CompNS::BoundaryDescriptor<dim>> boundary_descriptor_pressure(
+    new CompNS::BoundaryDescriptor<dim>());
+  std::shared_ptr<CompNS::BoundaryDescriptorEnergy<dim>> boundary_descriptor_energy(
+    new CompNS::BoundaryDescriptorEnergy<dim>());
+
+  std::vector<double> velocity = {VELOCITY, 0.0};
+
+  boundary_descriptor_density->dirichlet_bc.insert(pair(0, new DensityBC()));
+  boundary_descriptor_velocity->dirichlet_bc.insert(
+    pair(0, new Functions::ConstantFunction<dim>(velocity)));
+  boundary_descriptor_pressure->neumann_bc.insert(pair(0, new Functions::ZeroFunction<dim>(1)));
+  boundary_descriptor_energy->boundary_variable.insert(
+    std::make_pair(0, CompNS::EnergyBoundaryVariable::Energy));
+  boundary_descriptor_energy->dirichlet_bc.insert(pair(0, new EnergyBC()));
+
+  std::shared_ptr<CompNS::FieldFunctions<dim>> field_functions(new CompNS::FieldFunctions<dim>());
+  field_functions->initial_solution.reset(new Solution());
+  field_functions->right_hand_side_density.reset(new Functions::ZeroFunction<dim>(1));
+  field_functions->right_hand_side_velocity.reset(new Functions::ZeroFunction<dim>(dim));
+  field_functions->right_hand_side_energy.reset(new Functions::ZeroFunction<dim>(1));
+
+  CompNS::InputParameters param;
+  param.equation_type                   = CompNS::EquationType::Euler;
+  param.right_hand_side                 = false;
+  param.start_time                      = 0.0;
+  param.end_time                        = 0.2;
+  param.dynamic_viscosity               = 0.0;
+  param.reference_density               = 1.0;
+  param.heat_capacity_ratio             = GAMMA;
+  param.thermal_conductivity            = 0.0;
+  param.specific_gas_constant           = 1.0;
+  param.max_temperature                 = PRESSURE / 0.8;
+  param.max_velocity                    = VELOCITY;
+  param.temporal_discretization         = CompNS::TemporalDiscretization::ExplRK;
+  param.order_time_integrator           = order;
+  param.calculation_of_time_step_size   = CompNS::TimeStepCalculation::CFL;
+  param.use_local_time_stepping         = true;
+  param.max_number_of_time_step_classes = 4;
+  param.triangulation_type              = TriangulationType::Distributed;
+  param.mapping                         = MappingType::Affine;
+  param.n_q_points_convective           = CompNS::QuadratureRule::Standard;
+  param.n_q_points_viscous              = CompNS::QuadratureRule::Standard;
+  param.use_combined_operator           = false;
+
+  std::shared_ptr<Operator> pde_operator;
+  {
+    SuppressOutput suppress_output;
+
+    pde_operator.reset(new Operator(triangulation,
+                                    mapping,
+                                    degree,
+                                    boundary_descriptor_density,
+                                    boundary_descriptor_velocity,
+                                    boundary_descriptor_pressure,
+                                    boundary_descriptor_energy,
+                                    field_functions,
+                                    param,
+                                    "fluid",
+                                    mpi_comm));
+
+    std::shared_ptr<MatrixFreeData<dim, double>> matrix_free_data(
+      new MatrixFreeData<dim, double>());
+    pde_operator->fill_matrix_free_data(*matrix_free_data);
+
+    std::shared_ptr<MatrixFree<dim, double>> matrix_free(new MatrixFree<dim, double>());
+    matrix_free->reinit(mapping,
+                        matrix_free_data->get_dof_handler_vector(),
+                        matrix_free_data->get_constraint_vector(),
+                        matrix_free_data->get_quadrature_vector(),
+                        matrix_free_data->data);
+
+    pde_operator->setup(matrix_free, matrix_free_data);
+  }
+
+  auto const compute_error = [&](VectorType & solution) {
+    Solution exact;
+    exact.set_time(param.end_time);
+
+    solution.update_ghost_values();
+
+    Vector<float> error_cellwise(triangulation.n_active_cells());
+    VectorTools::integrate_difference(mapping,
+                                      pde_operator->get_dof_handler(),
+                                      solution,
+                                      exact,
+                                      error_cellwise,
+                                      QGauss<dim>(degree + 2),
+                                      VectorTools::L2_norm);
+
+    return VectorTools::compute_global_error(triangulation,
+                                             error_cellwise,
+                                             VectorTools::L2_norm);
+  };
+
+  // time step size of the fine cells, CFL = 0.05
+  unsigned int const n_steps_fine = 80;
+  double const       time_step    = param.end_time / n_steps_fine;
+
+  VectorType src, dst;
+  pde_operator->initialize_dof_vector(src);
+  pde_operator->initialize_dof_vector(dst);
+
+  // global time stepping
+  ExplicitRungeKuttaTimeIntegrator<Operator, VectorType> single_rate(order, pde_operator);
+
+  pde_operator->prescribe_initial_conditions(src, param.start_time);
+  for(unsigned int n = 0; n < n_steps_fine; ++n)
+  {
+    single_rate.solve_timestep(dst, src, param.start_time + n * time_step, time_step);
+    src.swap(dst);
+  }
+
+  double const error_single_rate = compute_error(src);
+
+  // local time stepping, where the time step size refers to the coarsest class
+  MultirateRungeKutta<Operator, VectorType> multirate(order, pde_operator);
+
+  unsigned int const n_classes   = pde_operator->get_number_of_time_step_classes();
+  unsigned int const factor      = 1 << (n_classes - 1);
+  double const       time_step_c = time_step * factor;
+
+  pde_operator->prescribe_initial_conditions(src, param.start_time);
+  for(unsigned int n = 0; n < n_steps_fine / factor; ++n)
+  {
+    multirate.solve_timestep(dst, src, param.start_time + n * time_step_c, time_step_c);
+    src.swap(dst);
+  }
+
+  double const error_multirate = compute_error(src);
+
+  bool const errors_agree =
+    std::abs(error_multirate - error_single_rate) < 0.05 * error_single_rate;
+
+  std::cout << "Order " << order << ":" << std::endl;
+  std::cout << "  number of time step classes: " << n_classes << std::endl;
+  std::cout << "  error multirate vs. single-rate: " << (errors_agree ? "ok" : "wrong")
+            << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    deallog.depth_console(0);
+
+    test(2);
+    test(3);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}